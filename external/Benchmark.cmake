@@ -0,0 +1,21 @@
+# Provides benchmark::benchmark to the benchmark executables.
+# Uses the installed Google Benchmark when there is one, the pinned submodule in external/benchmark otherwise,
+# so configuring never needs the network
+if(NOT TARGET benchmark::benchmark)
+  find_package(benchmark CONFIG QUIET)
+endif()
+
+if(NOT TARGET benchmark::benchmark)
+  set(BENCHMARK_SOURCE_DIR ${CMAKE_CURRENT_LIST_DIR}/benchmark)
+
+  if(NOT EXISTS ${BENCHMARK_SOURCE_DIR}/CMakeLists.txt)
+    message(FATAL_ERROR "Google Benchmark is neither installed nor checked out in ${BENCHMARK_SOURCE_DIR}. "
+      "Run git submodule update --init external/benchmark")
+  endif()
+
+  set(BENCHMARK_ENABLE_TESTING OFF)
+  set(BENCHMARK_ENABLE_INSTALL OFF)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF)
+
+  add_subdirectory(${BENCHMARK_SOURCE_DIR} ${CMAKE_BINARY_DIR}/external/benchmark EXCLUDE_FROM_ALL)
+endif()
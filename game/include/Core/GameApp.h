@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+
 #include "IApplication.h"
 
 namespace PFA::Core
@@ -14,5 +16,15 @@ namespace PFA::Core
 		void onUpdate() override;
 
 		void onStop() override;
+
+#ifdef _DEBUG
+		float		m_lastStatsReportTime = 0.f;
+		uint64_t	m_lastStatsReportFrame = 0;
+
+		/**
+		 * \brief Logs the transform matrix rebuild counters once per second
+		 */
+		void reportTransformStats();
+#endif
 	};
 }
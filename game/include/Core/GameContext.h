@@ -31,6 +31,7 @@ namespace PFA::Core
 		std::unique_ptr<Core::AudioManager>					m_audioManager;
 		std::unique_ptr<Gameplay::IGameScene>				m_scene;
 		bool												m_isPaused = false;
+		bool												m_isRestartPending = false;
 
 		/**
 		 * \brief Binds the game's exit function
@@ -38,7 +39,8 @@ namespace PFA::Core
 		void bindExitFunc();
 
 		/**
-		 * \brief Binds the game's restart function
+		 * \brief Binds the game's restart function.
+		 * The restart is deferred to the start of the next frame, since it is requested while the scene updates
 		 */
 		void bindRestartFunc();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/GameContext.h"
+#include "Utility/ServiceLocator.h"
 
 namespace PFA::Core
 {
@@ -12,7 +13,10 @@ namespace PFA::Core
 		static_assert(std::is_same_v<IGameScene, SceneT> || std::is_base_of_v<IGameScene, SceneT>);
 
 		if (typeid(SceneT) != typeid(*m_scene))
+		{
 			m_scene = std::make_unique<SceneT>();
+			LibGL::ServiceLocator::provide<LibGL::StructuralCommandBuffer>(m_scene->getCommands());
+		}
 
 		m_scene->load();
 	}
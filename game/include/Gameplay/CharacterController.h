@@ -12,6 +12,8 @@ namespace PFA::Gameplay
 	class CharacterController final : public LibGL::Component
 	{
 	public:
+		static constexpr LibGL::EUpdatePhase UPDATE_PHASE = LibGL::EUpdatePhase::INPUT;
+
 		CharacterController(LibGL::Entity& owner, LibMath::Vector3 groundCheckPos,
 			float moveSpeed, float rotationSpeed, float jumpForce);
 
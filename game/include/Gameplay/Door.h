@@ -29,7 +29,7 @@ namespace PFA::Gameplay
 		LibMath::Vector2						m_uvOffset;
 
 		void bindOnColorChange();
-		void open() const;
-		void close() const;
+		void open();
+		void close();
 	};
 }
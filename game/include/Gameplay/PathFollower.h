@@ -3,6 +3,7 @@
 #include <vector>
 #include "CyclingMode.h"
 #include "Component.h"
+#include "Transform.h"
 
 namespace PFA::Gameplay
 {
@@ -11,6 +12,10 @@ namespace PFA::Gameplay
 	public:
 		using Vec3 = LibMath::Vector3;
 
+		static constexpr bool IS_THREAD_SAFE = true;
+		typedef LibGL::ComponentTypeList<LibMath::Transform> UpdateWrites;
+		static constexpr bool IS_RELOCATABLE = true;
+
 		PathFollower(LibGL::Entity& p_owner, const std::vector<Vec3>& p_path, ECyclingMode p_cyclingMode, float p_moveSpeed);
 		Vec3				currentPoint()const;
 		Vec3				nextPoint()const;
@@ -2,6 +2,7 @@
 
 #include <Scene.h>
 
+#include "EBroadphaseType.h"
 #include "Core/EventDefs.h"
 #include "LowRenderer/Camera.h"
 
@@ -32,7 +33,8 @@ namespace PFA::Gameplay
 		Events::LevelCompleteEvent::ListenerId	m_levelCompleteListenerId = 0;
 
 		IGameScene(const LibMath::Vector3& spawnPoint, const LibMath::Vector3& spawnRotation,
-			const LibMath::Vector3& endPoint);
+			const LibMath::Vector3& endPoint,
+			LibGL::Physics::EBroadphaseType broadphaseType = LibGL::Physics::EBroadphaseType::DYNAMIC_AABB_TREE);
 
 		/**
 		 * \brief Gets or loads the shader with the given file name
@@ -53,10 +55,11 @@ namespace PFA::Gameplay
 		virtual void bindLevelCompleteListener() = 0;
 
 	private:
-		LibMath::Vector3			m_spawnPoint;
-		LibMath::Vector3			m_spawnRotation;
-		LibMath::Vector3			m_endPoint;
-		LibGL::Event<>::ListenerId	m_resizeListenerId = 0;
+		LibMath::Vector3					m_spawnPoint;
+		LibMath::Vector3					m_spawnRotation;
+		LibMath::Vector3					m_endPoint;
+		LibGL::Physics::EBroadphaseType		m_broadphaseType;
+		LibGL::Event<>::ListenerId			m_resizeListenerId = 0;
 
 		/**
 		 * \brief Adds the camera in the scene as a child of the given entity
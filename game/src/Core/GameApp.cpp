@@ -1,9 +1,14 @@
 #include "Core/GameApp.h"
 #include "Core/GameContext.h"
 #include "Debug/Log.h"
+#include "Transform.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/Timer.h"
 
 using namespace PFA::Events;
 using namespace LibGL::Application;
+using namespace LibGL::Utility;
+using namespace LibMath;
 
 namespace PFA::Core
 {
@@ -19,10 +24,39 @@ namespace PFA::Core
 
 	void GameApp::onUpdate()
 	{
+#ifdef _DEBUG
+		reportTransformStats();
+#endif
 	}
 
 	void GameApp::onStop()
 	{
 		DEBUG_LOG("Game stopped\n");
 	}
+
+#ifdef _DEBUG
+	void GameApp::reportTransformStats()
+	{
+		const Timer& timer = LGL_SERVICE(Timer);
+		const float currentTime = timer.getUnscaledTime();
+
+		if (currentTime - m_lastStatsReportTime < 1.f)
+			return;
+
+		const Transform::MatrixStats stats = Transform::getMatrixStats();
+		const uint64_t frameCount = timer.getFrameCount() - m_lastStatsReportFrame;
+
+		if (frameCount != 0)
+		{
+			DEBUG_LOG("Transform matrices per frame: %llu changes, %llu rebuilds, %llu avoided\n",
+				static_cast<unsigned long long>(stats.m_changeCount / frameCount),
+				static_cast<unsigned long long>(stats.m_rebuildCount / frameCount),
+				static_cast<unsigned long long>(stats.getAvoidedCount() / frameCount));
+		}
+
+		Transform::resetMatrixStats();
+		m_lastStatsReportTime = currentTime;
+		m_lastStatsReportFrame = timer.getFrameCount();
+	}
+#endif
 }
@@ -49,6 +49,7 @@ namespace PFA::Core
 		ServiceLocator::provide<ResourceManager>(*m_resourcesManager);
 		ServiceLocator::provide<AudioManager>(*m_audioManager);
 		ServiceLocator::provide<EventManager>(*m_eventManager);
+		ServiceLocator::provide<StructuralCommandBuffer>(m_scene->getCommands());
 
 		bindExitFunc();
 		bindRestartFunc();
@@ -68,6 +69,12 @@ namespace PFA::Core
 	{
 		IContext::update();
 
+		if (m_isRestartPending)
+		{
+			m_isRestartPending = false;
+			loadScene<Level1>();
+		}
+
 		const auto& inputManager = LGL_SERVICE(InputManager);
 
 		if (inputManager.isKeyPressed(EKey::KEY_ESCAPE))
@@ -118,7 +125,7 @@ namespace PFA::Core
 	{
 		const auto restartFunc = [this]
 		{
-			loadScene<Level1>();
+			m_isRestartPending = true;
 		};
 
 		m_restartListenerId = LGL_SERVICE(EventManager).subscribe<RestartEvent>(restartFunc);
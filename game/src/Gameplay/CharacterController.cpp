@@ -82,8 +82,9 @@ namespace PFA::Gameplay
 			targetVelocity = moveDir * (m_moveSpeed * speedScale / moveDir.magnitude());
 		}
 
+		// Applied as a force so a sleeping body wakes up
 		targetVelocity.m_y += rb->m_velocity.m_y;
-		rb->m_velocity = targetVelocity;
+		rb->addForce(targetVelocity - rb->m_velocity, EForceMode::VELOCITY_CHANGE);
 	}
 
 	void CharacterController::handleMouse() const
@@ -111,7 +112,7 @@ namespace PFA::Gameplay
 		// Make the camera look up or down
 		Vector3 camRotation = camera.getRotation();
 
-		camRotation.m_x += mouseDelta.m_y * rotationSpeed;
+		camRotation.m_x -= mouseDelta.m_y * rotationSpeed;
 		camRotation.m_x = clamp(camRotation.m_x, -90.f, 90.f);
 
 		camera.setRotation(camRotation);
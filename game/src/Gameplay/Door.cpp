@@ -93,7 +93,7 @@ namespace PFA::Gameplay
 			onColorChangeFunc);
 	}
 
-	void Door::open() const
+	void Door::open()
 	{
 		Entity& owner = getOwner();
 		ASSERT(typeid(owner) == typeid(Mesh) || dynamic_cast<Mesh*>(&owner) != nullptr);
@@ -105,9 +105,12 @@ namespace PFA::Gameplay
 
 		Mesh& ownerMesh = dynamic_cast<Mesh&>(owner);
 		ownerMesh.getMaterial() = m_openMat;
+
+		// Only the closed door's material scrolls, so the open door costs nothing per frame
+		setAwake(false);
 	}
 
-	void Door::close() const
+	void Door::close()
 	{
 		Entity& owner = getOwner();
 		ASSERT(typeid(owner) == typeid(Mesh) || dynamic_cast<Mesh*>(&owner) != nullptr);
@@ -119,5 +122,7 @@ namespace PFA::Gameplay
 
 		Mesh& ownerMesh = dynamic_cast<Mesh&>(owner);
 		ownerMesh.getMaterial() = m_closedMat;
+
+		setAwake(true);
 	}
 }
@@ -45,18 +45,19 @@ namespace PFA::Gameplay
 		{
 			const Vector3 pos = getOwner().getGlobalTransform().getPosition();
 
-			const auto colliders = overlapSphere(pos, m_useRange);
+			bool isPlayerInRange = false;
 
-			for (const auto& collider : colliders)
+			visitSphereOverlaps(pos, m_useRange, [&isPlayerInRange](ICollider& collider)
 			{
-				if (collider != nullptr &&
-					collider->getOwner().getComponent<CharacterController>())
-				{
-					auto& soundEngine = LGL_SERVICE(AudioManager).getSoundEngine();
-					soundEngine.play3D(PRESSED_SOUND, { pos.m_x, pos.m_y, pos.m_z });
-					LGL_SERVICE(EventManager).broadcast<LevelCompleteEvent>();
-					break;
-				}
+				isPlayerInRange = collider.getOwner().getComponent<CharacterController>() != nullptr;
+				return !isPlayerInRange;
+			});
+
+			if (isPlayerInRange)
+			{
+				auto& soundEngine = LGL_SERVICE(AudioManager).getSoundEngine();
+				soundEngine.play3D(PRESSED_SOUND, { pos.m_x, pos.m_y, pos.m_z });
+				LGL_SERVICE(EventManager).broadcast<LevelCompleteEvent>();
 			}
 		}
 	}
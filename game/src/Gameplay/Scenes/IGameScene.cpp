@@ -2,6 +2,7 @@
 
 #include "Gameplay/CharacterController.h"
 #include "BoxCollider.h"
+#include "ICollider.h"
 #include "Window.h"
 #include "Angle/Degree.h"
 #include "Core/Renderer.h"
@@ -35,9 +36,9 @@ using namespace PFA::Events;
 namespace PFA::Gameplay
 {
 	IGameScene::IGameScene(const Vector3& spawnPoint,
-		const Vector3& spawnRotation, const Vector3& endPoint) :
+		const Vector3& spawnRotation, const Vector3& endPoint, const EBroadphaseType broadphaseType) :
 		m_spawnPoint(spawnPoint), m_spawnRotation(spawnRotation),
-		m_endPoint(endPoint)
+		m_endPoint(endPoint), m_broadphaseType(broadphaseType)
 	{
 	}
 
@@ -52,14 +53,22 @@ namespace PFA::Gameplay
 		// Clear the scene in case it was already loaded
 		clear();
 
+		// The level's objects live until the next load, so they are allocated from the scene's arena
+		const Memory::ArenaScope loadScope = makeLoadScope();
+
+		ICollider::setBroadphase(m_broadphaseType);
+
 		bindLevelCompleteListener();
 
 		// Setup the player
+		constexpr Vector3 playerPosition(0.f, PLAYER_SIZE / 2.f, 0.f);
+		constexpr Vector3 playerScale(1.f, PLAYER_SIZE, 1.f);
+
 		const Transform playerTransform
 		{
-			Vector3(0.f, PLAYER_SIZE / 2.f, 0.f),
+			playerPosition,
 			m_spawnRotation,
-			Vector3(1.f, PLAYER_SIZE, 1.f)
+			playerScale
 		};
 
 		Entity& player = addNode<Entity>(nullptr, playerTransform);
@@ -69,7 +78,7 @@ namespace PFA::Gameplay
 
 		// A rigidbody is automatically added by the character controller
 		player.addComponent<CharacterController>(
-			Vector3(0.f, -playerTransform.getPosition().m_y / 2.f - .01f, 0.f), MOVE_SPEED,
+			Vector3(0.f, -playerPosition.m_y / 2.f - .01f, 0.f), MOVE_SPEED,
 			ROTATION_SPEED, JUMP_FORCE);
 
 		// Setup the camera
@@ -120,7 +129,9 @@ namespace PFA::Gameplay
 		const auto projMat = Matrix4::perspectiveProjection(60_deg,
 			LGL_SERVICE(LibGL::Application::Window).getAspect(), .3f, 1000.f);
 
-		const Vector4 camPos = parent.getMatrix().inverse() * Vector4(0.f, CAM_HEIGHT, 0.f, 1.f);
+		constexpr Vector4 camOffset(0.f, CAM_HEIGHT, 0.f, 1.f);
+
+		const Vector4 camPos = parent.getMatrix().inverseAffine() * camOffset;
 
 		const Transform camTransform
 		{
@@ -34,13 +34,15 @@ namespace PFA::Gameplay
 {
 	Level1::Level1() :
 		IGameScene(Vector3(18.f, .05f, 20.f), Vector3(0.f, -90.f, 0.f),
-			Vector3(8.f, 0.f, 7.f)),
+			Vector3(8.f, 0.f, 7.f), EBroadphaseType::SWEEP_AND_PRUNE),
 		m_lightsSSBO(EAccessSpecifier::STREAM_DRAW)
 	{
 	}
 
 	Level1& Level1::load()
 	{
+		const Memory::ArenaScope loadScope = makeLoadScope();
+
 		IGameScene::load();
 
 		placeFloor();
@@ -647,196 +649,204 @@ namespace PFA::Gameplay
 		{
 			float m_data[16];
 
-			GLMat4(const Matrix& mat) : m_data{}
+			constexpr GLMat4(const Matrix4& mat) : m_data{}
 			{
-				memcpy(m_data, mat.transposed().getArray(), sizeof(float[16]));
+				const Matrix4 transposed = mat.transposed();
+
+				for (Matrix4::length_t i = 0; i < 16; i++)
+					m_data[i] = transposed.getArray()[i];
 			}
 		};
 
-		std::vector<GLMat4> lightMats;
+		// The lights never change - their matrices are built at compile time
+		// and only the upload to the GPU is left for the runtime
+		static constexpr Cutoff spotCutoff { 1.f, .8660254f }; // { cos(0_deg), cos(30_deg) }
+
+		static constexpr GLMat4 lightMats[]
+		{
+			// Ambient light
+			Light(Color(.2f, .2f, .2f, 1.f)).getMatrix(),
 
-		// Ambient light
-		lightMats.emplace_back(Light(Color(.2f, .2f, .2f, 1.f)).getMatrix());
-		
 #pragma region SPOT_LIGHTS
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ -2, 3, 12 },
-			{ .7077f, -.3827f, .5938f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 2, 3, 2 },
-			{ .7077f, -.3827f, -.5939f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 14, 3, 2 },
-			{ -.7077f, -.3827f, .5939f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 14, 3, 12 },
-			{ -.7077f, -.3827f, -.5938f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ -2, 6, 12 },
-			{ .7077f, -.3827f, .5938f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 2, 6, 2 },
-			{ .7077f, -.3827f, -.5939f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 14, 6, 2 },
-			{ -.7077f, -.3827f, .5939f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
-
-		lightMats.emplace_back(SpotLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 14, 6, 12 },
-			{ -.7077f, -.3827f, -.5938f },
-			AttenuationData(10),
-			{ cos(0_deg), cos(30_deg)}
-		).getMatrix());
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ -2, 3, 12 },
+				{ .7077f, -.3827f, .5938f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 2, 3, 2 },
+				{ .7077f, -.3827f, -.5939f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 14, 3, 2 },
+				{ -.7077f, -.3827f, .5939f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 14, 3, 12 },
+				{ -.7077f, -.3827f, -.5938f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ -2, 6, 12 },
+				{ .7077f, -.3827f, .5938f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 2, 6, 2 },
+				{ .7077f, -.3827f, -.5939f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 14, 6, 2 },
+				{ -.7077f, -.3827f, .5939f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
+
+			SpotLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 14, 6, 12 },
+				{ -.7077f, -.3827f, -.5938f },
+				AttenuationData(10),
+				spotCutoff
+			).getMatrix(),
 #pragma endregion
 
 #pragma region POINT_LIGHTS_FLOOR_0
-		lightMats.emplace_back(PointLight(
-			Color( .945f, .945f, .945f ),
-			{ 18.f, 2.25f, 20.f },
-			AttenuationData(9)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .945f, .698f, .698f ),
-			{ 30.f, 2.25f, 20.f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 30.5f, 2.25f, 7.f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 30.5f, 2.25f, 3.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 15.5f, 2.25f, 3.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 15.5f, 2.25f, 7.f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 30.5f, 2.25f, 10.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 15.5f, 2.25f, 10.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 23.f, 2.25f, 3.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 23.f, 2.25f, 7.f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f ),
-			{ 23.f, 2.25f, 10.5f },
-			AttenuationData(7)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.f ),
-			{ 8.f, 5.25f, 7.f },
-			AttenuationData(9)
-		).getMatrix());
+			PointLight(
+				Color( .945f, .945f, .945f ),
+				{ 18.f, 2.25f, 20.f },
+				AttenuationData(9)
+			).getMatrix(),
+
+			PointLight(
+				Color( .945f, .698f, .698f ),
+				{ 30.f, 2.25f, 20.f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 30.5f, 2.25f, 7.f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 30.5f, 2.25f, 3.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 15.5f, 2.25f, 3.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 15.5f, 2.25f, 7.f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 30.5f, 2.25f, 10.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 15.5f, 2.25f, 10.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 23.f, 2.25f, 3.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 23.f, 2.25f, 7.f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f ),
+				{ 23.f, 2.25f, 10.5f },
+				AttenuationData(7)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.f ),
+				{ 8.f, 5.25f, 7.f },
+				AttenuationData(9)
+			).getMatrix(),
 #pragma endregion
 
 #pragma region POINT_LIGHTS_FLOOR_1
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 30.5f, 5.25f, 7.f },
-			AttenuationData(4)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 30.5f, 5.25f, 3.5f },
-			AttenuationData(4)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 15.5f, 5.25f, 7.f },
-			AttenuationData(4)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.75f ),
-			{ 20.f, 5.25f, 7.f },
-			AttenuationData(4)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.4f ),
-			{ 25.f, 5.25f, 7.f },
-			AttenuationData(5)
-		).getMatrix());
-
-		lightMats.emplace_back(PointLight(
-			Color( .698f, .945f, .698f, 1.f ),
-			{ 8.f, 5.25f, 7.f },
-			AttenuationData(9)
-		).getMatrix());
+			PointLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 30.5f, 5.25f, 7.f },
+				AttenuationData(4)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 30.5f, 5.25f, 3.5f },
+				AttenuationData(4)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 15.5f, 5.25f, 7.f },
+				AttenuationData(4)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.75f ),
+				{ 20.f, 5.25f, 7.f },
+				AttenuationData(4)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.4f ),
+				{ 25.f, 5.25f, 7.f },
+				AttenuationData(5)
+			).getMatrix(),
+
+			PointLight(
+				Color( .698f, .945f, .698f, 1.f ),
+				{ 8.f, 5.25f, 7.f },
+				AttenuationData(9)
+			).getMatrix(),
 #pragma endregion
+		};
 
-		m_lightsSSBO.sendBlocks(lightMats.data(), lightMats.size() * sizeof(GLMat4));
+		m_lightsSSBO.sendBlocks(lightMats, sizeof(lightMats));
 	}
 
 	void Level1::update()
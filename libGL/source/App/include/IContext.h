@@ -2,6 +2,7 @@
 #include <stdexcept>
 
 #include "Window.h"
+#include "Jobs/JobSystem.h"
 #include "Utility/Timer.h"
 
 namespace LibGL::Application
@@ -25,8 +26,9 @@ namespace LibGL::Application
 	class IContext
 	{
 	public:
-		std::unique_ptr<Window>			m_window;
-		std::unique_ptr<Utility::Timer>	m_timer;
+		std::unique_ptr<Window>				m_window;
+		std::unique_ptr<Utility::Timer>		m_timer;
+		std::unique_ptr<Jobs::JobSystem>	m_jobSystem;
 
 		/**
 		 * \brief Creates a GLFW window and initializes OpenGL with GLAD
@@ -62,7 +64,8 @@ namespace LibGL::Application
 		IContext& operator=(IContext&&) = delete;
 
 		/**
-		 * \brief The function to call to update the context's data
+		 * \brief The function to call to update the context's data.
+		 * Runs the main thread jobs scheduled since the last update
 		 */
 		virtual void update();
 
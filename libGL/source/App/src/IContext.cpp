@@ -28,7 +28,7 @@ namespace LibGL::Application
 
 	IContext::IContext(const int windowWidth, const int windowHeight, const char* title) :
 		m_window(std::make_unique<Window>(Window::dimensions_t(windowWidth, windowHeight), title)),
-		m_timer(std::make_unique<Timer>())
+		m_timer(std::make_unique<Timer>()), m_jobSystem(std::make_unique<Jobs::JobSystem>())
 	{
 		m_window->makeCurrentContext();
 
@@ -44,6 +44,7 @@ namespace LibGL::Application
 
 		ServiceLocator::provide<Timer>(*m_timer);
 		ServiceLocator::provide<Window>(*m_window);
+		ServiceLocator::provide<Jobs::JobSystem>(*m_jobSystem);
 	}
 
 	IContext::~IContext()
@@ -56,6 +57,7 @@ namespace LibGL::Application
 	{
 		m_timer->update();
 		glfwPollEvents();
+		m_jobSystem->runMainThreadJobs();
 	}
 
 	void IContext::bindDebugCallback()
@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace Bench
+{
+	// Number of threads the stress tests run at once - more than the cores of most machines, to force preemption
+	constexpr size_t g_threadCount = 4;
+
+	/**
+	 * \brief Checks that every index was delivered exactly once and prints the outcome of the given check
+	 * \param name The check's name
+	 * \param deliveries The number of times each index was delivered
+	 * \return True if every index was delivered once. False otherwise.
+	 */
+	inline bool reportDeliveries(const char* name, const std::vector<std::atomic<uint32_t>>& deliveries)
+	{
+		size_t lostCount = 0;
+		size_t duplicateCount = 0;
+
+		for (const std::atomic<uint32_t>& delivery : deliveries)
+		{
+			const uint32_t count = delivery.load(std::memory_order_relaxed);
+
+			lostCount += count == 0 ? 1 : 0;
+			duplicateCount += count > 1 ? 1 : 0;
+		}
+
+		const bool isValid = lostCount == 0 && duplicateCount == 0;
+		printf("%-32s %zu items, %zu lost, %zu duplicated: %s\n", name, deliveries.size(), lostCount, duplicateCount,
+			isValid ? "OK" : "FAILED");
+
+		return isValid;
+	}
+
+	/**
+	 * \brief Stresses the work stealing deque: its owner pushes and pops while several thieves steal,
+	 * starting from a tiny capacity so the buffer grows under contention
+	 * \return True if every pushed item was taken exactly once. False otherwise.
+	 */
+	bool checkWorkStealingDeque();
+
+	/**
+	 * \brief Runs parallel loops from within the ranges of another parallel loop
+	 * \return True if every index of every inner loop was processed exactly once. False otherwise.
+	 */
+	bool checkNestedParallelFor();
+}
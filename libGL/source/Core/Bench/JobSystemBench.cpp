@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Jobs/JobSystem.h"
+
+using namespace LibGL::Jobs;
+
+// Compares JobSystem::parallelFor with running the loop's ranges on std::async threads, and with a plain loop
+namespace
+{
+	constexpr size_t	g_outerCount = 64;
+	constexpr size_t	g_innerCount = 4096;
+	constexpr size_t	g_innerGrainSize = 64;
+	constexpr size_t	g_roundCount = 4;
+	constexpr size_t	g_grainSize = 4096;
+
+	/**
+	 * \brief Gets the job system shared by the benchmarks, with a worker per hardware thread besides the main one
+	 * \return The benchmarks' job system
+	 */
+	JobSystem& getJobSystem()
+	{
+		static JobSystem s_jobSystem;
+		return s_jobSystem;
+	}
+
+	/**
+	 * \brief Does a few arithmetic operations per value of the given range, as a light per-item update would
+	 * \param values The processed values
+	 * \param begin The range's first index
+	 * \param end The index after the range's last one
+	 */
+	void process(std::vector<float>& values, const size_t begin, const size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+			values[i] = std::sqrt(values[i] * values[i] + 1.f) * .5f;
+	}
+
+	void serialFor(benchmark::State& state)
+	{
+		std::vector<float> values(static_cast<size_t>(state.range(0)), 1.f);
+
+		for (auto _ : state)
+		{
+			process(values, 0, values.size());
+			benchmark::DoNotOptimize(values.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void jobSystemParallelFor(benchmark::State& state)
+	{
+		std::vector<float> values(static_cast<size_t>(state.range(0)), 1.f);
+		JobSystem& jobSystem = getJobSystem();
+
+		for (auto _ : state)
+		{
+			jobSystem.parallelFor(values.size(), g_grainSize, [&values](const size_t begin, const size_t end)
+			{
+				process(values, begin, end);
+			});
+
+			benchmark::DoNotOptimize(values.data());
+		}
+
+		state.counters["workers"] = static_cast<double>(jobSystem.getWorkerCount());
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void asyncParallelFor(benchmark::State& state)
+	{
+		std::vector<float> values(static_cast<size_t>(state.range(0)), 1.f);
+		std::vector<std::future<void>> futures;
+
+		for (auto _ : state)
+		{
+			// A thread per range, as a naive std::async loop would do
+			for (size_t begin = 0; begin < values.size(); begin += g_grainSize)
+			{
+				const size_t end = std::min(begin + g_grainSize, values.size());
+				futures.push_back(std::async(std::launch::async, process, std::ref(values), begin, end));
+			}
+
+			for (std::future<void>& future : futures)
+				future.get();
+
+			futures.clear();
+			benchmark::DoNotOptimize(values.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+
+bool Bench::checkNestedParallelFor()
+{
+	JobSystem jobSystem(g_threadCount - 1);
+	bool isValid = true;
+
+	for (size_t round = 0; round < g_roundCount; round++)
+	{
+		std::vector<std::atomic<uint32_t>> deliveries(g_outerCount * g_innerCount);
+
+		// The inner loops are run by workers, which schedule their ranges and run other jobs while waiting for them
+		jobSystem.parallelFor(g_outerCount, 1, [&jobSystem, &deliveries](const size_t begin, const size_t end)
+		{
+			for (size_t outer = begin; outer < end; outer++)
+			{
+				jobSystem.parallelFor(g_innerCount, g_innerGrainSize,
+					[&deliveries, outer](const size_t innerBegin, const size_t innerEnd)
+					{
+						for (size_t inner = innerBegin; inner < innerEnd; inner++)
+							deliveries[outer * g_innerCount + inner].fetch_add(1, std::memory_order_relaxed);
+					});
+			}
+		});
+
+		isValid &= reportDeliveries("Nested JobSystem::parallelFor", deliveries);
+	}
+
+	return isValid;
+}
+
+BENCHMARK(serialFor)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(jobSystemParallelFor)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(asyncParallelFor)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
@@ -0,0 +1,23 @@
+#include <cstdio>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+// Run with --benchmark_filter=<regex> to compare a subset, e.g. --benchmark_filter=ParallelFor
+int main(int argc, char** argv)
+{
+	bool isValid = Bench::checkWorkStealingDeque();
+	isValid &= Bench::checkNestedParallelFor();
+	printf("\n");
+
+	benchmark::Initialize(&argc, argv);
+
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return isValid ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Jobs/WorkStealingDeque.h"
+
+using namespace LibGL::Jobs;
+
+namespace
+{
+	constexpr uint32_t	g_itemCount = 1 << 18;
+	constexpr size_t	g_roundCount = 4;
+	constexpr uint32_t	g_popPeriod = 3;	// The owner pops once every few pushes, racing the thieves for the bottom items
+
+	/**
+	 * \brief Pushes every item into a new deque while the thieves steal, popping some of them, then empties the deque
+	 * \param deliveries Incremented at the index of each item taken out of the deque
+	 */
+	void stressDeque(std::vector<std::atomic<uint32_t>>& deliveries)
+	{
+		// Grows from the smallest capacity while the thieves read the outgrown buffers
+		WorkStealingDeque<uint32_t> deque(1);
+		std::atomic<bool> isDone = false;
+
+		const auto deliver = [&deliveries](const uint32_t item)
+		{
+			deliveries[item].fetch_add(1, std::memory_order_relaxed);
+		};
+
+		std::vector<std::thread> thieves;
+
+		for (size_t i = 1; i < Bench::g_threadCount; i++)
+		{
+			thieves.emplace_back([&deque, &isDone, &deliver]
+			{
+				while (!isDone.load(std::memory_order_acquire))
+				{
+					if (const std::optional<uint32_t> item = deque.steal())
+						deliver(*item);
+					else
+						std::this_thread::yield();
+				}
+			});
+		}
+
+		for (uint32_t item = 0; item < g_itemCount; item++)
+		{
+			deque.push(item);
+
+			if (item % g_popPeriod == 0)
+			{
+				if (const std::optional<uint32_t> popped = deque.pop())
+					deliver(*popped);
+			}
+		}
+
+		// Pop only fails once the deque is empty, a thief having taken the last item otherwise
+		while (const std::optional<uint32_t> item = deque.pop())
+			deliver(*item);
+
+		isDone.store(true, std::memory_order_release);
+
+		for (std::thread& thief : thieves)
+			thief.join();
+	}
+
+	void dequePushPop(benchmark::State& state)
+	{
+		const size_t count = static_cast<size_t>(state.range(0));
+		WorkStealingDeque<size_t> deque;
+
+		for (auto _ : state)
+		{
+			for (size_t item = 0; item < count; item++)
+				deque.push(item);
+
+			while (const std::optional<size_t> item = deque.pop())
+				benchmark::DoNotOptimize(*item);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void dequePushSteal(benchmark::State& state)
+	{
+		const size_t count = static_cast<size_t>(state.range(0));
+		WorkStealingDeque<size_t> deque;
+
+		for (auto _ : state)
+		{
+			for (size_t item = 0; item < count; item++)
+				deque.push(item);
+
+			while (const std::optional<size_t> item = deque.steal())
+				benchmark::DoNotOptimize(*item);
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+
+bool Bench::checkWorkStealingDeque()
+{
+	bool isValid = true;
+
+	for (size_t round = 0; round < g_roundCount; round++)
+	{
+		std::vector<std::atomic<uint32_t>> deliveries(g_itemCount);
+		stressDeque(deliveries);
+
+		isValid &= reportDeliveries("WorkStealingDeque push/pop/steal", deliveries);
+	}
+
+	return isValid;
+}
+
+BENCHMARK(dequePushPop)->Arg(256)->Arg(4096);
+BENCHMARK(dequePushSteal)->Arg(256)->Arg(4096);
@@ -3,9 +3,19 @@
 #include <vector>
 
 #include "Node.h"
+#include "Memory/Arena.h"
+#include "Memory/ArenaScope.h"
 
 namespace LibGL::DataStructure
 {
+	/**
+	 * \brief A forest of nodes owned by the graph.
+	 * The nodes, descendants and components created inside a load scope (see makeLoadScope) are allocated from the
+	 * graph's arena, which is rewound in O(1) once clear destroyed them. They must not outlive the graph's next clear.
+	 * The objects created later come from the object pools, so the ones spawned and destroyed while the graph lives
+	 * are reclaimed
+	 * \tparam NodeT The root nodes' base type
+	 */
 	template <class NodeT>
 	class Graph
 	{
@@ -13,11 +23,11 @@ namespace LibGL::DataStructure
 
 	public:
 		Graph() = default;
-		Graph(const Graph& other) = default;
+		Graph(const Graph& other) = delete;
 		Graph(Graph&& other) noexcept = default;
 		virtual ~Graph();
 
-		Graph& operator=(const Graph& other) = default;
+		Graph& operator=(const Graph& other) = delete;
 		Graph& operator=(Graph&& other) noexcept = default;
 
 		/**
@@ -42,6 +52,14 @@ namespace LibGL::DataStructure
 		 */
 		void removeNode(const NodeT& node);
 
+		/**
+		 * \brief Moves the given node and its descendants under the given parent, or to the graph's roots
+		 * \param node A node of the graph
+		 * \param parent The node's new parent. nullptr to make it a root
+		 * \throw std::invalid_argument if the parent is the node itself or one of its descendants
+		 */
+		void setParent(NodeT& node, Node* parent);
+
 		/**
 		 * \brief Gets the graph's root nodes list
 		 * \return The graph's root nodes list
@@ -55,12 +73,41 @@ namespace LibGL::DataStructure
 		std::vector<const NodeT*> getNodes() const;
 
 		/**
-		 * \brief Removes all nodes from the graph
+		 * \brief Gets a depth first traversal of the graph: each root followed by its descendants (see DepthFirstIterator)
+		 * \return A range over the graph's nodes
+		 */
+		NodeRange<DepthFirstIterator<NodeT>> depthFirst();
+
+		/**
+		 * \brief Gets a breadth first traversal of the graph: the roots, then their children, and so on
+		 * (see BreadthFirstIterator)
+		 * \return A range over the graph's nodes
+		 */
+		NodeRange<BreadthFirstIterator<NodeT>> breadthFirst();
+
+		/**
+		 * \brief Removes all nodes from the graph, then rewinds the graph's arena
 		 */
 		void clear();
 
+		/**
+		 * \brief Routes the current thread's node and component allocations to the graph's arena while the returned
+		 * scope is alive (see Memory::ArenaScope). Meant for load time construction only: the arena's memory is only
+		 * reclaimed on clear, even for the objects destroyed before
+		 * \return The scope, to keep alive while loading the graph
+		 */
+		[[nodiscard]] Memory::ArenaScope makeLoadScope();
+
+	protected:
+		/**
+		 * \brief The action to perform when a node is added to the graph, once it is constructed
+		 * \param node The added node
+		 */
+		virtual void onNodeAdded(NodeT& node);
+
 	private:
 		std::vector<NodeT*>	m_nodes;
+		Memory::Arena		m_arena;
 	};
 }
 
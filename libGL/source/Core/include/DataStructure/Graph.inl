@@ -1,4 +1,7 @@
 #pragma once
+#include <algorithm>
+#include <stdexcept>
+
 #include "Graph.h"
 
 namespace LibGL::DataStructure
@@ -16,6 +19,7 @@ namespace LibGL::DataStructure
 		static_assert(std::is_same_v<NodeT, DataT> || std::is_base_of_v<NodeT, DataT>);
 		const auto addedNode = new DataT(node);
 		m_nodes.push_back(addedNode);
+		onNodeAdded(*addedNode);
 		return *addedNode;
 	}
 
@@ -26,13 +30,14 @@ namespace LibGL::DataStructure
 		static_assert(std::is_same_v<NodeT, DataT> || std::is_base_of_v<NodeT, DataT>);
 		const auto addedNode = new DataT(args...);
 		m_nodes.push_back(addedNode);
+		onNodeAdded(*addedNode);
 		return *addedNode;
 	}
 
 	template <class NodeT>
 	void Graph<NodeT>::removeNode(const NodeT& node)
 	{
-		const auto nodeIter = std::find(m_nodes.begin(), m_nodes.end(), new NodeT(&node));
+		const auto nodeIter = std::ranges::find(m_nodes, &node);
 
 		if (nodeIter != m_nodes.end())
 		{
@@ -41,6 +46,26 @@ namespace LibGL::DataStructure
 		}
 	}
 
+	template <class NodeT>
+	void Graph<NodeT>::setParent(NodeT& node, Node* parent)
+	{
+		if (node.getParent() == parent && (parent != nullptr || std::ranges::find(m_nodes, &node) != m_nodes.end()))
+			return;
+
+		for (const Node* ancestor = parent; ancestor != nullptr; ancestor = ancestor->getParent())
+		{
+			if (ancestor == &node)
+				throw std::invalid_argument("A node can't be moved under itself");
+		}
+
+		std::erase(m_nodes, &node);
+
+		if (parent == nullptr)
+			m_nodes.push_back(&node);
+
+		static_cast<Node&>(node).setParent(parent);
+	}
+
 	template <class NodeT>
 	std::vector<NodeT*>& Graph<NodeT>::getNodes()
 	{
@@ -53,6 +78,18 @@ namespace LibGL::DataStructure
 		return std::vector<const NodeT*>(m_nodes.begin(), m_nodes.end());
 	}
 
+	template <class NodeT>
+	NodeRange<DepthFirstIterator<NodeT>> Graph<NodeT>::depthFirst()
+	{
+		return NodeRange(DepthFirstIterator<NodeT>(std::span<NodeT* const>(m_nodes)));
+	}
+
+	template <class NodeT>
+	NodeRange<BreadthFirstIterator<NodeT>> Graph<NodeT>::breadthFirst()
+	{
+		return NodeRange(BreadthFirstIterator<NodeT>(std::span<NodeT* const>(m_nodes)));
+	}
+
 	template <class NodeT>
 	void Graph<NodeT>::clear()
 	{
@@ -63,5 +100,18 @@ namespace LibGL::DataStructure
 
 			m_nodes.clear();
 		}
+
+		m_arena.reset();
+	}
+
+	template <class NodeT>
+	Memory::ArenaScope Graph<NodeT>::makeLoadScope()
+	{
+		return Memory::ArenaScope(&m_arena);
+	}
+
+	template <class NodeT>
+	void Graph<NodeT>::onNodeAdded(NodeT&)
+	{
 	}
 }
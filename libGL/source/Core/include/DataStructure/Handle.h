@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+namespace LibGL::DataStructure
+{
+	/**
+	 * \brief Weak reference to an object kept in a slot map (see SlotMap): the index of the object's slot
+	 * and the slot's generation when the object was inserted. Once the object is erased, the slot's generation changes
+	 * and the handle no longer resolves, even if the slot is reused
+	 * \tparam T The referenced object type, only used to tell handles of different types apart
+	 */
+	template <typename T>
+	struct Handle
+	{
+		static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+		uint32_t	m_index = INVALID_INDEX;
+		uint32_t	m_generation = 0;
+
+		/**
+		 * \brief Checks whether the handle was never assigned an object
+		 * \return True if the handle is the default handle. False otherwise.
+		 */
+		bool isNull() const
+		{
+			return m_index == INVALID_INDEX;
+		}
+
+		bool operator==(const Handle& other) const = default;
+	};
+}
+
+template <typename T>
+struct std::hash<LibGL::DataStructure::Handle<T>>
+{
+	size_t operator()(const LibGL::DataStructure::Handle<T>& handle) const noexcept
+	{
+		return std::hash<uint64_t>()(static_cast<uint64_t>(handle.m_generation) << 32 | handle.m_index);
+	}
+};
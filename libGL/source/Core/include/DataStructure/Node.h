@@ -1,14 +1,35 @@
 #pragma once
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "SmallVector.h"
 
 namespace LibGL::DataStructure
 {
+	template <class NodeT>
+	class Graph;
+
+	template <class NodeT>
+	class NodeIterator;
+
+	template <class NodeT>
+	class DepthFirstIterator;
+
+	template <class NodeT>
+	class BreadthFirstIterator;
+
+	template <class IteratorT>
+	class NodeRange;
+
 	class Node
 	{
 	public:
+		static constexpr size_t INLINE_CHILDREN = 4;	// Number of children stored in the node itself
+
 		typedef uint64_t NodeId;
 		typedef Node* NodePtr;
-		typedef std::vector<NodePtr> NodeList;
+		typedef SmallVector<NodePtr, INLINE_CHILDREN> NodeList;
 
 		Node(const Node& other);
 		Node(Node&& other) noexcept;
@@ -20,6 +41,20 @@ namespace LibGL::DataStructure
 		bool operator==(const Node& other) const;
 		bool operator!=(const Node& other) const;
 
+		/**
+		 * \brief Allocates a node from the object pools, or from the current arena (see Memory::ObjectAllocator)
+		 * \param size The node's size
+		 * \return A pointer to the node's memory
+		 */
+		static void* operator new(size_t size);
+
+		/**
+		 * \brief Gives the given node's memory back to its pool
+		 * \param node A pointer to the node's memory
+		 * \param size The node's size
+		 */
+		static void operator delete(void* node, size_t size);
+
 		/**
 		 * \brief Gets the node's parent
 		 * \return A pointer to the node's parent
@@ -34,9 +69,21 @@ namespace LibGL::DataStructure
 
 		/**
 		 * \brief Gets the node's children
-		 * \return The node's children
+		 * \return A view over the node's children, invalidated when a child is added or removed
 		 */
-		std::vector<NodePtr> getChildren();
+		std::span<const NodePtr> getChildren() const;
+
+		/**
+		 * \brief Gets a depth first traversal of the node and its descendants (see DepthFirstIterator)
+		 * \return A range over the node and its descendants
+		 */
+		NodeRange<DepthFirstIterator<Node>> depthFirst();
+
+		/**
+		 * \brief Gets a breadth first traversal of the node and its descendants (see BreadthFirstIterator)
+		 * \return A range over the node and its descendants
+		 */
+		NodeRange<BreadthFirstIterator<Node>> breadthFirst();
 
 		/**
 		 * \brief Adds the given node as a child of the current node
@@ -55,7 +102,8 @@ namespace LibGL::DataStructure
 		DataT& addChild(Args&&... args);
 
 		/**
-		 * \brief Removes the given node from this node's children
+		 * \brief Removes the given node from this node's children in constant time, and destroys it.
+		 * The last child takes the removed child's place
 		 * \param child A pointer to the child to remove from the node's children
 		 */
 		virtual void removeChild(Node& child);
@@ -64,13 +112,45 @@ namespace LibGL::DataStructure
 		Node();
 		explicit Node(Node* parent);
 
+		/**
+		 * \brief The action to perform once the node was moved to another parent (see Graph::setParent)
+		 */
+		virtual void onParentChange() {}
+
 	private:
+		template <class NodeT>
+		friend class Graph;
+
+		template <class NodeT>
+		friend class NodeIterator;
+
 		inline static NodeId	s_currentId = 1;
 
 		Node*					m_parent = nullptr;
 		NodeList				m_children;
+		size_t					m_childIndex = 0;	// The node's position in its parent's children
 		NodeId					m_id = 0;
+
+		/**
+		 * \brief Appends the given newly created node to the node's children
+		 * \param child The child to append
+		 */
+		void attachChild(Node& child);
+
+		/**
+		 * \brief Removes the given node from the node's children without destroying it
+		 * \param child The child to remove
+		 * \return True if the node was one of the children. False otherwise.
+		 */
+		bool detachChild(Node& child);
+
+		/**
+		 * \brief Moves the node to the given parent's children, without changing the graph's roots
+		 * \param parent The node's new parent. nullptr to only detach it from its current parent
+		 */
+		void setParent(Node* parent);
 	};
 }
 
 #include "Node.inl"
+#include "NodeIterator.h"
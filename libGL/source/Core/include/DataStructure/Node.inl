@@ -8,7 +8,7 @@ namespace LibGL::DataStructure
 	{
 		static_assert(std::is_same_v<Node, DataT> || std::is_base_of_v<Node, DataT>);
 		const auto addedNode = new DataT(child);
-		m_children.push_back(addedNode);
+		attachChild(*addedNode);
 		return *addedNode;
 	}
 
@@ -17,7 +17,7 @@ namespace LibGL::DataStructure
 	{
 		static_assert(std::is_same_v<Node, DataT> || std::is_base_of_v<Node, DataT>);
 		const auto addedNode = new DataT(this, args...);
-		m_children.push_back(addedNode);
+		attachChild(*addedNode);
 		return *addedNode;
 	}
 }
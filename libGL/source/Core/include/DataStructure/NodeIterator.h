@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+#include "Node.h"
+
+namespace LibGL::DataStructure
+{
+	/**
+	 * \brief Walks over node trees without recursion nor allocation, through the nodes' parents and child indices.
+	 * Iterates either over a single subtree or over a forest (a graph's roots and their descendants).
+	 * The descendants of the roots are assumed to be NodeT as well. Invalidated by structural changes to the trees
+	 * \tparam NodeT The iterated nodes' type
+	 */
+	template <class NodeT>
+	class NodeIterator
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef NodeT value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef NodeT* pointer;
+		typedef NodeT& reference;
+
+		NodeT& operator*() const;
+		NodeT* operator->() const;
+
+		bool operator==(const NodeIterator& other) const;
+
+		/**
+		 * \brief Gets the depth of the current node relative to its tree's root
+		 * \return The current node's depth
+		 */
+		size_t getDepth() const;
+
+	protected:
+		std::span<NodeT* const>	m_roots;			// The forest's roots. Empty when iterating over a subtree
+		NodeT*					m_subtreeRoot = nullptr;
+		size_t					m_rootIndex = 0;
+		Node*					m_current = nullptr;
+		size_t					m_depth = 0;
+
+		NodeIterator() = default;
+
+		/**
+		 * \brief Creates an iterator over the given node and its descendants
+		 * \param root The subtree's root
+		 */
+		explicit NodeIterator(NodeT* root);
+
+		/**
+		 * \brief Creates an iterator over the given roots and their descendants
+		 * \param roots The forest's roots
+		 */
+		explicit NodeIterator(std::span<NodeT* const> roots);
+
+		/**
+		 * \brief Gets the root of the given index
+		 * \param index The root's index
+		 * \return A pointer to the root. nullptr past the last root
+		 */
+		Node* getRoot(size_t index) const;
+
+		/**
+		 * \brief Moves to the next node in depth first order, skipping the nodes deeper than the given depth
+		 * \param maxDepth The maximum depth of the nodes to visit
+		 */
+		void advance(size_t maxDepth);
+	};
+
+	/**
+	 * \brief Visits the nodes in depth first pre-order: each node before its children
+	 * \tparam NodeT The iterated nodes' type
+	 */
+	template <class NodeT>
+	class DepthFirstIterator : public NodeIterator<NodeT>
+	{
+	public:
+		DepthFirstIterator() = default;
+		explicit DepthFirstIterator(NodeT* root);
+		explicit DepthFirstIterator(std::span<NodeT* const> roots);
+
+		DepthFirstIterator& operator++();
+		DepthFirstIterator operator++(int);
+	};
+
+	/**
+	 * \brief Visits the nodes level by level: the roots, then their children, and so on.
+	 * Each level walks down from the roots again, which makes a full traversal O(node count x depth)
+	 * \tparam NodeT The iterated nodes' type
+	 */
+	template <class NodeT>
+	class BreadthFirstIterator : public NodeIterator<NodeT>
+	{
+	public:
+		BreadthFirstIterator() = default;
+		explicit BreadthFirstIterator(NodeT* root);
+		explicit BreadthFirstIterator(std::span<NodeT* const> roots);
+
+		BreadthFirstIterator& operator++();
+		BreadthFirstIterator operator++(int);
+	};
+
+	/**
+	 * \brief A traversal of node trees usable in range-based for loops
+	 * \tparam IteratorT The traversal's iterator type
+	 */
+	template <class IteratorT>
+	class NodeRange
+	{
+	public:
+		explicit NodeRange(IteratorT begin);
+
+		IteratorT begin() const;
+		IteratorT end() const;
+
+	private:
+		IteratorT	m_begin;
+	};
+}
+
+#include "NodeIterator.inl"
@@ -0,0 +1,164 @@
+#pragma once
+#include "NodeIterator.h"
+
+namespace LibGL::DataStructure
+{
+	template <class NodeT>
+	NodeIterator<NodeT>::NodeIterator(NodeT* root) :
+		m_subtreeRoot(root), m_current(root)
+	{
+	}
+
+	template <class NodeT>
+	NodeIterator<NodeT>::NodeIterator(const std::span<NodeT* const> roots) :
+		m_roots(roots), m_current(getRoot(0))
+	{
+	}
+
+	template <class NodeT>
+	NodeT& NodeIterator<NodeT>::operator*() const
+	{
+		return *static_cast<NodeT*>(m_current);
+	}
+
+	template <class NodeT>
+	NodeT* NodeIterator<NodeT>::operator->() const
+	{
+		return static_cast<NodeT*>(m_current);
+	}
+
+	template <class NodeT>
+	bool NodeIterator<NodeT>::operator==(const NodeIterator& other) const
+	{
+		return m_current == other.m_current;
+	}
+
+	template <class NodeT>
+	size_t NodeIterator<NodeT>::getDepth() const
+	{
+		return m_depth;
+	}
+
+	template <class NodeT>
+	Node* NodeIterator<NodeT>::getRoot(const size_t index) const
+	{
+		if (m_subtreeRoot != nullptr)
+			return index == 0 ? m_subtreeRoot : nullptr;
+
+		return index < m_roots.size() ? m_roots[index] : nullptr;
+	}
+
+	template <class NodeT>
+	void NodeIterator<NodeT>::advance(const size_t maxDepth)
+	{
+		if (m_depth < maxDepth && !m_current->m_children.isEmpty())
+		{
+			m_current = m_current->m_children[0];
+			m_depth++;
+			return;
+		}
+
+		// Climbs up to the first ancestor with a next sibling
+		for (Node* node = m_current; node != getRoot(m_rootIndex); node = node->m_parent, m_depth--)
+		{
+			const Node::NodeList& siblings = node->m_parent->m_children;
+
+			if (node->m_childIndex + 1 < siblings.getSize())
+			{
+				m_current = siblings[node->m_childIndex + 1];
+				return;
+			}
+		}
+
+		m_current = getRoot(++m_rootIndex);
+		m_depth = 0;
+	}
+
+	template <class NodeT>
+	DepthFirstIterator<NodeT>::DepthFirstIterator(NodeT* root) :
+		NodeIterator<NodeT>(root)
+	{
+	}
+
+	template <class NodeT>
+	DepthFirstIterator<NodeT>::DepthFirstIterator(const std::span<NodeT* const> roots) :
+		NodeIterator<NodeT>(roots)
+	{
+	}
+
+	template <class NodeT>
+	DepthFirstIterator<NodeT>& DepthFirstIterator<NodeT>::operator++()
+	{
+		this->advance(SIZE_MAX);
+		return *this;
+	}
+
+	template <class NodeT>
+	DepthFirstIterator<NodeT> DepthFirstIterator<NodeT>::operator++(int)
+	{
+		DepthFirstIterator copy = *this;
+		++*this;
+		return copy;
+	}
+
+	template <class NodeT>
+	BreadthFirstIterator<NodeT>::BreadthFirstIterator(NodeT* root) :
+		NodeIterator<NodeT>(root)
+	{
+	}
+
+	template <class NodeT>
+	BreadthFirstIterator<NodeT>::BreadthFirstIterator(const std::span<NodeT* const> roots) :
+		NodeIterator<NodeT>(roots)
+	{
+	}
+
+	template <class NodeT>
+	BreadthFirstIterator<NodeT>& BreadthFirstIterator<NodeT>::operator++()
+	{
+		const size_t depth = this->m_depth;
+
+		do
+			this->advance(depth);
+		while (this->m_current != nullptr && this->m_depth != depth);
+
+		if (this->m_current != nullptr)
+			return *this;
+
+		// Walks down from the first root to the next level's first node, if any
+		this->m_rootIndex = 0;
+		this->m_current = this->getRoot(0);
+		this->m_depth = 0;
+
+		while (this->m_current != nullptr && this->m_depth != depth + 1)
+			this->advance(depth + 1);
+
+		return *this;
+	}
+
+	template <class NodeT>
+	BreadthFirstIterator<NodeT> BreadthFirstIterator<NodeT>::operator++(int)
+	{
+		BreadthFirstIterator copy = *this;
+		++*this;
+		return copy;
+	}
+
+	template <class IteratorT>
+	NodeRange<IteratorT>::NodeRange(IteratorT begin) :
+		m_begin(begin)
+	{
+	}
+
+	template <class IteratorT>
+	IteratorT NodeRange<IteratorT>::begin() const
+	{
+		return m_begin;
+	}
+
+	template <class IteratorT>
+	IteratorT NodeRange<IteratorT>::end() const
+	{
+		return IteratorT();
+	}
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Handle.h"
+
+namespace LibGL::DataStructure
+{
+	/**
+	 * \brief Densely packed values addressed through generational handles.
+	 * Insertion, erasure and lookup are O(1): handles point to a slot holding the value's current position,
+	 * so values can move (erasure swaps the last value into the hole) without invalidating the handles.
+	 * Looking up the handle of an erased value returns nullptr, even if its slot was reused
+	 * \tparam T The stored value type
+	 * \tparam Tag The type the handles refer to. Defaults to the value type
+	 */
+	template <typename T, typename Tag = T>
+	class SlotMap
+	{
+	public:
+		typedef Handle<Tag> HandleT;
+
+		/**
+		 * \brief Adds the given value to the map
+		 * \param value The value to add
+		 * \return The value's handle
+		 * \throw std::length_error if the map has no index left
+		 */
+		HandleT insert(T value);
+
+		/**
+		 * \brief Removes the value referred to by the given handle
+		 * \param handle The value's handle
+		 * \return True if the value was removed. False if the handle is stale or null
+		 */
+		bool erase(HandleT handle);
+
+		/**
+		 * \brief Removes every value. Every handle issued so far becomes stale
+		 */
+		void clear();
+
+		/**
+		 * \brief Gets the value referred to by the given handle
+		 * \param handle The value's handle
+		 * \return A pointer to the value, valid until the next insertion or erasure. nullptr if the handle is stale or null
+		 */
+		T* find(HandleT handle);
+
+		/**
+		 * \brief Gets the value referred to by the given handle
+		 * \param handle The value's handle
+		 * \return A pointer to the value, valid until the next insertion or erasure. nullptr if the handle is stale or null
+		 */
+		const T* find(HandleT handle) const;
+
+		/**
+		 * \brief Checks whether the given handle refers to a value of the map
+		 * \param handle The handle to check
+		 * \return True if the handle resolves. False if it is stale or null
+		 */
+		bool contains(HandleT handle) const;
+
+		/**
+		 * \brief Gets the handle of the value at the given position in the values array
+		 * \param index The value's position (see getValues)
+		 * \return The value's handle
+		 */
+		HandleT getHandle(size_t index) const;
+
+		/**
+		 * \brief Gets the map's values, in no particular order
+		 * \return A view over the map's values, invalidated by the next insertion or erasure
+		 */
+		std::span<T> getValues();
+
+		/**
+		 * \brief Gets the map's values, in no particular order
+		 * \return A view over the map's values, invalidated by the next insertion or erasure
+		 */
+		std::span<const T> getValues() const;
+
+		/**
+		 * \brief Gets the number of values in the map
+		 * \return The map's size
+		 */
+		size_t getSize() const;
+
+		/**
+		 * \brief Reserves memory for the given number of values
+		 * \param capacity The number of values to make room for
+		 */
+		void reserve(size_t capacity);
+
+	private:
+		static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+		/**
+		 * \brief Indirection from a handle's index to its value's position
+		 */
+		struct Slot
+		{
+			uint32_t	m_valueIndex;		// The next free slot's index while the slot is free
+			uint32_t	m_generation = 1;	// Incremented on erasure, 0 is never used
+		};
+
+		std::vector<T>			m_values;
+		std::vector<uint32_t>	m_valueSlots;	// The slot of each value
+		std::vector<Slot>		m_slots;
+		uint32_t				m_freeSlot = NO_SLOT;
+	};
+}
+
+#include "SlotMap.inl"
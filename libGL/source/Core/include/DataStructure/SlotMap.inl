@@ -0,0 +1,134 @@
+#pragma once
+#include <stdexcept>
+#include <utility>
+
+#include "SlotMap.h"
+
+namespace LibGL::DataStructure
+{
+	template <typename T, typename Tag>
+	typename SlotMap<T, Tag>::HandleT SlotMap<T, Tag>::insert(T value)
+	{
+		uint32_t slotIndex = m_freeSlot;
+
+		if (slotIndex == NO_SLOT)
+		{
+			if (m_slots.size() >= HandleT::INVALID_INDEX)
+				throw std::length_error("Too many values in the slot map");
+
+			slotIndex = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back();
+		}
+		else
+		{
+			m_freeSlot = m_slots[slotIndex].m_valueIndex;
+		}
+
+		Slot& slot = m_slots[slotIndex];
+		slot.m_valueIndex = static_cast<uint32_t>(m_values.size());
+
+		m_values.push_back(std::move(value));
+		m_valueSlots.push_back(slotIndex);
+
+		return { slotIndex, slot.m_generation };
+	}
+
+	template <typename T, typename Tag>
+	bool SlotMap<T, Tag>::erase(const HandleT handle)
+	{
+		if (!contains(handle))
+			return false;
+
+		Slot& slot = m_slots[handle.m_index];
+		const uint32_t valueIndex = slot.m_valueIndex;
+
+		// Fills the hole with the last value
+		if (valueIndex + 1 != m_values.size())
+		{
+			m_values[valueIndex] = std::move(m_values.back());
+			m_valueSlots[valueIndex] = m_valueSlots.back();
+			m_slots[m_valueSlots[valueIndex]].m_valueIndex = valueIndex;
+		}
+
+		m_values.pop_back();
+		m_valueSlots.pop_back();
+
+		if (++slot.m_generation == 0)
+			slot.m_generation = 1;
+
+		slot.m_valueIndex = m_freeSlot;
+		m_freeSlot = handle.m_index;
+
+		return true;
+	}
+
+	template <typename T, typename Tag>
+	void SlotMap<T, Tag>::clear()
+	{
+		for (const uint32_t slotIndex : m_valueSlots)
+		{
+			Slot& slot = m_slots[slotIndex];
+
+			if (++slot.m_generation == 0)
+				slot.m_generation = 1;
+
+			slot.m_valueIndex = m_freeSlot;
+			m_freeSlot = slotIndex;
+		}
+
+		m_values.clear();
+		m_valueSlots.clear();
+	}
+
+	template <typename T, typename Tag>
+	T* SlotMap<T, Tag>::find(const HandleT handle)
+	{
+		return contains(handle) ? &m_values[m_slots[handle.m_index].m_valueIndex] : nullptr;
+	}
+
+	template <typename T, typename Tag>
+	const T* SlotMap<T, Tag>::find(const HandleT handle) const
+	{
+		return contains(handle) ? &m_values[m_slots[handle.m_index].m_valueIndex] : nullptr;
+	}
+
+	template <typename T, typename Tag>
+	bool SlotMap<T, Tag>::contains(const HandleT handle) const
+	{
+		// Free slots are a generation ahead of the handles of their last value
+		return handle.m_index < m_slots.size() && m_slots[handle.m_index].m_generation == handle.m_generation;
+	}
+
+	template <typename T, typename Tag>
+	typename SlotMap<T, Tag>::HandleT SlotMap<T, Tag>::getHandle(const size_t index) const
+	{
+		const uint32_t slotIndex = m_valueSlots[index];
+		return { slotIndex, m_slots[slotIndex].m_generation };
+	}
+
+	template <typename T, typename Tag>
+	std::span<T> SlotMap<T, Tag>::getValues()
+	{
+		return m_values;
+	}
+
+	template <typename T, typename Tag>
+	std::span<const T> SlotMap<T, Tag>::getValues() const
+	{
+		return m_values;
+	}
+
+	template <typename T, typename Tag>
+	size_t SlotMap<T, Tag>::getSize() const
+	{
+		return m_values.size();
+	}
+
+	template <typename T, typename Tag>
+	void SlotMap<T, Tag>::reserve(const size_t capacity)
+	{
+		m_values.reserve(capacity);
+		m_valueSlots.reserve(capacity);
+		m_slots.reserve(capacity);
+	}
+}
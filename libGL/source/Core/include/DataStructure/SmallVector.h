@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace LibGL::DataStructure
+{
+	/**
+	 * \brief Contiguous array keeping up to N values inline, only allocating once it grows past them.
+	 * Limited to trivially copyable values (pointers, handles...), which are moved around as raw bytes
+	 * \tparam T The stored value type
+	 * \tparam N The number of values stored inline
+	 */
+	template <typename T, size_t N>
+	class SmallVector
+	{
+		static_assert(std::is_trivially_copyable_v<T> && alignof(T) <= alignof(std::max_align_t));
+		static_assert(N > 0);
+
+	public:
+		SmallVector() = default;
+		SmallVector(const SmallVector& other);
+		SmallVector(SmallVector&& other) noexcept;
+		~SmallVector();
+
+		SmallVector& operator=(const SmallVector& other);
+		SmallVector& operator=(SmallVector&& other) noexcept;
+
+		T& operator[](size_t index);
+		const T& operator[](size_t index) const;
+
+		/**
+		 * \brief Adds the given value at the end of the array, moving the values to the heap if the capacity is reached
+		 * \param value The value to add
+		 */
+		void pushBack(const T& value);
+
+		/**
+		 * \brief Removes the array's last value. The array must not be empty
+		 */
+		void popBack();
+
+		/**
+		 * \brief Gets the array's last value. The array must not be empty
+		 * \return A reference to the last value
+		 */
+		T& back();
+
+		/**
+		 * \brief Gets the array's last value. The array must not be empty
+		 * \return A reference to the last value
+		 */
+		const T& back() const;
+
+		/**
+		 * \brief Removes every value, keeping the capacity
+		 */
+		void clear();
+
+		/**
+		 * \brief Makes room for the given number of values
+		 * \param capacity The number of values to make room for
+		 */
+		void reserve(size_t capacity);
+
+		/**
+		 * \brief Gets the number of values in the array
+		 * \return The array's size
+		 */
+		size_t getSize() const;
+
+		/**
+		 * \brief Gets the number of values the array can hold without allocating
+		 * \return The array's capacity
+		 */
+		size_t getCapacity() const;
+
+		/**
+		 * \brief Checks whether the array has no value
+		 * \return True if the array is empty. False otherwise.
+		 */
+		bool isEmpty() const;
+
+		/**
+		 * \brief Gets a view over the array's values
+		 * \return A view over the values, invalidated by the next insertion
+		 */
+		std::span<T> getValues();
+
+		/**
+		 * \brief Gets a view over the array's values
+		 * \return A view over the values, invalidated by the next insertion
+		 */
+		std::span<const T> getValues() const;
+
+		T* begin();
+		T* end();
+		const T* begin() const;
+		const T* end() const;
+
+	private:
+		alignas(T) std::byte	m_inlineValues[N * sizeof(T)];
+		T*						m_values = reinterpret_cast<T*>(m_inlineValues);
+		size_t					m_size = 0;
+		size_t					m_capacity = N;
+
+		/**
+		 * \brief Checks whether the values are stored inline
+		 * \return True if the array hasn't moved its values to the heap. False otherwise.
+		 */
+		bool isInline() const;
+
+		/**
+		 * \brief Gives the heap allocated values back, returning to the inline storage
+		 */
+		void releaseHeapValues();
+	};
+}
+
+#include "SmallVector.inl"
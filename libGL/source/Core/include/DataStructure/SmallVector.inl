@@ -0,0 +1,210 @@
+#pragma once
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "SmallVector.h"
+
+namespace LibGL::DataStructure
+{
+	template <typename T, size_t N>
+	SmallVector<T, N>::SmallVector(const SmallVector& other)
+	{
+		*this = other;
+	}
+
+	template <typename T, size_t N>
+	SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept
+	{
+		*this = std::move(other);
+	}
+
+	template <typename T, size_t N>
+	SmallVector<T, N>::~SmallVector()
+	{
+		releaseHeapValues();
+	}
+
+	template <typename T, size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other)
+	{
+		if (&other == this)
+			return *this;
+
+		m_size = 0;
+		reserve(other.m_size);
+
+		if (other.m_size != 0)
+			std::memcpy(m_values, other.m_values, other.m_size * sizeof(T));
+
+		m_size = other.m_size;
+
+		return *this;
+	}
+
+	template <typename T, size_t N>
+	SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept
+	{
+		if (&other == this)
+			return *this;
+
+		releaseHeapValues();
+
+		if (other.isInline())
+		{
+			if (other.m_size != 0)
+				std::memcpy(m_values, other.m_values, other.m_size * sizeof(T));
+		}
+		else
+		{
+			// Takes over the heap allocated values
+			m_values = std::exchange(other.m_values, reinterpret_cast<T*>(other.m_inlineValues));
+			m_capacity = std::exchange(other.m_capacity, N);
+		}
+
+		m_size = std::exchange(other.m_size, 0);
+
+		return *this;
+	}
+
+	template <typename T, size_t N>
+	T& SmallVector<T, N>::operator[](const size_t index)
+	{
+		return m_values[index];
+	}
+
+	template <typename T, size_t N>
+	const T& SmallVector<T, N>::operator[](const size_t index) const
+	{
+		return m_values[index];
+	}
+
+	template <typename T, size_t N>
+	void SmallVector<T, N>::pushBack(const T& value)
+	{
+		if (m_size == m_capacity)
+		{
+			// The value may live in the array
+			const T copy = value;
+			reserve(m_capacity * 2);
+			m_values[m_size++] = copy;
+			return;
+		}
+
+		m_values[m_size++] = value;
+	}
+
+	template <typename T, size_t N>
+	void SmallVector<T, N>::popBack()
+	{
+		m_size--;
+	}
+
+	template <typename T, size_t N>
+	T& SmallVector<T, N>::back()
+	{
+		return m_values[m_size - 1];
+	}
+
+	template <typename T, size_t N>
+	const T& SmallVector<T, N>::back() const
+	{
+		return m_values[m_size - 1];
+	}
+
+	template <typename T, size_t N>
+	void SmallVector<T, N>::clear()
+	{
+		m_size = 0;
+	}
+
+	template <typename T, size_t N>
+	void SmallVector<T, N>::reserve(const size_t capacity)
+	{
+		if (capacity <= m_capacity)
+			return;
+
+		T* values = static_cast<T*>(::operator new(capacity * sizeof(T)));
+
+		if (m_size != 0)
+			std::memcpy(values, m_values, m_size * sizeof(T));
+
+		const size_t size = m_size;
+		releaseHeapValues();
+
+		m_values = values;
+		m_size = size;
+		m_capacity = capacity;
+	}
+
+	template <typename T, size_t N>
+	size_t SmallVector<T, N>::getSize() const
+	{
+		return m_size;
+	}
+
+	template <typename T, size_t N>
+	size_t SmallVector<T, N>::getCapacity() const
+	{
+		return m_capacity;
+	}
+
+	template <typename T, size_t N>
+	bool SmallVector<T, N>::isEmpty() const
+	{
+		return m_size == 0;
+	}
+
+	template <typename T, size_t N>
+	std::span<T> SmallVector<T, N>::getValues()
+	{
+		return { m_values, m_size };
+	}
+
+	template <typename T, size_t N>
+	std::span<const T> SmallVector<T, N>::getValues() const
+	{
+		return { m_values, m_size };
+	}
+
+	template <typename T, size_t N>
+	T* SmallVector<T, N>::begin()
+	{
+		return m_values;
+	}
+
+	template <typename T, size_t N>
+	T* SmallVector<T, N>::end()
+	{
+		return m_values + m_size;
+	}
+
+	template <typename T, size_t N>
+	const T* SmallVector<T, N>::begin() const
+	{
+		return m_values;
+	}
+
+	template <typename T, size_t N>
+	const T* SmallVector<T, N>::end() const
+	{
+		return m_values + m_size;
+	}
+
+	template <typename T, size_t N>
+	bool SmallVector<T, N>::isInline() const
+	{
+		return m_values == reinterpret_cast<const T*>(m_inlineValues);
+	}
+
+	template <typename T, size_t N>
+	void SmallVector<T, N>::releaseHeapValues()
+	{
+		if (!isInline())
+			::operator delete(m_values);
+
+		m_values = reinterpret_cast<T*>(m_inlineValues);
+		m_size = 0;
+		m_capacity = N;
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace LibGL::Jobs
+{
+	/**
+	 * \brief The threads allowed to run a job
+	 */
+	enum class EJobAffinity
+	{
+		ANY,			// Any worker, or the main thread while it waits
+		MAIN_THREAD		// Only the main thread (e.g. jobs making GL calls), see JobSystem::runMainThreadJobs
+	};
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace LibGL::Jobs
+{
+	struct Job;
+
+	/**
+	 * \brief Counts the unfinished jobs of a batch (see JobSystem::schedule).
+	 * Jobs can be scheduled to start once a counter reaches zero (see JobSystem::scheduleAfter).
+	 * A counter must be waited for (see JobSystem::wait) before being destroyed or reused
+	 */
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter& other) = delete;
+		JobCounter(JobCounter&& other) = delete;
+		~JobCounter() = default;
+
+		JobCounter& operator=(const JobCounter& other) = delete;
+		JobCounter& operator=(JobCounter&& other) = delete;
+
+		/**
+		 * \brief Checks whether every job counted so far is done
+		 * \return True if the counter reached zero. False otherwise.
+		 */
+		bool isDone() const;
+
+		/**
+		 * \brief Gets the number of counted jobs which aren't done yet
+		 * \return The counter's value
+		 */
+		uint32_t getPendingJobs() const;
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<uint32_t>	m_pendingJobs = 0;
+		std::mutex				m_mutex;			// Guards the continuations and the exception
+		std::vector<Job*>		m_continuations;	// Jobs to schedule once the counter reaches zero
+		std::exception_ptr		m_exception;		// The first exception thrown by a counted job
+	};
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Jobs/EJobAffinity.h"
+#include "Jobs/JobCounter.h"
+#include "Jobs/WorkStealingDeque.h"
+
+namespace LibGL::Jobs
+{
+	/**
+	 * \brief A scheduled function, with the counter it decrements once done
+	 */
+	struct Job
+	{
+		std::function<void()>	m_func;
+		JobCounter*				m_counter;
+		EJobAffinity			m_affinity;
+	};
+
+	/**
+	 * \brief Work stealing job system. Each worker and the main thread (the one creating the system)
+	 * have their own deque: jobs scheduled by a thread go to its deque, and idle threads steal from the others.
+	 * Jobs scheduled from other threads go through a shared queue.
+	 * Waiting for a counter runs jobs instead of blocking, so jobs can wait for other jobs
+	 */
+	class JobSystem
+	{
+	public:
+		typedef std::function<void()> JobFunc;
+		typedef std::function<void(size_t begin, size_t end)> RangeFunc;
+
+		static constexpr uint32_t IDLE_SPIN_COUNT = 64;	// Failed job searches before a worker goes to sleep
+
+		/**
+		 * \brief Creates a job system with one worker per hardware thread besides the main one
+		 */
+		JobSystem();
+
+		/**
+		 * \brief Creates a job system with the given number of workers
+		 * \param workerCount The number of worker threads. 0 to run every job on the main thread while it waits
+		 * \param pinWorkers Whether each worker should be pinned to its own core (the main thread keeps the first one)
+		 */
+		explicit JobSystem(size_t workerCount, bool pinWorkers = false);
+
+		JobSystem(const JobSystem& other) = delete;
+		JobSystem(JobSystem&& other) = delete;
+
+		/**
+		 * \brief Stops and joins the workers. The jobs which didn't start yet are discarded
+		 */
+		~JobSystem();
+
+		JobSystem& operator=(const JobSystem& other) = delete;
+		JobSystem& operator=(JobSystem&& other) = delete;
+
+		/**
+		 * \brief Schedules the given job
+		 * \param job The function to run
+		 * \param counter The counter to increment until the job is done. Jobs without counter must not throw
+		 * \param affinity The threads allowed to run the job
+		 */
+		void schedule(JobFunc job, JobCounter* counter = nullptr, EJobAffinity affinity = EJobAffinity::ANY);
+
+		/**
+		 * \brief Schedules the given job once every job counted by the given dependency is done
+		 * \param dependency The counter to wait for
+		 * \param job The function to run
+		 * \param counter The counter to increment until the job is done. Jobs without counter must not throw
+		 * \param affinity The threads allowed to run the job
+		 */
+		void scheduleAfter(JobCounter& dependency, JobFunc job, JobCounter* counter = nullptr,
+			EJobAffinity affinity = EJobAffinity::ANY);
+
+		/**
+		 * \brief Runs jobs until every job counted by the given counter is done.
+		 * On the main thread, this includes the main thread jobs
+		 * \param counter The counter to wait for
+		 * \throw The first exception thrown by a counted job
+		 */
+		void wait(JobCounter& counter);
+
+		/**
+		 * \brief Calls the given function on ranges of at most grainSize indices covering [0, count),
+		 * on the workers and the calling thread, and waits for all of them to return
+		 * \param count The number of indices to process
+		 * \param grainSize The maximum number of indices per call
+		 * \param func The function to call - void(size_t begin, size_t end)
+		 * \throw The first exception thrown by the function, once every range is done
+		 */
+		void parallelFor(size_t count, size_t grainSize, const RangeFunc& func);
+
+		/**
+		 * \brief Runs the main thread jobs scheduled so far. Main thread only
+		 */
+		void runMainThreadJobs();
+
+		/**
+		 * \brief Gets the number of worker threads, the main thread excluded
+		 * \return The job system's worker count
+		 */
+		size_t getWorkerCount() const;
+
+		/**
+		 * \brief Checks whether the calling thread is the job system's main thread
+		 * \return True if called from the thread which created the job system. False otherwise.
+		 */
+		bool isMainThread() const;
+
+	private:
+		static constexpr size_t NO_QUEUE = SIZE_MAX;
+		static constexpr size_t MAIN_QUEUE = 0;
+
+		inline static thread_local const JobSystem*	s_currentSystem = nullptr;	// The system the calling thread works for
+		inline static thread_local size_t			s_queueIndex = NO_QUEUE;	// The calling worker's queue in s_currentSystem
+
+		std::vector<std::unique_ptr<WorkStealingDeque<Job*>>>	m_queues;	// The main thread's, then one per worker
+		std::vector<std::thread>								m_workers;
+		std::thread::id											m_mainThreadId;
+
+		std::mutex												m_sharedMutex;
+		std::deque<Job*>										m_sharedJobs;		// Jobs scheduled by external threads
+		std::deque<Job*>										m_mainThreadJobs;
+
+		std::mutex												m_sleepMutex;
+		std::condition_variable									m_wakeCondition;
+		std::atomic<int64_t>									m_queuedJobs = 0;	// Jobs any worker can take
+		std::atomic<uint32_t>									m_sleepingWorkers = 0;
+		std::atomic<bool>										m_isStopping = false;
+
+		/**
+		 * \brief Gets the calling thread's queue index
+		 * \return The calling thread's queue. NO_QUEUE for external threads
+		 */
+		size_t getQueueIndex() const;
+
+		/**
+		 * \brief Queues the given job according to its affinity and wakes a sleeping worker if needed
+		 * \param job The job to queue
+		 */
+		void push(Job* job);
+
+		/**
+		 * \brief Takes a job from the given queue, the shared queue or another thread's queue
+		 * \param queueIndex The calling thread's queue. NO_QUEUE for external threads
+		 * \return The found job. nullptr if there are none
+		 */
+		Job* findJob(size_t queueIndex);
+
+		/**
+		 * \brief Takes the oldest main thread job
+		 * \return The found job. nullptr if there are none
+		 */
+		Job* findMainThreadJob();
+
+		/**
+		 * \brief Runs and destroys the given job, then updates its counter
+		 * \param job The job to run
+		 */
+		void run(Job* job);
+
+		/**
+		 * \brief Runs jobs until the job system is destroyed
+		 * \param queueIndex The worker's queue index
+		 * \param pin Whether the worker should be pinned to a core
+		 */
+		void workerLoop(size_t queueIndex, bool pin);
+	};
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace LibGL::Jobs
+{
+	/**
+	 * \brief Lock-free Chase-Lev deque: its owner thread pushes and pops at the bottom, like a stack,
+	 * while any other thread can steal the oldest item from the top.
+	 * The storage grows when full. Outgrown buffers are kept until destruction since thieves may still read them
+	 * \tparam T The stored item type - trivially copyable, typically a pointer
+	 */
+	template <typename T>
+	class WorkStealingDeque
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+
+	public:
+		static constexpr size_t DEFAULT_CAPACITY = 256;
+
+		/**
+		 * \brief Creates an empty deque able to hold the given number of items before growing
+		 * \param capacity The deque's initial capacity. Rounded up to a power of two
+		 */
+		explicit WorkStealingDeque(size_t capacity = DEFAULT_CAPACITY);
+
+		WorkStealingDeque(const WorkStealingDeque& other) = delete;
+		WorkStealingDeque(WorkStealingDeque&& other) = delete;
+		~WorkStealingDeque() = default;
+
+		WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+		WorkStealingDeque& operator=(WorkStealingDeque&& other) = delete;
+
+		/**
+		 * \brief Adds the given item at the bottom of the deque. Owner thread only
+		 * \param item The item to add
+		 */
+		void push(T item);
+
+		/**
+		 * \brief Removes the most recently pushed item. Owner thread only
+		 * \return The removed item. An empty optional if the deque is empty
+		 */
+		std::optional<T> pop();
+
+		/**
+		 * \brief Removes the oldest item. Can be called from any thread
+		 * \return The removed item. An empty optional if the deque is empty or another thread took the item first
+		 */
+		std::optional<T> steal();
+
+		/**
+		 * \brief Gets an estimate of the number of items in the deque
+		 * \return The deque's approximate size
+		 */
+		size_t getSize() const;
+
+	private:
+		/**
+		 * \brief Circular array of items indexed by the deque's ever increasing positions
+		 */
+		class Buffer
+		{
+		public:
+			explicit Buffer(size_t capacity);
+
+			size_t getCapacity() const;
+			T get(int64_t index) const;
+			void put(int64_t index, T item);
+
+			/**
+			 * \brief Creates a buffer twice as large holding the given range of items
+			 * \param top The first item's position
+			 * \param bottom The position after the last item
+			 * \return The new buffer
+			 */
+			std::unique_ptr<Buffer> grow(int64_t top, int64_t bottom) const;
+
+		private:
+			size_t							m_mask;
+			std::unique_ptr<std::atomic<T>[]>	m_items;
+		};
+
+		std::atomic<int64_t>					m_top = 0;
+		std::atomic<int64_t>					m_bottom = 0;
+		std::atomic<Buffer*>					m_buffer;
+		std::vector<std::unique_ptr<Buffer>>	m_buffers;	// Every buffer used so far - only accessed by the owner
+	};
+}
+
+#include "Jobs/WorkStealingDeque.inl"
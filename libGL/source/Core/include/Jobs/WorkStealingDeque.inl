@@ -0,0 +1,127 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+
+#include "Jobs/WorkStealingDeque.h"
+
+namespace LibGL::Jobs
+{
+	template <typename T>
+	WorkStealingDeque<T>::WorkStealingDeque(const size_t capacity)
+	{
+		m_buffers.push_back(std::make_unique<Buffer>(std::bit_ceil(std::max<size_t>(capacity, 2))));
+		m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	void WorkStealingDeque<T>::push(const T item)
+	{
+		const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+		const int64_t top = m_top.load(std::memory_order_acquire);
+		Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+		if (bottom - top >= static_cast<int64_t>(buffer->getCapacity()))
+		{
+			m_buffers.push_back(buffer->grow(top, bottom));
+			buffer = m_buffers.back().get();
+			m_buffer.store(buffer, std::memory_order_release);
+		}
+
+		buffer->put(bottom, item);
+
+		// Publishes the item to the thieves
+		m_bottom.store(bottom + 1, std::memory_order_release);
+	}
+
+	template <typename T>
+	std::optional<T> WorkStealingDeque<T>::pop()
+	{
+		const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+		Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+		// Sequentially consistent so that a thief can't read the old bottom after the owner read the old top
+		m_bottom.store(bottom, std::memory_order_seq_cst);
+		int64_t top = m_top.load(std::memory_order_seq_cst);
+
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return std::nullopt;
+		}
+
+		const T item = buffer->get(bottom);
+
+		if (top == bottom)
+		{
+			// Last item - races against the thieves
+			const bool isWon = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			if (!isWon)
+				return std::nullopt;
+		}
+
+		return item;
+	}
+
+	template <typename T>
+	std::optional<T> WorkStealingDeque<T>::steal()
+	{
+		int64_t top = m_top.load(std::memory_order_seq_cst);
+		const int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+
+		if (top >= bottom)
+			return std::nullopt;
+
+		const T item = m_buffer.load(std::memory_order_acquire)->get(top);
+
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return std::nullopt;
+
+		return item;
+	}
+
+	template <typename T>
+	size_t WorkStealingDeque<T>::getSize() const
+	{
+		const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+		const int64_t top = m_top.load(std::memory_order_relaxed);
+
+		return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+	}
+
+	template <typename T>
+	WorkStealingDeque<T>::Buffer::Buffer(const size_t capacity) :
+		m_mask(capacity - 1), m_items(std::make_unique<std::atomic<T>[]>(capacity))
+	{
+	}
+
+	template <typename T>
+	size_t WorkStealingDeque<T>::Buffer::getCapacity() const
+	{
+		return m_mask + 1;
+	}
+
+	template <typename T>
+	T WorkStealingDeque<T>::Buffer::get(const int64_t index) const
+	{
+		return m_items[static_cast<size_t>(index) & m_mask].load(std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	void WorkStealingDeque<T>::Buffer::put(const int64_t index, const T item)
+	{
+		m_items[static_cast<size_t>(index) & m_mask].store(item, std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	std::unique_ptr<typename WorkStealingDeque<T>::Buffer> WorkStealingDeque<T>::Buffer::grow(const int64_t top, const int64_t bottom) const
+	{
+		auto buffer = std::make_unique<Buffer>(getCapacity() * 2);
+
+		for (int64_t i = top; i < bottom; i++)
+			buffer->put(i, get(i));
+
+		return buffer;
+	}
+}
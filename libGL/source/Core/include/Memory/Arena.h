@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace LibGL::Memory
+{
+	/**
+	 * \brief Bump allocator over fixed size chunks, for objects which die together.
+	 * Individual allocations are never freed: reset rewinds the arena in O(1) and keeps its chunks for the next objects.
+	 * Each chunk starts with a header naming its arena, so the owner of an address is found without locking (see findOwner).
+	 * The objects must be destroyed before the arena is reset. Not thread safe
+	 */
+	class Arena
+	{
+	public:
+		static constexpr size_t CHUNK_SIZE = 64 * 1024;	// Size and alignment of the memory requested from the system at once
+
+		Arena() = default;
+		Arena(const Arena& other) = delete;
+		Arena(Arena&& other) noexcept;
+		~Arena();
+
+		Arena& operator=(const Arena& other) = delete;
+		Arena& operator=(Arena&& other) noexcept;
+
+		/**
+		 * \brief Allocates memory from the arena, adding a chunk if the current one is full
+		 * \param size The number of bytes to allocate
+		 * \param alignment The memory's alignment. Must be a power of two
+		 * \return A pointer to the allocated memory
+		 * \throw std::length_error if the size doesn't fit in a chunk after its header, at the given alignment
+		 */
+		void* allocate(size_t size, size_t alignment);
+
+		/**
+		 * \brief Makes every allocation so far reusable, keeping the chunks
+		 */
+		void reset();
+
+		/**
+		 * \brief Gives the arena's chunks back to the system. Every allocation so far becomes invalid
+		 */
+		void release();
+
+		/**
+		 * \brief Gets the number of chunks held by the arena
+		 * \return The arena's chunk count
+		 */
+		size_t getChunkCount() const;
+
+		/**
+		 * \brief Finds the arena the given memory was allocated from, without locking.
+		 * Can be called from any thread, while the arena isn't being moved
+		 * \param ptr The memory to look up
+		 * \return A pointer to the memory's arena. nullptr if it doesn't come from an arena
+		 */
+		static Arena* findOwner(const void* ptr);
+
+	private:
+		/**
+		 * \brief The start of each chunk, aligned to CHUNK_SIZE, so it is found from any address of the chunk
+		 */
+		struct ChunkHeader
+		{
+			Arena*	m_owner;
+		};
+
+		std::vector<std::byte*>	m_chunks;
+		size_t					m_currentChunk = 0;
+		size_t					m_offset = sizeof(ChunkHeader);	// Offset of the first free byte of the current chunk
+
+		/**
+		 * \brief Gets the offset of a chunk's first allocation of the given alignment
+		 * \param alignment The allocation's alignment
+		 * \return The offset right after the chunk's header, rounded up to the alignment
+		 */
+		static size_t getFirstOffset(size_t alignment);
+
+		/**
+		 * \brief Records the arena as the owner of its chunks
+		 */
+		void registerChunks();
+	};
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+namespace LibGL::Memory
+{
+	class Arena;
+
+	/**
+	 * \brief Routes the current thread's object allocations (see ObjectAllocator) to the given arena while it is alive.
+	 * Scopes can be nested, the innermost one being used
+	 */
+	class ArenaScope
+	{
+	public:
+		/**
+		 * \brief Makes the given arena the current thread's allocation arena
+		 * \param arena The arena to allocate from. nullptr to allocate from the pools
+		 */
+		explicit ArenaScope(Arena* arena);
+		ArenaScope(const ArenaScope& other) = delete;
+		ArenaScope(ArenaScope&& other) = delete;
+
+		/**
+		 * \brief Restores the previous allocation arena
+		 */
+		~ArenaScope();
+
+		ArenaScope& operator=(const ArenaScope& other) = delete;
+		ArenaScope& operator=(ArenaScope&& other) = delete;
+
+		/**
+		 * \brief Gets the current thread's allocation arena
+		 * \return A pointer to the innermost scope's arena. nullptr if there is none
+		 */
+		static Arena* getCurrent();
+
+	private:
+		inline static thread_local Arena*	s_current = nullptr;
+
+		Arena*	m_previous;
+	};
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <mutex>
+
+namespace LibGL::Memory
+{
+	class PoolAllocator;
+
+	/**
+	 * \brief Memory requested from the system by the object allocator (see ObjectAllocator::getStats)
+	 */
+	struct AllocationStats
+	{
+		size_t	m_allocationCount = 0;	// Number of system allocations made so far
+		size_t	m_currentBytes = 0;		// Bytes currently held
+		size_t	m_peakBytes = 0;		// Highest number of bytes held at once
+	};
+
+	/**
+	 * \brief Allocator behind the scene objects' operator new (nodes and components).
+	 * Objects are segregated by size class, each class having its own pool (see PoolAllocator), so objects of a
+	 * concrete type are packed in the same slabs. Inside an ArenaScope, allocations come from the scope's arena instead.
+	 * Objects larger than MAX_POOLED_SIZE go to the system allocator
+	 */
+	class ObjectAllocator
+	{
+	public:
+		static constexpr size_t SIZE_CLASS = alignof(std::max_align_t);	// Granularity of the pools' block sizes
+		static constexpr size_t MAX_POOLED_SIZE = 1024;
+
+		ObjectAllocator() = delete;
+
+		/**
+		 * \brief Allocates memory for an object of the given size, from the current arena if any (see ArenaScope)
+		 * \param size The object's size
+		 * \return A pointer to the object's memory, aligned to alignof(std::max_align_t)
+		 */
+		static void* allocate(size_t size);
+
+		/**
+		 * \brief Frees the given object's memory. Memory from an arena is only reclaimed when the arena is reset
+		 * \param object A pointer to memory returned by allocate
+		 * \param size The size passed to allocate
+		 */
+		static void deallocate(void* object, size_t size);
+
+		/**
+		 * \brief Gets the memory requested from the system by the pools and for the large objects
+		 * \return The allocator's statistics
+		 */
+		static AllocationStats getStats();
+
+	private:
+		static constexpr size_t POOL_COUNT = MAX_POOLED_SIZE / SIZE_CLASS;
+
+		inline static std::mutex								s_mutex;
+		inline static std::array<PoolAllocator*, POOL_COUNT>	s_pools {};	// Created on first use, never destroyed so objects can be freed during static destruction
+		inline static AllocationStats							s_stats;
+
+		/**
+		 * \brief Gets the pool of the given object size, creating it if needed
+		 * \param size The object's size, no greater than MAX_POOLED_SIZE
+		 * \return A reference to the size class' pool
+		 */
+		static PoolAllocator& getPool(size_t size);
+
+		/**
+		 * \brief Records memory requested from the system
+		 * \param bytes The number of bytes requested
+		 */
+		static void onSystemAllocation(size_t bytes);
+	};
+}
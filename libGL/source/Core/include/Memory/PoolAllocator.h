@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace LibGL::Memory
+{
+	/**
+	 * \brief Hands out blocks of a single size, carved from slabs and recycled through an intrusive free list.
+	 * Allocation and deallocation are O(1) and only reach the system allocator when every slab is full.
+	 * Slabs are kept until the pool is destroyed. Not thread safe
+	 */
+	class PoolAllocator
+	{
+	public:
+		static constexpr size_t SLAB_SIZE = 16 * 1024;	// Minimum size of the memory requested from the system at once
+
+		/**
+		 * \brief Creates an empty pool of blocks of the given size
+		 * \param blockSize The size of the pool's blocks, rounded up to a multiple of alignof(std::max_align_t)
+		 */
+		explicit PoolAllocator(size_t blockSize);
+		PoolAllocator(const PoolAllocator& other) = delete;
+		PoolAllocator(PoolAllocator&& other) = delete;
+		~PoolAllocator();
+
+		PoolAllocator& operator=(const PoolAllocator& other) = delete;
+		PoolAllocator& operator=(PoolAllocator&& other) = delete;
+
+		/**
+		 * \brief Takes a block from the pool, adding a slab if none is free
+		 * \return A pointer to the block, aligned to alignof(std::max_align_t)
+		 */
+		void* allocate();
+
+		/**
+		 * \brief Gives the given block back to the pool
+		 * \param block A block allocated by this pool
+		 */
+		void deallocate(void* block);
+
+		/**
+		 * \brief Gets the size of the pool's blocks
+		 * \return The pool's block size
+		 */
+		size_t getBlockSize() const;
+
+		/**
+		 * \brief Gets the number of slabs allocated by the pool
+		 * \return The pool's slab count
+		 */
+		size_t getSlabCount() const;
+
+		/**
+		 * \brief Gets the size of each of the pool's slabs
+		 * \return The pool's slab size
+		 */
+		size_t getSlabSize() const;
+
+	private:
+		/**
+		 * \brief The link stored in a free block
+		 */
+		struct FreeBlock
+		{
+			FreeBlock*	m_next;
+		};
+
+		std::vector<void*>	m_slabs;
+		FreeBlock*			m_freeBlocks = nullptr;
+		size_t				m_blockSize;
+		size_t				m_blocksPerSlab;
+
+		/**
+		 * \brief Allocates a slab and links its blocks into the free list
+		 */
+		void addSlab();
+	};
+}
@@ -19,8 +19,10 @@ namespace LibGL
 		template<typename T>
 		static T& get()
 		{
-			ASSERT(s_services.contains(typeid(T).hash_code()));
-			return *static_cast<T*>(s_services[typeid(T).hash_code()]);
+			// Looked up with find instead of operator[] so the services can be fetched from worker threads
+			const auto service = s_services.find(typeid(T).hash_code());
+			ASSERT(service != s_services.end());
+			return *static_cast<T*>(service->second);
 		}
 
 	private:
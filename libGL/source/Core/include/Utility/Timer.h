@@ -6,6 +6,8 @@ namespace LibGL::Utility
 	class Timer
 	{
 	public:
+		static constexpr uint32_t MAX_FIXED_STEPS = 5;	// Fixed steps per frame above which the simulation slows down instead of catching up
+
 		/**
 		 * \brief Creates a default timer
 		 */
@@ -34,7 +36,8 @@ namespace LibGL::Utility
 		float getTime() const;
 
 		/**
-		 * \brief Gets the scaled time between the previous and last updates
+		 * \brief Gets the scaled time between the previous and last updates.
+		 * During a fixed step (see startFixedStep), this is the fixed delta time instead
 		 * \return The scaled time between the previous and last updates
 		 */
 		float getDeltaTime() const;
@@ -62,6 +65,26 @@ namespace LibGL::Utility
 		 */
 		void setTimeScale(float timeScale);
 
+		/**
+		 * \brief Gets the scaled time simulated by each fixed step
+		 * \return The fixed delta time
+		 */
+		float getFixedDeltaTime() const;
+
+		/**
+		 * \brief Sets the scaled time simulated by each fixed step
+		 * \param fixedDeltaTime The new fixed delta time
+		 * \throw std::invalid_argument if the given time isn't positive
+		 */
+		void setFixedDeltaTime(float fixedDeltaTime);
+
+		/**
+		 * \brief Consumes a fixed step of the scaled time accumulated by the updates, if there is enough of it.
+		 * Until the next call, getDeltaTime returns the fixed delta time
+		 * \return True if a fixed step started. False if the accumulated time is below a fixed step
+		 */
+		bool startFixedStep();
+
 		/**
 		 * \brief Gets the number of time the "update" function has been called
 		 * \return The elapsed number of frames since the timer's creation
@@ -80,7 +103,10 @@ namespace LibGL::Utility
 		float				m_unscaledTime = 0;
 		float				m_deltaTime = 0;
 		float				m_timeScale = 1;
+		float				m_fixedDeltaTime = .02f;
+		float				m_fixedTimeAccumulator = 0;
 
 		bool				m_isFirstUpdate = true;
+		bool				m_isInFixedStep = false;
 	};
 }
@@ -1,4 +1,5 @@
 #include "DataStructure/Graph.h"
+#include "Memory/ObjectAllocator.h"
 
 namespace LibGL::DataStructure
 {
@@ -17,17 +18,24 @@ namespace LibGL::DataStructure
 	}
 
 	Node::Node(Node&& other) noexcept : m_parent(other.m_parent),
-		m_children(std::move(other.m_children)), m_id(other.m_id)
+		m_children(std::move(other.m_children)), m_childIndex(other.m_childIndex), m_id(other.m_id)
 	{
 	}
 
 	Node::~Node()
 	{
+		// Already being destroyed - only leaves the parent's children
 		if (m_parent != nullptr)
-			m_parent->removeChild(*this);
+			m_parent->detachChild(*this);
 
-		while (!m_children.empty())
-			Node::removeChild(*m_children[0]);
+		while (!m_children.isEmpty())
+		{
+			Node* child = m_children.back();
+			m_children.popBack();
+
+			child->m_parent = nullptr;
+			delete child;
+		}
 	}
 
 	Node& Node::operator=(const Node& other)
@@ -49,6 +57,7 @@ namespace LibGL::DataStructure
 
 		m_parent = other.m_parent;
 		m_children = std::move(other.m_children);
+		m_childIndex = other.m_childIndex;
 		m_id = other.m_id;
 
 		other.m_id = 0;
@@ -57,6 +66,16 @@ namespace LibGL::DataStructure
 		return *this;
 	}
 
+	void* Node::operator new(const size_t size)
+	{
+		return Memory::ObjectAllocator::allocate(size);
+	}
+
+	void Node::operator delete(void* node, const size_t size)
+	{
+		Memory::ObjectAllocator::deallocate(node, size);
+	}
+
 	bool Node::operator==(const Node& other) const
 	{
 		return other.m_id == m_id;
@@ -77,25 +96,59 @@ namespace LibGL::DataStructure
 		return m_parent;
 	}
 
-	Node::NodeList Node::getChildren()
+	std::span<const Node::NodePtr> Node::getChildren() const
+	{
+		return m_children.getValues();
+	}
+
+	NodeRange<DepthFirstIterator<Node>> Node::depthFirst()
 	{
-		return m_children;
+		return NodeRange(DepthFirstIterator<Node>(this));
+	}
+
+	NodeRange<BreadthFirstIterator<Node>> Node::breadthFirst()
+	{
+		return NodeRange(BreadthFirstIterator<Node>(this));
 	}
 
 	void Node::removeChild(Node& child)
 	{
-		const auto findFunc = [&child](const NodePtr& node)
-		{
-			return *node == child;
-		};
+		if (detachChild(child))
+			delete &child;
+	}
 
-		const auto childIter = std::ranges::find_if(m_children, findFunc);
+	void Node::attachChild(Node& child)
+	{
+		child.m_parent = this;
+		child.m_childIndex = m_children.getSize();
+		m_children.pushBack(&child);
+	}
 
-		if (childIter != m_children.end())
-		{
-			child.m_parent = nullptr;
-			delete *childIter;
-			m_children.erase(childIter);
-		}
+	bool Node::detachChild(Node& child)
+	{
+		const size_t index = child.m_childIndex;
+
+		if (child.m_parent != this || index >= m_children.getSize() || m_children[index] != &child)
+			return false;
+
+		// Fills the hole with the last child
+		m_children[index] = m_children.back();
+		m_children[index]->m_childIndex = index;
+		m_children.popBack();
+
+		child.m_parent = nullptr;
+
+		return true;
+	}
+
+	void Node::setParent(Node* parent)
+	{
+		if (m_parent != nullptr)
+			m_parent->detachChild(*this);
+
+		if (parent != nullptr)
+			parent->attachChild(*this);
+
+		onParentChange();
 	}
 }
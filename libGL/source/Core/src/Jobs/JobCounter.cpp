@@ -0,0 +1,14 @@
+#include "Jobs/JobCounter.h"
+
+namespace LibGL::Jobs
+{
+	bool JobCounter::isDone() const
+	{
+		return m_pendingJobs.load(std::memory_order_acquire) == 0;
+	}
+
+	uint32_t JobCounter::getPendingJobs() const
+	{
+		return m_pendingJobs.load(std::memory_order_relaxed);
+	}
+}
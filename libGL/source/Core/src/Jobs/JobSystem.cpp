@@ -0,0 +1,396 @@
+#include "Jobs/JobSystem.h"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#endif
+
+#include "Debug/Assertion.h"
+
+namespace LibGL::Jobs
+{
+	namespace
+	{
+		/**
+		 * \brief Restricts the calling thread to the given core. Ignored on unsupported platforms
+		 * \param core The core's index
+		 */
+		void pinCurrentThread(const size_t core)
+		{
+#if defined(_WIN32)
+			SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << (core % (sizeof(DWORD_PTR) * 8)));
+#elif defined(__linux__)
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			CPU_SET(core % CPU_SETSIZE, &cpuSet);
+			pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+#else
+			(void)core;
+#endif
+		}
+	}
+
+	JobSystem::JobSystem() :
+		JobSystem(std::max(std::thread::hardware_concurrency(), 1u) - 1)
+	{
+	}
+
+	JobSystem::JobSystem(const size_t workerCount, const bool pinWorkers) :
+		m_mainThreadId(std::this_thread::get_id())
+	{
+		for (size_t i = 0; i <= workerCount; i++)
+			m_queues.push_back(std::make_unique<WorkStealingDeque<Job*>>());
+
+		m_workers.reserve(workerCount);
+
+		for (size_t i = 1; i <= workerCount; i++)
+			m_workers.emplace_back(&JobSystem::workerLoop, this, i, pinWorkers);
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard lock(m_sleepMutex);
+			m_isStopping = true;
+		}
+
+		m_wakeCondition.notify_all();
+
+		for (std::thread& worker : m_workers)
+			worker.join();
+
+		for (const std::unique_ptr<WorkStealingDeque<Job*>>& queue : m_queues)
+		{
+			while (const std::optional<Job*> job = queue->pop())
+				delete *job;
+		}
+
+		for (const Job* job : m_sharedJobs)
+			delete job;
+
+		for (const Job* job : m_mainThreadJobs)
+			delete job;
+	}
+
+	void JobSystem::schedule(JobFunc job, JobCounter* counter, const EJobAffinity affinity)
+	{
+		if (counter != nullptr)
+			counter->m_pendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+		push(new Job{ std::move(job), counter, affinity });
+	}
+
+	void JobSystem::scheduleAfter(JobCounter& dependency, JobFunc job, JobCounter* counter, const EJobAffinity affinity)
+	{
+		if (counter != nullptr)
+			counter->m_pendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+		Job* continuation = new Job{ std::move(job), counter, affinity };
+
+		{
+			// Pushed by the last job of the dependency unless it is already done
+			std::lock_guard lock(dependency.m_mutex);
+
+			if (!dependency.isDone())
+			{
+				dependency.m_continuations.push_back(continuation);
+				return;
+			}
+		}
+
+		push(continuation);
+	}
+
+	void JobSystem::wait(JobCounter& counter)
+	{
+		const size_t queueIndex = getQueueIndex();
+		uint32_t idleCount = 0;
+
+		while (!counter.isDone())
+		{
+			Job* job = queueIndex == MAIN_QUEUE ? findMainThreadJob() : nullptr;
+
+			if (job == nullptr)
+				job = findJob(queueIndex);
+
+			if (job != nullptr)
+			{
+				run(job);
+				idleCount = 0;
+			}
+			else if (++idleCount > IDLE_SPIN_COUNT)
+			{
+				// The remaining jobs are running on other threads
+				std::this_thread::yield();
+			}
+		}
+
+		std::exception_ptr exception;
+
+		{
+			std::lock_guard lock(counter.m_mutex);
+			std::swap(exception, counter.m_exception);
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	void JobSystem::parallelFor(const size_t count, const size_t grainSize, const RangeFunc& func)
+	{
+		if (count == 0)
+			return;
+
+		const size_t grain = std::max<size_t>(grainSize, 1);
+		const size_t rangeCount = (count + grain - 1) / grain;
+
+		// Not worth scheduling jobs for a single range
+		if (m_workers.empty() || rangeCount == 1)
+		{
+			for (size_t begin = 0; begin < count; begin += grain)
+				func(begin, std::min(begin + grain, count));
+
+			return;
+		}
+
+		// A job per thread taking ranges until there are none left, rather than a job per range
+		std::atomic<size_t> nextIndex = 0;
+
+		const auto runRanges = [&nextIndex, count, grain, &func]
+		{
+			for (size_t begin = nextIndex.fetch_add(grain); begin < count; begin = nextIndex.fetch_add(grain))
+				func(begin, std::min(begin + grain, count));
+		};
+
+		JobCounter counter;
+
+		for (size_t i = 1; i < std::min(rangeCount, m_workers.size() + 1); i++)
+			schedule(runRanges, &counter);
+
+		std::exception_ptr exception;
+
+		try
+		{
+			runRanges();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		// The jobs refer to this frame - they must be done before leaving, even on failure
+		try
+		{
+			wait(counter);
+		}
+		catch (...)
+		{
+			if (!exception)
+				exception = std::current_exception();
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	void JobSystem::runMainThreadJobs()
+	{
+		ASSERT(isMainThread());
+
+		std::deque<Job*> jobs;
+
+		{
+			std::lock_guard lock(m_sharedMutex);
+			std::swap(jobs, m_mainThreadJobs);
+		}
+
+		// Jobs scheduled by these ones run next time
+		for (Job* job : jobs)
+			run(job);
+	}
+
+	size_t JobSystem::getWorkerCount() const
+	{
+		return m_workers.size();
+	}
+
+	bool JobSystem::isMainThread() const
+	{
+		return std::this_thread::get_id() == m_mainThreadId;
+	}
+
+	size_t JobSystem::getQueueIndex() const
+	{
+		if (s_currentSystem == this)
+			return s_queueIndex;
+
+		return isMainThread() ? MAIN_QUEUE : NO_QUEUE;
+	}
+
+	void JobSystem::push(Job* job)
+	{
+		if (job->m_affinity == EJobAffinity::MAIN_THREAD)
+		{
+			std::lock_guard lock(m_sharedMutex);
+			m_mainThreadJobs.push_back(job);
+			return;
+		}
+
+		if (const size_t queueIndex = getQueueIndex(); queueIndex != NO_QUEUE)
+		{
+			m_queues[queueIndex]->push(job);
+		}
+		else
+		{
+			std::lock_guard lock(m_sharedMutex);
+			m_sharedJobs.push_back(job);
+		}
+
+		m_queuedJobs.fetch_add(1);
+
+		// Pairs with the sleeping workers incrementing m_sleepingWorkers before checking m_queuedJobs
+		if (m_sleepingWorkers.load() > 0)
+		{
+			std::lock_guard lock(m_sleepMutex);
+			m_wakeCondition.notify_one();
+		}
+	}
+
+	Job* JobSystem::findJob(const size_t queueIndex)
+	{
+		if (queueIndex != NO_QUEUE)
+		{
+			if (const std::optional<Job*> job = m_queues[queueIndex]->pop())
+			{
+				m_queuedJobs.fetch_sub(1);
+				return *job;
+			}
+		}
+
+		{
+			std::lock_guard lock(m_sharedMutex);
+
+			if (!m_sharedJobs.empty())
+			{
+				Job* job = m_sharedJobs.front();
+				m_sharedJobs.pop_front();
+				m_queuedJobs.fetch_sub(1);
+				return job;
+			}
+		}
+
+		// Starts with the next queue so the victims are spread over the queues
+		const size_t start = queueIndex != NO_QUEUE ? queueIndex + 1 : 0;
+
+		for (size_t i = 0; i < m_queues.size(); i++)
+		{
+			const size_t victim = (start + i) % m_queues.size();
+
+			if (victim == queueIndex)
+				continue;
+
+			if (const std::optional<Job*> job = m_queues[victim]->steal())
+			{
+				m_queuedJobs.fetch_sub(1);
+				return *job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	Job* JobSystem::findMainThreadJob()
+	{
+		std::lock_guard lock(m_sharedMutex);
+
+		if (m_mainThreadJobs.empty())
+			return nullptr;
+
+		Job* job = m_mainThreadJobs.front();
+		m_mainThreadJobs.pop_front();
+
+		return job;
+	}
+
+	void JobSystem::run(Job* job)
+	{
+		JobCounter* counter = job->m_counter;
+
+		if (counter == nullptr)
+		{
+			const std::unique_ptr<Job> ownedJob(job);
+			ownedJob->m_func();
+			return;
+		}
+
+		try
+		{
+			job->m_func();
+		}
+		catch (...)
+		{
+			std::lock_guard lock(counter->m_mutex);
+
+			if (!counter->m_exception)
+				counter->m_exception = std::current_exception();
+		}
+
+		delete job;
+
+		std::vector<Job*> continuations;
+
+		{
+			// Locked so that a waiter can't destroy the counter before this thread is done with it (see wait)
+			std::lock_guard lock(counter->m_mutex);
+
+			if (counter->m_pendingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				std::swap(continuations, counter->m_continuations);
+		}
+
+		for (Job* continuation : continuations)
+			push(continuation);
+	}
+
+	void JobSystem::workerLoop(const size_t queueIndex, const bool pin)
+	{
+		s_currentSystem = this;
+		s_queueIndex = queueIndex;
+
+		if (pin)
+			pinCurrentThread(queueIndex);
+
+		uint32_t idleCount = 0;
+
+		while (!m_isStopping.load(std::memory_order_relaxed))
+		{
+			if (Job* job = findJob(queueIndex))
+			{
+				run(job);
+				idleCount = 0;
+				continue;
+			}
+
+			if (++idleCount <= IDLE_SPIN_COUNT)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock lock(m_sleepMutex);
+
+			m_sleepingWorkers.fetch_add(1);
+			m_wakeCondition.wait(lock, [this] { return m_isStopping || m_queuedJobs.load() > 0; });
+			m_sleepingWorkers.fetch_sub(1);
+
+			idleCount = 0;
+		}
+
+		s_currentSystem = nullptr;
+		s_queueIndex = NO_QUEUE;
+	}
+}
@@ -0,0 +1,269 @@
+#include "Memory/Arena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace LibGL::Memory
+{
+	namespace
+	{
+		constexpr uintptr_t	EMPTY_SLOT = 0;
+		constexpr uintptr_t	ERASED_SLOT = 1;		// No chunk has this address since they are aligned
+		constexpr size_t	MIN_TABLE_SIZE = 64;
+
+		/**
+		 * \brief Open addressing set of the live chunks' addresses. Erased chunks leave a marker, so the lookups
+		 * keep probing past them. Only replaced or written under g_chunksMutex, while the lookups read it without locking
+		 */
+		struct ChunkTable
+		{
+			size_t										m_mask;
+			size_t										m_usedSlotCount = 0;	// The live and erased chunks' slots
+			std::unique_ptr<std::atomic<uintptr_t>[]>	m_slots;
+
+			explicit ChunkTable(const size_t size) :
+				m_mask(size - 1), m_slots(std::make_unique<std::atomic<uintptr_t>[]>(size))
+			{
+			}
+
+			size_t getFirstSlot(const uintptr_t chunk) const
+			{
+				// Fibonacci hashing of the chunk's index in the address space
+				return static_cast<size_t>((chunk / Arena::CHUNK_SIZE) * 0x9E3779B97F4A7C15ull) & m_mask;
+			}
+		};
+
+		std::mutex								g_chunksMutex;
+		std::atomic<ChunkTable*>				g_chunkTable = nullptr;
+		std::vector<std::unique_ptr<ChunkTable>>	g_chunkTables;	// Every table so far - lookups may still read outgrown ones
+		size_t									g_chunkCount = 0;
+
+		/**
+		 * \brief Checks whether the given address is a live chunk's, without locking
+		 * \param chunk The address to look up
+		 * \return True if a live chunk starts at the address. False otherwise.
+		 */
+		bool containsChunk(const uintptr_t chunk)
+		{
+			const ChunkTable* table = g_chunkTable.load(std::memory_order_acquire);
+
+			if (table == nullptr)
+				return false;
+
+			// The table is never more than half full, so the probing always reaches an empty slot
+			for (size_t slot = table->getFirstSlot(chunk);; slot = (slot + 1) & table->m_mask)
+			{
+				const uintptr_t address = table->m_slots[slot].load(std::memory_order_acquire);
+
+				if (address == chunk)
+					return true;
+
+				if (address == EMPTY_SLOT)
+					return false;
+			}
+		}
+
+		/**
+		 * \brief Adds the given chunk to the set, replacing the table when too many slots are used. Needs g_chunksMutex
+		 * \param chunk The chunk's address
+		 */
+		void insertChunk(const uintptr_t chunk)
+		{
+			ChunkTable* table = g_chunkTable.load(std::memory_order_relaxed);
+
+			if (table == nullptr || (table->m_usedSlotCount + 1) * 2 > table->m_mask + 1)
+			{
+				// Sized for the live chunks only, dropping the erased markers
+				auto newTable = std::make_unique<ChunkTable>(std::max(MIN_TABLE_SIZE, std::bit_ceil((g_chunkCount + 1) * 4)));
+
+				for (size_t slot = 0; table != nullptr && slot <= table->m_mask; slot++)
+				{
+					const uintptr_t address = table->m_slots[slot].load(std::memory_order_relaxed);
+
+					if (address == EMPTY_SLOT || address == ERASED_SLOT)
+						continue;
+
+					size_t newSlot = newTable->getFirstSlot(address);
+
+					while (newTable->m_slots[newSlot].load(std::memory_order_relaxed) != EMPTY_SLOT)
+						newSlot = (newSlot + 1) & newTable->m_mask;
+
+					newTable->m_slots[newSlot].store(address, std::memory_order_relaxed);
+					newTable->m_usedSlotCount++;
+				}
+
+				g_chunkTables.reserve(g_chunkTables.size() + 1);
+				table = newTable.get();
+
+				g_chunkTables.push_back(std::move(newTable));
+				g_chunkTable.store(table, std::memory_order_release);
+			}
+
+			size_t slot = table->getFirstSlot(chunk);
+
+			for (uintptr_t address = table->m_slots[slot].load(std::memory_order_relaxed);
+				address != EMPTY_SLOT && address != ERASED_SLOT;
+				address = table->m_slots[slot].load(std::memory_order_relaxed))
+			{
+				slot = (slot + 1) & table->m_mask;
+			}
+
+			if (table->m_slots[slot].load(std::memory_order_relaxed) == EMPTY_SLOT)
+				table->m_usedSlotCount++;
+
+			table->m_slots[slot].store(chunk, std::memory_order_release);
+			g_chunkCount++;
+		}
+
+		/**
+		 * \brief Removes the given chunk from the set. Needs g_chunksMutex
+		 * \param chunk The chunk's address
+		 */
+		void eraseChunk(const uintptr_t chunk)
+		{
+			ChunkTable* table = g_chunkTable.load(std::memory_order_relaxed);
+
+			for (size_t slot = table->getFirstSlot(chunk);; slot = (slot + 1) & table->m_mask)
+			{
+				if (table->m_slots[slot].load(std::memory_order_relaxed) == chunk)
+				{
+					table->m_slots[slot].store(ERASED_SLOT, std::memory_order_release);
+					g_chunkCount--;
+					return;
+				}
+			}
+		}
+	}
+
+	Arena::Arena(Arena&& other) noexcept :
+		m_chunks(std::move(other.m_chunks)), m_currentChunk(std::exchange(other.m_currentChunk, 0)),
+		m_offset(std::exchange(other.m_offset, sizeof(ChunkHeader)))
+	{
+		other.m_chunks.clear();
+		registerChunks();
+	}
+
+	Arena::~Arena()
+	{
+		release();
+	}
+
+	Arena& Arena::operator=(Arena&& other) noexcept
+	{
+		if (&other == this)
+			return *this;
+
+		release();
+
+		m_chunks = std::move(other.m_chunks);
+		m_currentChunk = std::exchange(other.m_currentChunk, 0);
+		m_offset = std::exchange(other.m_offset, sizeof(ChunkHeader));
+
+		other.m_chunks.clear();
+		registerChunks();
+
+		return *this;
+	}
+
+	void* Arena::allocate(const size_t size, const size_t alignment)
+	{
+		if (size > CHUNK_SIZE || getFirstOffset(alignment) > CHUNK_SIZE - size)
+			throw std::length_error("Allocation too large for an arena chunk");
+
+		while (m_currentChunk < m_chunks.size())
+		{
+			const size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+
+			if (offset <= CHUNK_SIZE - size)
+			{
+				m_offset = offset + size;
+				return m_chunks[m_currentChunk] + offset;
+			}
+
+			m_currentChunk++;
+			m_offset = sizeof(ChunkHeader);
+		}
+
+		m_chunks.reserve(m_chunks.size() + 1);
+
+		// Aligned to their size so the header of an address' chunk is found by masking the address
+		auto* chunk = static_cast<std::byte*>(::operator new(CHUNK_SIZE, std::align_val_t{ CHUNK_SIZE }));
+		::new (chunk) ChunkHeader{ this };
+
+		try
+		{
+			std::lock_guard lock(g_chunksMutex);
+			insertChunk(reinterpret_cast<uintptr_t>(chunk));
+		}
+		catch (...)
+		{
+			::operator delete(chunk, std::align_val_t{ CHUNK_SIZE });
+			throw;
+		}
+
+		m_chunks.push_back(chunk);
+		m_currentChunk = m_chunks.size() - 1;
+		m_offset = getFirstOffset(alignment) + size;
+
+		return chunk + getFirstOffset(alignment);
+	}
+
+	void Arena::reset()
+	{
+		m_currentChunk = 0;
+		m_offset = sizeof(ChunkHeader);
+	}
+
+	void Arena::release()
+	{
+		if (m_chunks.empty())
+			return;
+
+		{
+			std::lock_guard lock(g_chunksMutex);
+
+			for (std::byte* chunk : m_chunks)
+				eraseChunk(reinterpret_cast<uintptr_t>(chunk));
+		}
+
+		for (std::byte* chunk : m_chunks)
+			::operator delete(chunk, std::align_val_t{ CHUNK_SIZE });
+
+		m_chunks.clear();
+		reset();
+	}
+
+	size_t Arena::getChunkCount() const
+	{
+		return m_chunks.size();
+	}
+
+	size_t Arena::getFirstOffset(const size_t alignment)
+	{
+		return (sizeof(ChunkHeader) + alignment - 1) & ~(alignment - 1);
+	}
+
+	Arena* Arena::findOwner(const void* ptr)
+	{
+		const uintptr_t chunk = reinterpret_cast<uintptr_t>(ptr) & ~static_cast<uintptr_t>(CHUNK_SIZE - 1);
+
+		// Only reads the header of actual chunks - the memory before other addresses may not be mapped
+		if (!containsChunk(chunk))
+			return nullptr;
+
+		return reinterpret_cast<const ChunkHeader*>(chunk)->m_owner;
+	}
+
+	void Arena::registerChunks()
+	{
+		for (std::byte* chunk : m_chunks)
+			reinterpret_cast<ChunkHeader*>(chunk)->m_owner = this;
+	}
+}
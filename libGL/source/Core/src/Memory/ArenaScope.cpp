@@ -0,0 +1,20 @@
+#include "Memory/ArenaScope.h"
+
+namespace LibGL::Memory
+{
+	ArenaScope::ArenaScope(Arena* arena) :
+		m_previous(s_current)
+	{
+		s_current = arena;
+	}
+
+	ArenaScope::~ArenaScope()
+	{
+		s_current = m_previous;
+	}
+
+	Arena* ArenaScope::getCurrent()
+	{
+		return s_current;
+	}
+}
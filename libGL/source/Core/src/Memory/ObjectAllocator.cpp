@@ -0,0 +1,85 @@
+#include "Memory/ObjectAllocator.h"
+
+#include <new>
+
+#include "Memory/Arena.h"
+#include "Memory/ArenaScope.h"
+#include "Memory/PoolAllocator.h"
+
+namespace LibGL::Memory
+{
+	void* ObjectAllocator::allocate(const size_t size)
+	{
+		if (size > MAX_POOLED_SIZE)
+		{
+			void* object = ::operator new(size);
+
+			std::lock_guard lock(s_mutex);
+			onSystemAllocation(size);
+
+			return object;
+		}
+
+		if (Arena* arena = ArenaScope::getCurrent())
+			return arena->allocate(size, alignof(std::max_align_t));
+
+		std::lock_guard lock(s_mutex);
+		PoolAllocator& pool = getPool(size);
+
+		const size_t slabCount = pool.getSlabCount();
+		void* object = pool.allocate();
+
+		if (pool.getSlabCount() != slabCount)
+			onSystemAllocation(pool.getSlabSize());
+
+		return object;
+	}
+
+	void ObjectAllocator::deallocate(void* object, const size_t size)
+	{
+		if (object == nullptr)
+			return;
+
+		if (size > MAX_POOLED_SIZE)
+		{
+			::operator delete(object);
+
+			std::lock_guard lock(s_mutex);
+			s_stats.m_currentBytes -= size;
+
+			return;
+		}
+
+		if (Arena::findOwner(object) != nullptr)
+			return;
+
+		std::lock_guard lock(s_mutex);
+		getPool(size).deallocate(object);
+	}
+
+	AllocationStats ObjectAllocator::getStats()
+	{
+		std::lock_guard lock(s_mutex);
+		return s_stats;
+	}
+
+	PoolAllocator& ObjectAllocator::getPool(const size_t size)
+	{
+		const size_t index = size == 0 ? 0 : (size - 1) / SIZE_CLASS;
+		PoolAllocator*& pool = s_pools[index];
+
+		if (pool == nullptr)
+			pool = new PoolAllocator((index + 1) * SIZE_CLASS);
+
+		return *pool;
+	}
+
+	void ObjectAllocator::onSystemAllocation(const size_t bytes)
+	{
+		s_stats.m_allocationCount++;
+		s_stats.m_currentBytes += bytes;
+
+		if (s_stats.m_currentBytes > s_stats.m_peakBytes)
+			s_stats.m_peakBytes = s_stats.m_currentBytes;
+	}
+}
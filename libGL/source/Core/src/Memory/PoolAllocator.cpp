@@ -0,0 +1,70 @@
+#include "Memory/PoolAllocator.h"
+
+#include <algorithm>
+#include <new>
+
+namespace LibGL::Memory
+{
+	namespace
+	{
+		constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+	}
+
+	PoolAllocator::PoolAllocator(const size_t blockSize) :
+		m_blockSize((std::max(blockSize, sizeof(FreeBlock)) + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT),
+		m_blocksPerSlab(std::max<size_t>(SLAB_SIZE / m_blockSize, 1))
+	{
+	}
+
+	PoolAllocator::~PoolAllocator()
+	{
+		for (void* slab : m_slabs)
+			::operator delete(slab);
+	}
+
+	void* PoolAllocator::allocate()
+	{
+		if (m_freeBlocks == nullptr)
+			addSlab();
+
+		FreeBlock* block = m_freeBlocks;
+		m_freeBlocks = block->m_next;
+
+		return block;
+	}
+
+	void PoolAllocator::deallocate(void* block)
+	{
+		if (block == nullptr)
+			return;
+
+		m_freeBlocks = new (block) FreeBlock{ m_freeBlocks };
+	}
+
+	size_t PoolAllocator::getBlockSize() const
+	{
+		return m_blockSize;
+	}
+
+	size_t PoolAllocator::getSlabCount() const
+	{
+		return m_slabs.size();
+	}
+
+	size_t PoolAllocator::getSlabSize() const
+	{
+		return m_blocksPerSlab * m_blockSize;
+	}
+
+	void PoolAllocator::addSlab()
+	{
+		m_slabs.reserve(m_slabs.size() + 1);
+
+		auto* slab = static_cast<std::byte*>(::operator new(getSlabSize()));
+		m_slabs.push_back(slab);
+
+		// Linked back to front so blocks are handed out in address order
+		for (size_t block = m_blocksPerSlab; block > 0; block--)
+			m_freeBlocks = new (slab + (block - 1) * m_blockSize) FreeBlock{ m_freeBlocks };
+	}
+}
@@ -1,6 +1,8 @@
 #include "Utility/Timer.h"
 
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
 
 namespace LibGL::Utility
 {
@@ -26,8 +28,13 @@ namespace LibGL::Utility
 			m_deltaTime = std::chrono::duration<float>(m_currentTime - m_lastUpdate).count();
 			m_unscaledTime += m_deltaTime;
 			m_time += m_deltaTime * m_timeScale;
+
+			m_fixedTimeAccumulator += m_deltaTime * m_timeScale;
+			m_fixedTimeAccumulator = std::min(m_fixedTimeAccumulator, m_fixedDeltaTime * MAX_FIXED_STEPS);
 		}
 
+		m_isInFixedStep = false;
+
 		m_frameCount++;
 	}
 
@@ -38,7 +45,7 @@ namespace LibGL::Utility
 
 	float Timer::getDeltaTime() const
 	{
-		return m_deltaTime * m_timeScale;
+		return m_isInFixedStep ? m_fixedDeltaTime : m_deltaTime * m_timeScale;
 	}
 
 	float Timer::getUnscaledTime() const
@@ -61,6 +68,29 @@ namespace LibGL::Utility
 		m_timeScale = timeScale;
 	}
 
+	float Timer::getFixedDeltaTime() const
+	{
+		return m_fixedDeltaTime;
+	}
+
+	void Timer::setFixedDeltaTime(const float fixedDeltaTime)
+	{
+		if (!(fixedDeltaTime > 0.f))
+			throw std::invalid_argument("The fixed delta time must be positive");
+
+		m_fixedDeltaTime = fixedDeltaTime;
+	}
+
+	bool Timer::startFixedStep()
+	{
+		m_isInFixedStep = m_fixedTimeAccumulator >= m_fixedDeltaTime;
+
+		if (m_isInFixedStep)
+			m_fixedTimeAccumulator -= m_fixedDeltaTime;
+
+		return m_isInFixedStep;
+	}
+
 	uint64_t Timer::getFrameCount() const
 	{
 		return m_frameCount;
@@ -0,0 +1,180 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "ComponentType.h"
+
+namespace LibGL
+{
+	class Entity;
+
+	/**
+	 * \brief Stores the relocatable components of every entity sharing the same set of component types.
+	 * Each entity is a row. Rows are packed in fixed size chunks in which every component type has its own array
+	 */
+	class Archetype
+	{
+	public:
+		typedef std::vector<ComponentTypeId> Signature;
+
+		static constexpr size_t CHUNK_SIZE = 16 * 1024;	// Bytes per chunk - as many rows as possible fit in it
+		static constexpr size_t CHUNK_ALIGNMENT = 64;	// Cache line size
+		static constexpr size_t INVALID_COLUMN = static_cast<size_t>(-1);
+
+		/**
+		 * \brief Creates an empty archetype for the given component types
+		 * \param types The stored component types
+		 */
+		explicit Archetype(std::vector<const ComponentTypeInfo*> types);
+
+		Archetype(const Archetype& other) = delete;
+		Archetype(Archetype&& other) = delete;
+
+		/**
+		 * \brief Releases the archetype's chunks. The stored components must have been destroyed beforehand
+		 */
+		~Archetype();
+
+		Archetype& operator=(const Archetype& other) = delete;
+		Archetype& operator=(Archetype&& other) = delete;
+
+		/**
+		 * \brief Gets the archetype's sorted component type ids
+		 * \return The archetype's signature
+		 */
+		const Signature& getSignature() const;
+
+		/**
+		 * \brief Gets the number of component types stored in the archetype
+		 * \return The archetype's column count
+		 */
+		size_t getColumnCount() const;
+
+		/**
+		 * \brief Gets the component type stored in the given column
+		 * \param column The column's index
+		 * \return The column's component type
+		 */
+		const ComponentTypeInfo& getType(size_t column) const;
+
+		/**
+		 * \brief Finds the column storing the given component type
+		 * \param type The component type to look for
+		 * \return The column's index. INVALID_COLUMN if the type isn't stored in the archetype
+		 */
+		size_t findColumn(ComponentTypeId type) const;
+
+		/**
+		 * \brief Finds the column holding the given component in the given row
+		 * \param component The component to look for
+		 * \param row The component's owner's row
+		 * \return The column's index. INVALID_COLUMN if the component isn't in the row
+		 */
+		size_t findColumn(const Component& component, size_t row) const;
+
+		/**
+		 * \brief Gets the number of entities stored in the archetype
+		 * \return The archetype's row count
+		 */
+		size_t getSize() const;
+
+		/**
+		 * \brief Gets the number of rows held by a chunk
+		 * \return The archetype's chunk capacity
+		 */
+		size_t getChunkCapacity() const;
+
+		/**
+		 * \brief Gets the number of chunks holding at least one row
+		 * \return The archetype's used chunk count
+		 */
+		size_t getChunkCount() const;
+
+		/**
+		 * \brief Gets the number of rows stored in the given chunk
+		 * \param chunk The chunk's index
+		 * \return The chunk's row count
+		 */
+		size_t getChunkSize(size_t chunk) const;
+
+		/**
+		 * \brief Gets the entity owning the given row
+		 * \param row The row's index
+		 * \return The row's entity
+		 */
+		Entity& getEntity(size_t row) const;
+
+		/**
+		 * \brief Gets the address of a stored component
+		 * \param column The component's column
+		 * \param row The component's row
+		 * \return The component's address
+		 */
+		void* getData(size_t column, size_t row) const;
+
+		/**
+		 * \brief Gets a stored component
+		 * \param column The component's column
+		 * \param row The component's row
+		 * \return A reference to the component
+		 */
+		Component& getComponent(size_t column, size_t row) const;
+
+		/**
+		 * \brief Finds the component of the given type in the given row
+		 * \param row The component's row
+		 * \return A pointer to the component. nullptr if the type isn't stored in the archetype
+		 */
+		template <RelocatableComponent T>
+		T* find(size_t row) const;
+
+		/**
+		 * \brief Gets the components of the given column in the given chunk
+		 * \param column The components' column. Must store T
+		 * \param chunk The chunk's index
+		 * \return The components contiguously stored in the chunk
+		 */
+		template <RelocatableComponent T>
+		std::span<T> getChunk(size_t column, size_t chunk) const;
+
+	private:
+		friend class ComponentStorage;
+
+		Signature								m_signature;
+		std::vector<const ComponentTypeInfo*>	m_types;
+		std::vector<size_t>						m_columnOffsets;
+		std::vector<std::byte*>					m_chunks;
+		std::vector<Entity*>					m_entities;
+		size_t									m_chunkCapacity = 1;
+		size_t									m_chunkBytes = 0;
+
+		// Archetypes reached by adding or removing a component type - saves the signature lookups
+		std::unordered_map<ComponentTypeId, Archetype*>	m_addEdges;
+		std::unordered_map<ComponentTypeId, Archetype*>	m_removeEdges;
+
+		/**
+		 * \brief Appends a row for the given entity, allocating a new chunk if needed.
+		 * The row's components are left uninitialized
+		 * \param entity The row's entity
+		 * \return The new row's index
+		 */
+		size_t pushRow(Entity& entity);
+
+		/**
+		 * \brief Removes the last row without touching its components (they must be uninitialized)
+		 */
+		void popRow() noexcept;
+
+		/**
+		 * \brief Removes the given row, whose components must have been destroyed or moved, by moving the last row into it.
+		 * The moved row's entity's component index is updated
+		 * \param row The row to remove
+		 * \return The entity whose row moved to the removed one. nullptr if the removed row was the last one
+		 */
+		Entity* swapRemove(size_t row) noexcept;
+	};
+}
+
+#include "Archetype.inl"
@@ -0,0 +1,22 @@
+#pragma once
+#include "Archetype.h"
+
+namespace LibGL
+{
+	template <RelocatableComponent T>
+	T* Archetype::find(const size_t row) const
+	{
+		const size_t column = findColumn(getComponentTypeId<T>());
+
+		if (column == INVALID_COLUMN)
+			return nullptr;
+
+		return static_cast<T*>(getData(column, row));
+	}
+
+	template <RelocatableComponent T>
+	std::span<T> Archetype::getChunk(const size_t column, const size_t chunk) const
+	{
+		return { reinterpret_cast<T*>(m_chunks[chunk] + m_columnOffsets[column]), getChunkSize(chunk) };
+	}
+}
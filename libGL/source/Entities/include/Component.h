@@ -1,15 +1,67 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ETickMode.h"
+#include "EUpdatePhase.h"
+#include "DataStructure/SlotMap.h"
 
 namespace LibGL
 {
+	class Component;
 	class Entity;
+	struct ComponentUpdateInfo;
+
+	typedef DataStructure::Handle<Entity> EntityHandle;
+	typedef DataStructure::Handle<Component> ComponentHandle;
+
+	/**
+	 * \brief A list of component types
+	 */
+	template <typename ... T>
+	struct ComponentTypeList {};
 
 	class Component
 	{
 	public:
 		typedef uint64_t ComponentId;
 
+		/**
+		 * \brief The base types through which the component can be looked up (see Entity::getComponents).
+		 * Derived types which should be looked up in place of their implementations redeclare it,
+		 * listing themselves followed by their base's list
+		 */
+		typedef ComponentTypeList<Component> LookupTypes;
+
+		/**
+		 * \brief The phase in which the component is updated by its scene (see UpdateScheduler)
+		 */
+		static constexpr EUpdatePhase UPDATE_PHASE = EUpdatePhase::LOGIC;
+
+		/**
+		 * \brief How often the component is updated by its scene.
+		 * Types which don't override update are never updated, whatever their tick mode
+		 */
+		static constexpr ETickMode TICK_MODE = ETickMode::PER_FRAME;
+
+		/**
+		 * \brief Whether the component's update can run on a worker thread.
+		 * Such components declare in UpdateReads and UpdateWrites the data they access besides their own state:
+		 * component types (including the ones of their owner) or LibMath::Transform for the entities' transforms.
+		 * Updates whose declarations don't conflict run concurrently. The other components are updated on the main thread,
+		 * while nothing else runs.
+		 * The components of a type are split between jobs when their update writes nothing but their own state, or their
+		 * owner's transform too (declared as a LibMath::Transform write), and doesn't read other components of their type.
+		 * Updates writing their owner's transform must not read other transforms, and are only split when the owners are
+		 * distinct and unrelated. The other types run as a single job
+		 */
+		static constexpr bool IS_THREAD_SAFE = false;
+		typedef ComponentTypeList<> UpdateReads;
+		typedef ComponentTypeList<> UpdateWrites;
+
 		Component(const Component& other);
 		Component(Component&& other) noexcept;
 
@@ -19,6 +71,21 @@ namespace LibGL
 		bool operator==(const Component&) const;
 		bool operator!=(const Component&) const;
 
+		/**
+		 * \brief Allocates a heap component from the object pools, or from the current arena (see Memory::ObjectAllocator).
+		 * Components kept in a ComponentStorage are constructed in place instead
+		 * \param size The component's size
+		 * \return A pointer to the component's memory
+		 */
+		static void* operator new(size_t size);
+
+		/**
+		 * \brief Gives the given component's memory back to its pool
+		 * \param component A pointer to the component's memory
+		 * \param size The component's size
+		 */
+		static void operator delete(void* component, size_t size);
+
 		virtual ~Component();
 
 		/**
@@ -38,28 +105,69 @@ namespace LibGL
 		 */
 		void setActive(bool active);
 
+		/**
+		 * \brief Checks whether the component is awake
+		 * \return True if the component wasn't put to sleep. False otherwise.
+		 */
+		bool isAwake() const;
+
+		/**
+		 * \brief Puts the component to sleep or wakes it up.
+		 * The scheduler only updates the components which are both active and awake, from the next phase on.
+		 * Sleeping components cost nothing per frame - they are usually woken up by an event.
+		 * An actual state change is logged for the scheduler, which only patches the changed components' entries
+		 * \param awake The component's new awake state
+		 */
+		void setAwake(bool awake);
+
 		/**
 		 * \brief Gets the component's id
 		 * \return The component's id
 		 */
 		ComponentId getId() const;
 
+		/**
+		 * \brief Gets the component's handle, which stays valid when the component is moved
+		 * \return The component's handle. A null handle for moved-from components
+		 */
+		ComponentHandle getHandle() const;
+
 		/**
 		 * \brief Gets the component's owner
 		 * \return A reference to the component's owner
 		 */
 		Entity& getOwner() const;
 
+		/**
+		 * \brief Gets the component referred to by the given handle
+		 * \param handle The component's handle
+		 * \return A pointer to the component. nullptr if it was destroyed
+		 */
+		static Component* find(ComponentHandle handle);
+
 	protected:
 		explicit Component(Entity& owner);
 
 	private:
 		friend class Entity;
-		inline static ComponentId s_currentId = 1;
+		friend class UpdateScheduler;
+		inline static ComponentId									s_currentId = 1;
+		inline static DataStructure::SlotMap<Component*, Component>	s_components;	// The address of every live component
+		inline static std::mutex									s_stateChangesMutex;
+		inline static std::vector<ComponentHandle>					s_stateChanges;	// The components activated, deactivated, put to sleep or woken up since the log was last trimmed
+		inline static std::atomic<uint64_t>							s_stateChangeCount = 0;	// The number of state changes logged so far
+
+		EntityHandle				m_owner;
+		ComponentHandle				m_handle;
+		ComponentId					m_id;
+		bool						m_isActive = true;
+		std::atomic<bool>			m_isAwake = true;
+		const ComponentUpdateInfo*	m_updateInfo = nullptr;	// Set when the component is added to its owner
 
-		Entity&		m_owner;
-		ComponentId	m_id;
-		bool		m_isActive = true;
+		/**
+		 * \brief Logs a change of the component's active or awake state for the update schedulers
+		 */
+		void logStateChange() const;
 
 		/**
 		 * \brief The action to perform when the components gets enabled
@@ -70,5 +178,11 @@ namespace LibGL
 		 * \brief The action to perform when the components gets disabled
 		 */
 		virtual void onDisable() {}
+
+		/**
+		 * \brief The action to perform when the owner's global transform gets outdated.
+		 * The new global transform isn't resolved yet
+		 */
+		virtual void onOwnerTransformChange() {}
 	};
 }
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include "ComponentType.h"
+
+namespace LibGL
+{
+	/**
+	 * \brief Non owning range over the components of an entity matching a lookup type.
+	 * Invalidated when a component is added to or removed from the entity
+	 */
+	template <LookupComponent T>
+	class ComponentView
+	{
+	public:
+		class Iterator
+		{
+		public:
+			typedef std::forward_iterator_tag	iterator_category;
+			typedef T*							value_type;
+			typedef std::ptrdiff_t				difference_type;
+
+			Iterator() = default;
+			explicit Iterator(Component* const* component);
+
+			T*			operator*() const;
+			Iterator&	operator++();
+			Iterator	operator++(int);
+
+			bool		operator==(const Iterator& other) const = default;
+
+		private:
+			Component* const*	m_component = nullptr;
+		};
+
+		ComponentView() = default;
+		explicit ComponentView(std::span<Component* const> components);
+
+		Iterator	begin() const;
+		Iterator	end() const;
+
+		/**
+		 * \brief Gets the component at the given index
+		 * \param index The component's index. Must be lower than size()
+		 * \return A pointer to the component
+		 */
+		T*			operator[](size_t index) const;
+
+		size_t		size() const;
+		bool		empty() const;
+
+	private:
+		std::span<Component* const>	m_components;
+	};
+
+	/**
+	 * \brief Maps each lookup type to the components of an entity deriving from it, in insertion order.
+	 * A component is listed in the bucket of its own type and of each type of its LookupTypes,
+	 * so typed lookups are an array access instead of a dynamic_cast per component
+	 */
+	class ComponentIndex
+	{
+	public:
+		/**
+		 * \brief Adds the given component to the buckets of the given types
+		 * \param component The component to add
+		 * \param lookupTypes The component's lookup types (see getComponentLookupTypes)
+		 */
+		void add(Component& component, std::span<const ComponentTypeId> lookupTypes);
+
+		/**
+		 * \brief Removes the given component from every bucket
+		 * \param component The component to remove
+		 */
+		void remove(const Component& component);
+
+		/**
+		 * \brief Replaces the given component's address after it was moved
+		 * \param from The component's previous address
+		 * \param to The component's new address
+		 */
+		void relocate(const Component& from, Component& to);
+
+		/**
+		 * \brief Gets the components deriving from the given lookup type
+		 * \param type The lookup type's id
+		 * \return The matching components, in insertion order
+		 */
+		std::span<Component* const> find(ComponentTypeId type) const;
+
+		/**
+		 * \brief Finds the component with the given id
+		 * \param id The component's id
+		 * \return A pointer to the component. nullptr if it isn't in the index
+		 */
+		Component* find(Component::ComponentId id) const;
+
+	private:
+		std::vector<std::vector<Component*>>	m_buckets;
+		std::vector<uint16_t>					m_bucketIndices;	// Bucket index + 1 of each type id. 0 if the type has no bucket
+	};
+}
+
+#include "ComponentIndex.inl"
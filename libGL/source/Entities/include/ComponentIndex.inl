@@ -0,0 +1,67 @@
+#pragma once
+#include "ComponentIndex.h"
+
+namespace LibGL
+{
+	template <LookupComponent T>
+	ComponentView<T>::Iterator::Iterator(Component* const* component) : m_component(component)
+	{
+	}
+
+	template <LookupComponent T>
+	T* ComponentView<T>::Iterator::operator*() const
+	{
+		// The index only lists a component in the buckets of its base types - no need for a dynamic_cast
+		return static_cast<T*>(*m_component);
+	}
+
+	template <LookupComponent T>
+	typename ComponentView<T>::Iterator& ComponentView<T>::Iterator::operator++()
+	{
+		++m_component;
+		return *this;
+	}
+
+	template <LookupComponent T>
+	typename ComponentView<T>::Iterator ComponentView<T>::Iterator::operator++(int)
+	{
+		Iterator copy = *this;
+		++m_component;
+		return copy;
+	}
+
+	template <LookupComponent T>
+	ComponentView<T>::ComponentView(const std::span<Component* const> components) : m_components(components)
+	{
+	}
+
+	template <LookupComponent T>
+	typename ComponentView<T>::Iterator ComponentView<T>::begin() const
+	{
+		return Iterator(m_components.data());
+	}
+
+	template <LookupComponent T>
+	typename ComponentView<T>::Iterator ComponentView<T>::end() const
+	{
+		return Iterator(m_components.data() + m_components.size());
+	}
+
+	template <LookupComponent T>
+	T* ComponentView<T>::operator[](const size_t index) const
+	{
+		return static_cast<T*>(m_components[index]);
+	}
+
+	template <LookupComponent T>
+	size_t ComponentView<T>::size() const
+	{
+		return m_components.size();
+	}
+
+	template <LookupComponent T>
+	bool ComponentView<T>::empty() const
+	{
+		return m_components.empty();
+	}
+}
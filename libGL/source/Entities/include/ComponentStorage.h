@@ -0,0 +1,154 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Archetype.h"
+
+namespace LibGL
+{
+	class Entity;
+
+	/**
+	 * \brief Archetype based storage for the relocatable components of the entities using it, such as a scene's entities
+	 * (see Entity::setComponentStorage).
+	 * Entities with the same set of relocatable component types share an archetype, which lets systems
+	 * iterate over dense arrays of components instead of chasing one heap allocation per component.
+	 * Adding or removing a component moves the entity to another archetype, which invalidates
+	 * the addresses of its relocatable components and of the components of the archetypes' last rows.
+	 * The owners' component indices are kept up to date with these moves.
+	 */
+	class ComponentStorage
+	{
+	public:
+		ComponentStorage() = default;
+		ComponentStorage(const ComponentStorage& other) = delete;
+		ComponentStorage(ComponentStorage&& other) = delete;
+
+		/**
+		 * \brief Destroys the stored components and detaches the entities still using the storage
+		 */
+		~ComponentStorage();
+
+		ComponentStorage& operator=(const ComponentStorage& other) = delete;
+		ComponentStorage& operator=(ComponentStorage&& other) = delete;
+
+		/**
+		 * \brief Adds a component of the given type to the given entity's archetype row
+		 * \param entity The component's owner. Must use this storage and not have a component of the same type in it
+		 * \param args The component's constructor's parameters (after the owner)
+		 * \return A reference to the added component, valid until the next structural change
+		 * \throw std::logic_error if called while iterating over the storage
+		 */
+		template <RelocatableComponent T, typename ... Args>
+		T& addComponent(Entity& entity, Args&&... args);
+
+		/**
+		 * \brief Destroys the given entity's component of the given type
+		 * \param entity The component's owner
+		 * \param type The type of the component to destroy
+		 * \throw std::logic_error if called while iterating over the storage
+		 */
+		void removeComponent(Entity& entity, ComponentTypeId type);
+
+		/**
+		 * \brief Destroys all of the given entity's stored components
+		 * \param entity The entity whose components should be destroyed
+		 * \throw std::logic_error if called while iterating over the storage
+		 */
+		void removeEntity(Entity& entity);
+
+		/**
+		 * \brief Calls the given function with the components of every entity having all the given types
+		 * \param func The function to call - void(T&...)
+		 */
+		template <RelocatableComponent ... T, typename Func>
+		void forEach(Func func);
+
+		/**
+		 * \brief Calls the given function with the arrays of components of every chunk whose entities have all the given types.
+		 * The arrays of a call have the same size and the same index refers to the same entity
+		 * \param func The function to call - void(std::span<T>...)
+		 */
+		template <RelocatableComponent ... T, typename Func>
+		void forEachChunk(Func func);
+
+		/**
+		 * \brief Gets the number of archetypes created so far
+		 * \return The storage's archetype count
+		 */
+		size_t getArchetypeCount() const;
+
+	private:
+		friend class Entity;
+
+		/**
+		 * \brief Forbids structural changes while the storage is iterated over
+		 */
+		class IterationGuard
+		{
+		public:
+			explicit IterationGuard(ComponentStorage& storage);
+			IterationGuard(const IterationGuard& other) = delete;
+			~IterationGuard();
+
+			IterationGuard& operator=(const IterationGuard& other) = delete;
+
+		private:
+			ComponentStorage&	m_storage;
+		};
+
+		std::vector<std::unique_ptr<Archetype>>		m_archetypes;
+		std::map<Archetype::Signature, Archetype*>	m_archetypesBySignature;
+		uint32_t									m_iterationDepth = 0;
+
+		/**
+		 * \brief Moves the given entity to the archetype including the given type
+		 * \param entity The entity to which a component is added
+		 * \param type The added component's type
+		 * \return The uninitialized memory in which the component should be move constructed
+		 */
+		void* insertComponent(Entity& entity, const ComponentTypeInfo& type);
+
+		/**
+		 * \brief Registers a newly stored component to its owner (see Entity::registerComponent)
+		 * \param entity The component's owner
+		 * \param component The stored component
+		 * \param lookupTypes The component's lookup types
+		 * \param updateInfo How components of the component's type are updated
+		 */
+		static void registerComponent(Entity& entity, Component& component, std::span<const ComponentTypeId> lookupTypes,
+			const ComponentUpdateInfo& updateInfo);
+
+		/**
+		 * \brief Finds or creates the archetype storing the given component types
+		 * \param types The archetype's component types
+		 * \return The matching archetype
+		 */
+		Archetype& getArchetype(std::vector<const ComponentTypeInfo*> types);
+
+		/**
+		 * \brief Moves the given entity's row to the given row of the target archetype.
+		 * The components whose type isn't in the target archetype must have been destroyed or moved
+		 * \param entity The entity to move
+		 * \param target The entity's new archetype. nullptr if it no longer has stored components
+		 * \param targetRow The row reserved for the entity in the target archetype
+		 */
+		void moveRow(Entity& entity, Archetype* target, size_t targetRow) noexcept;
+
+		/**
+		 * \brief Gives the given source entity's row to the given destination entity
+		 * \param source The entity whose row is transferred
+		 * \param destination The entity receiving the row
+		 */
+		void transferRow(Entity& source, Entity& destination) noexcept;
+
+		/**
+		 * \brief Throws if the storage is being iterated over
+		 * \throw std::logic_error if the storage is being iterated over
+		 */
+		void checkStructuralChange() const;
+	};
+}
+
+#include "ComponentStorage.inl"
@@ -0,0 +1,68 @@
+#pragma once
+#include <utility>
+
+#include "ComponentStorage.h"
+
+namespace LibGL
+{
+	template <RelocatableComponent T, typename ... Args>
+	T& ComponentStorage::addComponent(Entity& entity, Args&&... args)
+	{
+		static_assert(alignof(T) <= Archetype::CHUNK_ALIGNMENT);
+
+		// Constructed before touching the archetypes so the constructor sees the entity in a consistent state
+		T component(entity, std::forward<Args>(args)...);
+
+		void* data = insertComponent(entity, getComponentTypeInfo<T>());
+		T* storedComponent = ::new (data) T(std::move(component));
+
+		registerComponent(entity, *storedComponent, getComponentLookupTypes<T>(), getComponentUpdateInfo<T>());
+
+		return *storedComponent;
+	}
+
+	template <RelocatableComponent ... T, typename Func>
+	void ComponentStorage::forEach(Func func)
+	{
+		forEachChunk<T...>([&func](const std::span<T>... chunks)
+		{
+			const size_t count = (chunks.size(), ...);
+
+			for (size_t i = 0; i < count; i++)
+				func(chunks[i]...);
+		});
+	}
+
+	template <RelocatableComponent ... T, typename Func>
+	void ComponentStorage::forEachChunk(Func func)
+	{
+		static_assert(sizeof...(T) > 0);
+
+		IterationGuard guard(*this);
+
+		const ComponentTypeId types[] = { getComponentTypeId<T>()... };
+
+		for (const std::unique_ptr<Archetype>& archetype : m_archetypes)
+		{
+			size_t columns[sizeof...(T)];
+			bool hasAllTypes = true;
+
+			for (size_t i = 0; i < sizeof...(T); i++)
+			{
+				columns[i] = archetype->findColumn(types[i]);
+				hasAllTypes &= columns[i] != Archetype::INVALID_COLUMN;
+			}
+
+			if (!hasAllTypes)
+				continue;
+
+			for (size_t chunk = 0; chunk < archetype->getChunkCount(); chunk++)
+			{
+				[&]<size_t... I>(std::index_sequence<I...>)
+				{
+					func(archetype->template getChunk<T>(columns[I], chunk)...);
+				}(std::index_sequence_for<T...>{});
+			}
+		}
+	}
+}
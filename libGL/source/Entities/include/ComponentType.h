@@ -0,0 +1,142 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Component.h"
+
+namespace LibGL
+{
+	typedef uint32_t ComponentTypeId;
+
+	/**
+	 * \brief A component type which can be stored in an archetype (see ComponentStorage).
+	 * Such components opt in with a "static constexpr bool IS_RELOCATABLE = true" member.
+	 * They are moved in memory whenever their owner's component set changes, so they must not
+	 * hand out their address - their handle follows them instead (see Component::getHandle)
+	 */
+	template <typename T>
+	concept RelocatableComponent = std::derived_from<T, Component> && std::is_nothrow_move_constructible_v<T>
+		&& requires { requires T::IS_RELOCATABLE; };
+
+	namespace Detail
+	{
+		template <typename T, typename ... Listed>
+		constexpr bool isListed(ComponentTypeList<Listed...>)
+		{
+			return (std::is_same_v<T, Listed> || ...);
+		}
+
+		/**
+		 * \brief Checks whether the given type overrides Component::update.
+		 * An inaccessible update can't be Component's public one
+		 */
+		template <typename T>
+		constexpr bool overridesUpdate()
+		{
+			if constexpr (requires { &T::update; })
+				return !std::is_same_v<decltype(&T::update), void (Component::*)()>;
+			else
+				return true;
+		}
+	}
+
+	/**
+	 * \brief A component type which can be looked up through Entity::getComponent(s).
+	 * Non final types must be listed in their own LookupTypes, otherwise their derived types wouldn't be found
+	 */
+	template <typename T>
+	concept LookupComponent = std::derived_from<T, Component>
+		&& (std::is_final_v<T> || Detail::isListed<T>(typename T::LookupTypes{}));
+
+	/**
+	 * \brief The type erased operations needed to store components of a given type in raw memory
+	 */
+	struct ComponentTypeInfo
+	{
+		ComponentTypeId	m_id;
+		size_t			m_size;
+		size_t			m_alignment;
+
+		void			(*m_moveConstruct)(void* destination, void* source) noexcept;
+		void			(*m_destroy)(void* component) noexcept;
+		Component&		(*m_toComponent)(void* component) noexcept;
+	};
+
+	/**
+	 * \brief How the scheduler updates the components of a given type (see Component::UPDATE_PHASE)
+	 */
+	struct ComponentUpdateInfo
+	{
+		ComponentTypeId					m_typeId;
+		const char*						m_typeName;
+		EUpdatePhase					m_phase;
+		bool							m_isTicked;		// False for ETickMode::ON_EVENT types, which are never updated
+		bool							m_isThreadSafe;
+		bool							m_isParallel;	// Whether components of the type with distinct, unrelated owners can be updated at once
+		std::vector<ComponentTypeId>	m_reads;		// Ids of the data read by the update (see getUpdateAccessIds)
+		std::vector<ComponentTypeId>	m_writes;		// Ids of the data written by the update, the type's own included
+
+		/**
+		 * \brief Checks whether updates of this type and of the given one can run at the same time
+		 * \param other The other component type
+		 * \return True if one of the updates writes data the other accesses. False otherwise.
+		 */
+		bool conflictsWith(const ComponentUpdateInfo& other) const;
+	};
+
+	/**
+	 * \brief Gets the unique id of the given component type.
+	 * Ids are assigned on first use so they are only valid for the current run
+	 * \return The component type's id
+	 */
+	template <typename T>
+	ComponentTypeId getComponentTypeId();
+
+	/**
+	 * \brief Gets the ids of the types through which a component of the given type can be looked up:
+	 * its own type followed by the ones listed in its LookupTypes
+	 * \return The component type's lookup type ids
+	 */
+	template <typename T>
+	std::span<const ComponentTypeId> getComponentLookupTypes();
+
+	/**
+	 * \brief Gets the ids of the data designated by the given types in an update declaration.
+	 * A component type designates itself and the types of its LookupTypes, except Component
+	 * \return The designated data ids
+	 */
+	template <typename ... T>
+	std::vector<ComponentTypeId> getUpdateAccessIds(ComponentTypeList<T...>);
+
+	/**
+	 * \brief Gets the id designating the entities' transforms in update declarations (see Component::IS_THREAD_SAFE)
+	 * \return The id of LibMath::Transform
+	 */
+	ComponentTypeId getTransformAccessId();
+
+	/**
+	 * \brief Gets how the components of the given type are updated, from its update declarations
+	 * \return The component type's update information
+	 */
+	template <typename T>
+	const ComponentUpdateInfo& getComponentUpdateInfo();
+
+	/**
+	 * \brief Gets the type erased operations of the given relocatable component type
+	 * \return The component type's information
+	 */
+	template <RelocatableComponent T>
+	const ComponentTypeInfo& getComponentTypeInfo();
+
+	/**
+	 * \brief Reserves a new component type id
+	 * \return The reserved id
+	 */
+	ComponentTypeId nextComponentTypeId();
+}
+
+#include "ComponentType.inl"
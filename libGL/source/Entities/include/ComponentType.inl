@@ -0,0 +1,166 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <new>
+#include <typeinfo>
+#include <utility>
+
+#include "ComponentType.h"
+
+namespace LibGL
+{
+	template <typename T>
+	ComponentTypeId getComponentTypeId()
+	{
+		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
+
+		static const ComponentTypeId id = nextComponentTypeId();
+		return id;
+	}
+
+	namespace Detail
+	{
+		template <typename T, typename ... Listed>
+		std::span<const ComponentTypeId> getLookupTypes(ComponentTypeList<Listed...> list)
+		{
+			static_assert((std::is_base_of_v<Listed, T> && ...));
+
+			if constexpr (isListed<T>(list))
+			{
+				static const std::array<ComponentTypeId, sizeof...(Listed)> ids{ getComponentTypeId<Listed>()... };
+				return ids;
+			}
+			else
+			{
+				static const std::array<ComponentTypeId, sizeof...(Listed) + 1> ids{ getComponentTypeId<T>(), getComponentTypeId<Listed>()... };
+				return ids;
+			}
+		}
+	}
+
+	template <typename T>
+	std::span<const ComponentTypeId> getComponentLookupTypes()
+	{
+		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
+
+		return Detail::getLookupTypes<T>(typename T::LookupTypes{});
+	}
+
+	namespace Detail
+	{
+		template <typename T>
+		void appendUpdateAccessIds(std::vector<ComponentTypeId>& ids)
+		{
+			static_assert(!std::is_same_v<T, Component>, "Update declarations must list the accessed component types");
+
+			if constexpr (std::is_base_of_v<Component, T>)
+			{
+				for (const ComponentTypeId id : getComponentLookupTypes<T>())
+				{
+					if (id != getComponentTypeId<Component>())
+						ids.push_back(id);
+				}
+			}
+			else
+			{
+				// Not a component (e.g. LibMath::Transform) - only needs a unique id
+				static const ComponentTypeId id = nextComponentTypeId();
+				ids.push_back(id);
+			}
+		}
+	}
+
+	template <typename ... T>
+	std::vector<ComponentTypeId> getUpdateAccessIds(ComponentTypeList<T...>)
+	{
+		std::vector<ComponentTypeId> ids;
+		(Detail::appendUpdateAccessIds<T>(ids), ...);
+
+		std::ranges::sort(ids);
+		const auto duplicates = std::ranges::unique(ids);
+		ids.erase(duplicates.begin(), duplicates.end());
+
+		return ids;
+	}
+
+	template <typename T>
+	const ComponentUpdateInfo& getComponentUpdateInfo()
+	{
+		static_assert(T::UPDATE_PHASE != EUpdatePhase::TRANSFORM, "No component is updated in the transform phase");
+		static_assert(!T::IS_THREAD_SAFE || T::UPDATE_PHASE != EUpdatePhase::RENDER, "The render phase runs on the main thread");
+		static_assert(T::TICK_MODE != ETickMode::FIXED_STEP || T::UPDATE_PHASE == EUpdatePhase::LOGIC
+			|| T::UPDATE_PHASE == EUpdatePhase::PHYSICS, "Fixed step components are updated in the physics phase");
+
+		// Updating a type which doesn't override update would be a no-op call
+		constexpr bool overridesUpdate = std::is_same_v<T, Component> || Detail::overridesUpdate<T>();
+
+		static const ComponentUpdateInfo info = []
+		{
+			ComponentUpdateInfo updateInfo
+			{
+				getComponentTypeId<T>(),
+				typeid(T).name(),
+				T::TICK_MODE == ETickMode::FIXED_STEP ? EUpdatePhase::PHYSICS : T::UPDATE_PHASE,
+				overridesUpdate && T::TICK_MODE != ETickMode::ON_EVENT,
+				T::IS_THREAD_SAFE,
+				false,
+				getUpdateAccessIds(typename T::UpdateReads{}),
+				getUpdateAccessIds(typename T::UpdateWrites{})
+			};
+
+			// Components only write their own state unless they declare more
+			std::vector<ComponentTypeId> ownIds;
+
+			for (const ComponentTypeId id : getComponentLookupTypes<T>())
+			{
+				if (id != getComponentTypeId<Component>())
+					ownIds.push_back(id);
+			}
+
+			// Writing a transform only writes the owner's subtree, which the scheduler keeps disjoint between jobs
+			const bool writesTransforms = std::ranges::binary_search(updateInfo.m_writes, getTransformAccessId());
+			const bool readsTransforms = std::ranges::binary_search(updateInfo.m_reads, getTransformAccessId());
+
+			updateInfo.m_isParallel = updateInfo.m_isThreadSafe &&
+				updateInfo.m_writes.size() == (writesTransforms ? 1 : 0) && !(writesTransforms && readsTransforms) &&
+				std::ranges::none_of(ownIds, [&updateInfo](const ComponentTypeId id)
+				{
+					return std::ranges::binary_search(updateInfo.m_reads, id);
+				});
+
+			updateInfo.m_writes.insert(updateInfo.m_writes.end(), ownIds.begin(), ownIds.end());
+			std::ranges::sort(updateInfo.m_writes);
+			const auto duplicates = std::ranges::unique(updateInfo.m_writes);
+			updateInfo.m_writes.erase(duplicates.begin(), duplicates.end());
+
+			return updateInfo;
+		}();
+
+		return info;
+	}
+
+	template <RelocatableComponent T>
+	const ComponentTypeInfo& getComponentTypeInfo()
+	{
+		static const ComponentTypeInfo info
+		{
+			getComponentTypeId<T>(),
+			sizeof(T),
+			alignof(T),
+			[](void* destination, void* source) noexcept
+			{
+				::new (destination) T(std::move(*static_cast<T*>(source)));
+			},
+			[](void* component) noexcept
+			{
+				static_cast<T*>(component)->~T();
+			},
+			[](void* component) noexcept -> Component&
+			{
+				return *static_cast<T*>(component);
+			}
+		};
+
+		return info;
+	}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace LibGL
+{
+	/**
+	 * \brief How often the scheduler updates a component type (see Component::TICK_MODE)
+	 */
+	enum class ETickMode
+	{
+		PER_FRAME,	// Once per frame, in the type's update phase
+		FIXED_STEP,	// Once per fixed step, in the physics phase (implied by EUpdatePhase::PHYSICS)
+		ON_EVENT	// Never - the components only react to events. Implied for types which don't override update
+	};
+}
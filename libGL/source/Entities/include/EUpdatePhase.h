@@ -0,0 +1,16 @@
+#pragma once
+
+namespace LibGL
+{
+	/**
+	 * \brief The steps of a scene's frame, in execution order (see UpdateScheduler)
+	 */
+	enum class EUpdatePhase
+	{
+		INPUT,		// Components turning the input into intentions (e.g. character controllers)
+		LOGIC,		// Gameplay components
+		PHYSICS,	// Run zero or more times per frame, once per fixed step (see Utility::Timer::startFixedStep)
+		TRANSFORM,	// The scene resolves the outdated global transforms - no component runs in this phase
+		RENDER		// Main thread only. The entities submit their draw calls afterwards (see Entity::render)
+	};
+}
@@ -3,6 +3,8 @@
 
 #include "Transform.h"
 #include "Component.h"
+#include "ComponentIndex.h"
+#include "ComponentStorage.h"
 #include "DataStructure/Node.h"
 
 namespace LibGL
@@ -13,7 +15,7 @@ namespace LibGL
 		typedef std::vector<ComponentPtr> ComponentList;
 
 	public:
-		Entity() = default;
+		Entity();
 		Entity(Node* parent, const Transform& transform);
 		Entity(const Entity& other);
 		Entity(Entity&& other) noexcept;
@@ -23,57 +25,147 @@ namespace LibGL
 		Entity& operator=(Entity&& other) noexcept;
 
 		/**
-		 * \brief Gets the entity's global transformation matrix
+		 * \brief Gets the entity's handle, which stays valid when the entity is moved
+		 * \return The entity's handle. A null handle for moved-from entities
+		 */
+		EntityHandle getHandle() const;
+
+		/**
+		 * \brief Gets the entity referred to by the given handle
+		 * \param handle The entity's handle
+		 * \return A pointer to the entity. nullptr if it was destroyed
+		 */
+		static Entity* find(EntityHandle handle);
+
+		/**
+		 * \brief Gets the entity's global transformation matrix.
+		 * Outdated global transforms are resolved once per frame by the scene (see TransformHierarchy),
+		 * or on demand if read before that
 		 * \return The entity's global transformation matrix
 		 */
 		Transform getGlobalTransform() const;
 
 		/**
-		 * \brief Adds a component of the given type to the entity
+		 * \brief Makes the entity keep its relocatable components in the given storage's archetypes.
+		 * Children created afterwards use the same storage
+		 * \param storage The storage to use. nullptr to keep every component on the heap
+		 * \throw std::logic_error if the entity already has components in another storage
+		 */
+		void setComponentStorage(ComponentStorage* storage);
+
+		/**
+		 * \brief Gets the storage in which the entity keeps its relocatable components
+		 * \return A pointer to the entity's component storage. nullptr if the entity doesn't use one
+		 */
+		ComponentStorage* getComponentStorage() const;
+
+		/**
+		 * \brief Adds a component of the given type to the entity.
+		 * Relocatable components go to the entity's component storage if it has one (and no component of the same type in it)
+		 * in which case the returned reference is only valid until the storage's next structural change
 		 * \param args The component's constructor's parameters
 		 * \return A reference to the added component
 		 */
 		template <typename T, typename ... Args>
 		T& addComponent(Args&&... args);
 
-		template <typename T>
+		template <LookupComponent T>
 		void removeComponent();
 
 		void removeComponent(const Component& component);
 
 		void removeComponent(Component::ComponentId id);
 
-		template <typename T>
+		/**
+		 * \brief Gets the first added component deriving from the given type, in constant time
+		 * \return A pointer to the component. nullptr if the entity has none
+		 */
+		template <LookupComponent T>
 		T* getComponent();
 
-		template <typename T>
+		/**
+		 * \brief Gets the component deriving from the given type with the given id
+		 * \param id The component's id
+		 * \return A pointer to the component. nullptr if the entity has no such component
+		 */
+		template <LookupComponent T>
 		T* getComponent(Component::ComponentId id);
 
-		template <typename T>
-		std::vector<T*> getComponents();
-
 		/**
-		 * \brief Removes the given node from this node's children
-		 * \param child A pointer to the child to remove from the node's children
+		 * \brief Gets every component deriving from the given type, in insertion order
+		 * \return A view over the matching components, invalidated when a component is added or removed
 		 */
-		void removeChild(Node& child) override;
+		template <LookupComponent T>
+		ComponentView<T> getComponents();
 
 		/**
-		 * \brief Updates the entity (does nothing by default)
+		 * \brief Updates the entity's heap allocated components, then its children.
+		 * Scenes don't call it - their components are updated by phase (see UpdateScheduler)
 		 */
 		virtual void update();
 
+		/**
+		 * \brief Renders the entity, then its children.
+		 * Called on the main thread once the frame's global transforms are resolved
+		 */
+		virtual void render();
+
 	protected:
 		/**
-		 * \brief Updates the entity's transformation matrices
+		 * \brief Marks the entity's and its descendants' global transforms as outdated
 		 */
 		void onChange() override;
 
+		/**
+		 * \brief Marks the hierarchy as changed and the entity's global transform as outdated
+		 */
+		void onParentChange() override;
+
+		/**
+		 * \brief The action to perform when the entity's global transform gets outdated.
+		 * The new global transform isn't resolved yet
+		 */
+		virtual void onGlobalTransformChange() {}
+
 	private:
-		ComponentList	m_components;
-		Transform		m_globalTransform;
+		friend class Archetype;
+		friend class ComponentStorage;
+		friend class TransformHierarchy;
+		friend class UpdateScheduler;
+
+		inline static uint64_t									s_hierarchyVersion = 1;		// Incremented whenever an entity is created, destroyed or reassigned
+		inline static uint64_t									s_componentsVersion = 1;	// Incremented whenever a component is added, removed or relocated
+		inline static DataStructure::SlotMap<Entity*, Entity>	s_entities;					// The address of every live entity
+
+		EntityHandle		m_handle;
+		ComponentList		m_components;
+		ComponentIndex		m_componentIndex;
+		mutable Transform	m_globalTransform;
+		mutable bool		m_isGlobalTransformDirty = true;
+		ComponentStorage*	m_componentStorage = nullptr;
+		Archetype*			m_archetype = nullptr;
+		size_t				m_archetypeRow = 0;
 
-		void updateGlobalTransform();
+		/**
+		 * \brief Indexes a newly added component and records how it should be updated
+		 * \param component The added component
+		 * \param lookupTypes The component's lookup types
+		 * \param updateInfo How components of the component's type are updated
+		 */
+		void registerComponent(Component& component, std::span<const ComponentTypeId> lookupTypes,
+			const ComponentUpdateInfo& updateInfo);
+
+		/**
+		 * \brief Marks the entity's global transform and its descendants' as outdated, notifying their components.
+		 * Stops at the already outdated entities since their descendants are outdated too
+		 */
+		void invalidateGlobalTransform();
+
+		/**
+		 * \brief Recomputes the entity's global transform from its parent's if it is outdated
+		 * \return The entity's up to date global transform
+		 */
+		const Transform& resolveGlobalTransform() const;
 	};
 }
 
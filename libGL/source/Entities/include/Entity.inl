@@ -10,67 +10,59 @@ namespace LibGL
 	{
 		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
 
-		m_components.push_back(new T(*this, args...));
+		if constexpr (RelocatableComponent<T>)
+		{
+			// An archetype row holds a single component of each type - the others stay on the heap
+			if (m_componentStorage != nullptr &&
+				(m_archetype == nullptr || m_archetype->findColumn(getComponentTypeId<T>()) == Archetype::INVALID_COLUMN))
+			{
+				return m_componentStorage->addComponent<T>(*this, std::forward<Args>(args)...);
+			}
+		}
+
+		T* component = new T(*this, args...);
+
+		m_components.push_back(component);
+		registerComponent(*component, getComponentLookupTypes<T>(), getComponentUpdateInfo<T>());
 
-		return static_cast<T&>(*m_components.back());
+		return *component;
 	}
 
-	template <typename T>
+	template <LookupComponent T>
 	void Entity::removeComponent()
 	{
-		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
-
 		const T* firstComponent = getComponent<T>();
 
 		if (nullptr != firstComponent)
 			removeComponent(*firstComponent);
 	}
 
-	template <typename T>
+	template <LookupComponent T>
 	T* Entity::getComponent()
 	{
-		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
+		const std::span<Component* const> components = m_componentIndex.find(getComponentTypeId<T>());
 
-		for (const auto& component : m_components)
-		{
-			if (typeid(component) == typeid(T*) || dynamic_cast<T*>(component) != nullptr)
-				return dynamic_cast<T*>(component);
-		}
+		if (components.empty())
+			return nullptr;
 
-		return nullptr;
+		return static_cast<T*>(components.front());
 	}
 
-	template <typename T>
+	template <LookupComponent T>
 	T* Entity::getComponent(const Component::ComponentId id)
 	{
-		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
-
-		for (const auto& component : m_components)
+		for (Component* component : m_componentIndex.find(getComponentTypeId<T>()))
 		{
-			if (id == component->getId() &&
-				(typeid(component) == typeid(T*) ||
-					dynamic_cast<T*>(component) != nullptr))
-			{
-				return dynamic_cast<T*>(component);
-			}
+			if (id == component->getId())
+				return static_cast<T*>(component);
 		}
 
 		return nullptr;
 	}
 
-	template <typename T>
-	std::vector<T*> Entity::getComponents()
+	template <LookupComponent T>
+	ComponentView<T> Entity::getComponents()
 	{
-		static_assert(std::is_same_v<Component, T> || std::is_base_of_v<Component, T>);
-
-		std::vector<T*> components;
-
-		for (const auto& component : m_components)
-		{
-			if (typeid(component) == typeid(T*) || dynamic_cast<T*>(component) != nullptr)
-				components.push_back(dynamic_cast<T*>(component));
-		}
-
-		return components;
+		return ComponentView<T>(m_componentIndex.find(getComponentTypeId<T>()));
 	}
 }
@@ -1,5 +1,8 @@
 #pragma once
+#include "ComponentStorage.h"
 #include "Entity.h"
+#include "StructuralCommandBuffer.h"
+#include "UpdateScheduler.h"
 #include "DataStructure/Graph.h"
 
 namespace LibGL::Resources
@@ -7,6 +10,59 @@ namespace LibGL::Resources
 	class Scene : public DataStructure::Graph<Entity>
 	{
 	public:
+		Scene();
+		Scene(const Scene& other) = delete;
+		Scene(Scene&& other) = delete;
+
+		/**
+		 * \brief Destroys the scene's entities before the component storage they may use
+		 */
+		~Scene() override;
+
+		Scene& operator=(const Scene& other) = delete;
+		Scene& operator=(Scene&& other) = delete;
+
+		/**
+		 * \brief Gets the archetype storage shared by the scene's entities, in which they keep their relocatable components
+		 * (see Entity::setComponentStorage)
+		 * \return A reference to the scene's component storage
+		 */
+		ComponentStorage& getComponentStorage();
+
+		/**
+		 * \brief Gets the buffer in which to record the structural changes to make to the scene during its update.
+		 * The changes are applied between the update phases
+		 * \return A reference to the scene's command buffer
+		 */
+		StructuralCommandBuffer& getCommands();
+
+		/**
+		 * \brief Gets the scheduler running the scene's updates, e.g. to read its update counters
+		 * \return A reference to the scene's update scheduler
+		 */
+		UpdateScheduler& getUpdateScheduler();
+
+		/**
+		 * \brief Runs a frame of the scene: updates its components phase by phase, resolves the global transforms
+		 * they changed and renders its entities (see UpdateScheduler::update)
+		 */
 		virtual void update();
+
+		/**
+		 * \brief Resolves the outdated global transforms of the scene's entities in a single pass
+		 */
+		void updateTransforms();
+
+	protected:
+		/**
+		 * \brief Makes the added root entity, and the children it gets afterwards, use the scene's component storage
+		 * \param node The added root entity
+		 */
+		void onNodeAdded(Entity& node) override;
+
+	private:
+		ComponentStorage		m_componentStorage;
+		StructuralCommandBuffer	m_commands;
+		UpdateScheduler			m_updateScheduler;
 	};
 }
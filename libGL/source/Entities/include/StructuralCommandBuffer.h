@@ -0,0 +1,100 @@
+#pragma once
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Entity.h"
+#include "DataStructure/Graph.h"
+
+namespace LibGL
+{
+	/**
+	 * \brief Records structural changes to a hierarchy (entities and components added, removed or moved)
+	 * to apply them later at a sync point, when nothing iterates over the hierarchy.
+	 * Scenes apply their buffer after each update phase (see UpdateScheduler).
+	 * Entities and components are referred to by handle, so changes targeting something destroyed in the meantime
+	 * are dropped. Recording is thread safe, so thread safe updates can record changes too
+	 */
+	class StructuralCommandBuffer
+	{
+	public:
+		/**
+		 * \brief Creates an empty command buffer for the given hierarchy
+		 * \param graph The hierarchy whose roots the commands may change
+		 */
+		explicit StructuralCommandBuffer(DataStructure::Graph<Entity>& graph);
+		StructuralCommandBuffer(const StructuralCommandBuffer& other) = delete;
+		StructuralCommandBuffer(StructuralCommandBuffer&& other) = delete;
+		~StructuralCommandBuffer() = default;
+
+		StructuralCommandBuffer& operator=(const StructuralCommandBuffer& other) = delete;
+		StructuralCommandBuffer& operator=(StructuralCommandBuffer&& other) = delete;
+
+		/**
+		 * \brief Records the creation of an entity of the given type
+		 * \param parent The new entity's parent. nullptr to add it to the hierarchy's roots
+		 * \param args The entity's constructor's parameters, besides its parent. Copied until the command is applied
+		 */
+		template <typename EntityT = Entity, typename ... Args>
+		void addEntity(Entity* parent, Args&&... args);
+
+		/**
+		 * \brief Records the destruction of the given entity and its descendants
+		 * \param entity The entity to destroy
+		 */
+		void destroyEntity(const Entity& entity);
+
+		/**
+		 * \brief Records the move of the given entity under the given parent
+		 * \param entity The entity to move
+		 * \param parent The entity's new parent. nullptr to move it to the hierarchy's roots
+		 */
+		void setParent(const Entity& entity, const Entity* parent);
+
+		/**
+		 * \brief Records the addition of a component of the given type to the given entity (see Entity::addComponent)
+		 * \param owner The component's owner
+		 * \param args The component's constructor's parameters, besides its owner. Copied until the command is applied
+		 */
+		template <typename T, typename ... Args>
+		void addComponent(const Entity& owner, Args&&... args);
+
+		/**
+		 * \brief Records the removal of the first component of the given type from the given entity
+		 * \param owner The entity to remove the component from
+		 */
+		template <LookupComponent T>
+		void removeComponent(const Entity& owner);
+
+		/**
+		 * \brief Records the removal of the given component from its owner
+		 * \param component The component to remove
+		 */
+		void removeComponent(const Component& component);
+
+		/**
+		 * \brief Records an arbitrary change to perform at the next sync point
+		 * \param command The change to perform
+		 */
+		void defer(std::function<void()> command);
+
+		/**
+		 * \brief Applies the recorded changes in recording order, including the ones recorded while applying.
+		 * Must be called on the main thread. If a change throws, the changes recorded along with it are dropped
+		 */
+		void apply();
+
+		/**
+		 * \brief Checks whether no change is waiting to be applied
+		 * \return True if the buffer is empty. False otherwise.
+		 */
+		bool isEmpty() const;
+
+	private:
+		DataStructure::Graph<Entity>&		m_graph;
+		mutable std::mutex					m_mutex;
+		std::vector<std::function<void()>>	m_commands;
+	};
+}
+
+#include "StructuralCommandBuffer.inl"
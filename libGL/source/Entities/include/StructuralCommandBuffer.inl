@@ -0,0 +1,47 @@
+#pragma once
+#include <utility>
+
+#include "StructuralCommandBuffer.h"
+
+namespace LibGL
+{
+	template <typename EntityT, typename ... Args>
+	void StructuralCommandBuffer::addEntity(Entity* parent, Args&&... args)
+	{
+		static_assert(std::is_same_v<Entity, EntityT> || std::is_base_of_v<Entity, EntityT>);
+
+		const EntityHandle parentHandle = parent != nullptr ? parent->getHandle() : EntityHandle();
+
+		defer([this, parentHandle, ...args = std::forward<Args>(args)]
+		{
+			if (parentHandle.isNull())
+			{
+				m_graph.addNode<EntityT>(nullptr, args...);
+				return;
+			}
+
+			if (Entity* parentEntity = Entity::find(parentHandle))
+				parentEntity->addChild<EntityT>(args...);
+		});
+	}
+
+	template <typename T, typename ... Args>
+	void StructuralCommandBuffer::addComponent(const Entity& owner, Args&&... args)
+	{
+		defer([handle = owner.getHandle(), ...args = std::forward<Args>(args)]
+		{
+			if (Entity* entity = Entity::find(handle))
+				entity->addComponent<T>(args...);
+		});
+	}
+
+	template <LookupComponent T>
+	void StructuralCommandBuffer::removeComponent(const Entity& owner)
+	{
+		defer([handle = owner.getHandle()]
+		{
+			if (Entity* entity = Entity::find(handle))
+				entity->removeComponent<T>();
+		});
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace LibGL
+{
+	class Entity;
+
+	/**
+	 * \brief Flattened copy of an entity hierarchy used to resolve its outdated global transforms in a single pass.
+	 * Entities are sorted by depth, so every parent is resolved before its children,
+	 * and each one refers to its parent by index instead of walking the node graph.
+	 * The arrays are only rebuilt when an entity is created, destroyed or reassigned
+	 */
+	class TransformHierarchy
+	{
+	public:
+		static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+		/**
+		 * \brief Resolves the outdated global transforms of the given entities and of their descendants
+		 * \param roots The hierarchy's root entities
+		 */
+		void update(const std::vector<Entity*>& roots);
+
+		/**
+		 * \brief Gets the number of entities in the flattened hierarchy
+		 * \return The hierarchy's entity count
+		 */
+		size_t getSize() const;
+
+		/**
+		 * \brief Gets the flattened entities, parents first, as of the last update
+		 * \return The hierarchy's entities
+		 */
+		std::span<Entity* const> getEntities() const;
+
+	private:
+		std::vector<Entity*>	m_entities;
+		std::vector<uint32_t>	m_parents;	// Index of each entity's parent in m_entities. NO_PARENT for the roots
+		std::vector<Entity*>	m_roots;
+		uint64_t				m_version = 0;
+
+		/**
+		 * \brief Flattens the given hierarchy, breadth first
+		 * \param roots The hierarchy's root entities
+		 */
+		void rebuild(const std::vector<Entity*>& roots);
+	};
+}
@@ -0,0 +1,213 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ComponentType.h"
+#include "EUpdatePhase.h"
+#include "TransformHierarchy.h"
+
+namespace LibGL
+{
+	class Component;
+	class Entity;
+	class StructuralCommandBuffer;
+
+	/**
+	 * \brief Runs a hierarchy's frame phase by phase (see EUpdatePhase).
+	 * Within a phase, components are grouped by type. Thread safe types are packed into waves whose
+	 * update declarations don't conflict (see Component::IS_THREAD_SAFE), each wave being spread over the
+	 * Jobs::JobSystem service: a parallel type in jobs of JOB_SIZE components, any other type in a single job.
+	 * A wave of a single job runs on the calling thread.
+	 * The other types run alone on the main thread, in hierarchy order.
+	 * Only the active and awake components are updated (see Component::setAwake): each type keeps a dense list
+	 * of them, in which only the entries of the components which changed state are patched before a phase,
+	 * so sleeping components cost nothing per frame.
+	 * Types which aren't ticked (see ETickMode::ON_EVENT) are never updated.
+	 * The structural changes recorded in the command buffer are applied before the frame and after each phase.
+	 * The groups and waves are only rebuilt when an entity or a component is added or removed
+	 */
+	class UpdateScheduler
+	{
+	public:
+		static constexpr size_t JOB_SIZE = 64;	// Maximum number of components of a parallel type updated per job
+
+		/**
+		 * \brief The number of updates of a component type run and skipped (asleep, inactive or not ticked components)
+		 */
+		struct UpdateCounters
+		{
+			const char*	m_typeName = nullptr;
+			uint64_t	m_executed = 0;
+			uint64_t	m_skipped = 0;
+		};
+
+		/**
+		 * \brief Creates a scheduler applying the given command buffer between phases
+		 * \param commands The hierarchy's structural command buffer
+		 */
+		explicit UpdateScheduler(StructuralCommandBuffer& commands);
+		UpdateScheduler(const UpdateScheduler& other) = delete;
+		UpdateScheduler(UpdateScheduler&& other) = delete;
+		~UpdateScheduler() = default;
+
+		UpdateScheduler& operator=(const UpdateScheduler& other) = delete;
+		UpdateScheduler& operator=(UpdateScheduler&& other) = delete;
+
+		/**
+		 * \brief Runs a frame of the given hierarchy: the input and logic phases, a physics phase per elapsed fixed step
+		 * (see Utility::Timer::startFixedStep), the transform phase, then the render phase followed by Entity::render
+		 * \param roots The hierarchy's root entities
+		 */
+		void update(const std::vector<Entity*>& roots);
+
+		/**
+		 * \brief Updates the components of the given hierarchy which belong to the given phase,
+		 * then applies the recorded structural changes.
+		 * A structural change made directly by a main thread update instead of being recorded
+		 * skips the rest of the phase for this frame
+		 * \param phase The phase to run
+		 * \param roots The hierarchy's root entities
+		 */
+		void runPhase(EUpdatePhase phase, const std::vector<Entity*>& roots);
+
+		/**
+		 * \brief Resolves the outdated global transforms of the given hierarchy (see TransformHierarchy)
+		 * \param roots The hierarchy's root entities
+		 */
+		void updateTransforms(const std::vector<Entity*>& roots);
+
+		/**
+		 * \brief Gets the number of updates run and skipped so far, per component type
+		 * \return The update counters of each type met so far, by type id
+		 */
+		const std::unordered_map<ComponentTypeId, UpdateCounters>& getUpdateCounters() const;
+
+		/**
+		 * \brief Resets the update counters of every type
+		 */
+		void resetUpdateCounters();
+
+	private:
+		static constexpr size_t PHASE_COUNT = static_cast<size_t>(EUpdatePhase::RENDER) + 1;
+
+		/**
+		 * \brief The components of a phase sharing the same type, in hierarchy order
+		 */
+		struct TypeGroup
+		{
+			const ComponentUpdateInfo*	m_info;
+			std::vector<Component*>		m_components;
+			std::vector<Component*>		m_awakeComponents;	// The active and awake components, in hierarchy order
+			std::vector<size_t>			m_awakeIndices;		// The positions of the active and awake components in m_components, sorted
+			bool						m_isSplit;			// Whether the components are spread over several jobs
+		};
+
+		/**
+		 * \brief The position of a component in the type groups
+		 */
+		struct ComponentSlot
+		{
+			size_t	m_phase;
+			size_t	m_group;
+			size_t	m_index;
+		};
+
+		/**
+		 * \brief Type groups of a phase which can be updated at the same time
+		 */
+		struct Wave
+		{
+			std::vector<size_t>	m_groups;
+			bool				m_isMainThread;
+			bool				m_accessesTransforms;
+		};
+
+		/**
+		 * \brief A range of a type group's components updated by a single worker
+		 */
+		struct Job
+		{
+			size_t	m_group;
+			size_t	m_begin;
+			size_t	m_end;
+		};
+
+		/**
+		 * \brief The scheduled work of a phase
+		 */
+		struct Phase
+		{
+			std::vector<TypeGroup>	m_groups;
+			std::vector<Wave>		m_waves;
+		};
+
+		StructuralCommandBuffer&			m_commands;
+		TransformHierarchy					m_transformHierarchy;
+		std::array<Phase, PHASE_COUNT>		m_phases;
+		std::vector<Job>					m_jobs;
+		std::vector<Entity*>				m_roots;
+		uint64_t							m_hierarchyVersion = 0;
+		uint64_t							m_componentsVersion = 0;
+		uint64_t							m_stateChangeCount = 0;	// The number of component state changes applied so far
+
+		std::unordered_map<const Component*, ComponentSlot>	m_componentSlots;
+		std::unordered_map<ComponentTypeId, UpdateCounters>	m_counters;
+
+		/**
+		 * \brief Checks whether the groups no longer match the given hierarchy
+		 * \param roots The hierarchy's root entities
+		 * \return True if the groups must be rebuilt. False otherwise.
+		 */
+		bool isOutdated(const std::vector<Entity*>& roots) const;
+
+		/**
+		 * \brief Regroups the components of the given hierarchy by phase and type, then packs each phase's groups into waves
+		 * \param roots The hierarchy's root entities
+		 */
+		void rebuild(const std::vector<Entity*>& roots);
+
+		/**
+		 * \brief Checks whether the components of the given group can be spread over several jobs.
+		 * Parallel types writing their owner's transform also write its descendants' global transforms,
+		 * so their owners must be distinct and none of them may be an ancestor of another
+		 * \param group The type group
+		 * \return True if the group's components can be updated at once. False otherwise.
+		 */
+		static bool canSplit(const TypeGroup& group);
+
+		/**
+		 * \brief Refills the type groups' lists of components to update
+		 */
+		void refreshAwakeComponents();
+
+		/**
+		 * \brief Patches the lists of components to update with the components which changed state since the last call
+		 * (see Component::setAwake), then trims the changes log. Refills the lists when another scheduler trimmed
+		 * changes this one didn't apply yet
+		 */
+		void applyStateChanges();
+
+		/**
+		 * \brief Adds the given component to its group's list of components to update, or removes it, to match its state
+		 * \param component The component which changed state
+		 */
+		void refreshAwakeComponent(const Component& component);
+
+		/**
+		 * \brief Packs the given phase's ticked type groups into waves
+		 * \param phase The phase to schedule
+		 */
+		static void buildWaves(Phase& phase);
+
+		/**
+		 * \brief Updates the components of the given wave of the given phase
+		 * \param phase The phase being run
+		 * \param wave The wave to run
+		 * \param roots The hierarchy's root entities
+		 * \return False if a main thread update changed the hierarchy's structure. True otherwise.
+		 */
+		bool runWave(const Phase& phase, const Wave& wave, const std::vector<Entity*>& roots);
+	};
+}
@@ -0,0 +1,170 @@
+#include "Archetype.h"
+
+#include <algorithm>
+#include <new>
+
+#include "Entity.h"
+
+namespace LibGL
+{
+	namespace
+	{
+		size_t alignUp(const size_t value, const size_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	Archetype::Archetype(std::vector<const ComponentTypeInfo*> types) : m_types(std::move(types))
+	{
+		std::ranges::sort(m_types, {}, &ComponentTypeInfo::m_id);
+
+		size_t rowSize = 0;
+		size_t padding = 0;
+
+		for (const ComponentTypeInfo* type : m_types)
+		{
+			m_signature.push_back(type->m_id);
+			rowSize += type->m_size;
+			padding += type->m_alignment;
+		}
+
+		if (rowSize > 0 && CHUNK_SIZE > padding)
+			m_chunkCapacity = std::max<size_t>(1, (CHUNK_SIZE - padding) / rowSize);
+
+		// Each column is a contiguous array of m_chunkCapacity components
+		for (const ComponentTypeInfo* type : m_types)
+		{
+			m_chunkBytes = alignUp(m_chunkBytes, type->m_alignment);
+			m_columnOffsets.push_back(m_chunkBytes);
+			m_chunkBytes += type->m_size * m_chunkCapacity;
+		}
+
+		m_chunkBytes = std::max<size_t>(m_chunkBytes, 1);
+	}
+
+	Archetype::~Archetype()
+	{
+		for (std::byte* chunk : m_chunks)
+			::operator delete(chunk, std::align_val_t{ CHUNK_ALIGNMENT });
+	}
+
+	const Archetype::Signature& Archetype::getSignature() const
+	{
+		return m_signature;
+	}
+
+	size_t Archetype::getColumnCount() const
+	{
+		return m_types.size();
+	}
+
+	const ComponentTypeInfo& Archetype::getType(const size_t column) const
+	{
+		return *m_types[column];
+	}
+
+	size_t Archetype::findColumn(const ComponentTypeId type) const
+	{
+		const auto iter = std::ranges::lower_bound(m_signature, type);
+
+		if (iter == m_signature.end() || *iter != type)
+			return INVALID_COLUMN;
+
+		return static_cast<size_t>(iter - m_signature.begin());
+	}
+
+	size_t Archetype::findColumn(const Component& component, const size_t row) const
+	{
+		for (size_t column = 0; column < m_types.size(); column++)
+		{
+			if (&getComponent(column, row) == &component)
+				return column;
+		}
+
+		return INVALID_COLUMN;
+	}
+
+	size_t Archetype::getSize() const
+	{
+		return m_entities.size();
+	}
+
+	size_t Archetype::getChunkCapacity() const
+	{
+		return m_chunkCapacity;
+	}
+
+	size_t Archetype::getChunkCount() const
+	{
+		return (m_entities.size() + m_chunkCapacity - 1) / m_chunkCapacity;
+	}
+
+	size_t Archetype::getChunkSize(const size_t chunk) const
+	{
+		return std::min(m_chunkCapacity, m_entities.size() - chunk * m_chunkCapacity);
+	}
+
+	Entity& Archetype::getEntity(const size_t row) const
+	{
+		return *m_entities[row];
+	}
+
+	void* Archetype::getData(const size_t column, const size_t row) const
+	{
+		const size_t chunk = row / m_chunkCapacity;
+		const size_t index = row % m_chunkCapacity;
+
+		return m_chunks[chunk] + m_columnOffsets[column] + index * m_types[column]->m_size;
+	}
+
+	Component& Archetype::getComponent(const size_t column, const size_t row) const
+	{
+		return m_types[column]->m_toComponent(getData(column, row));
+	}
+
+	size_t Archetype::pushRow(Entity& entity)
+	{
+		const size_t row = m_entities.size();
+
+		if (row == m_chunks.size() * m_chunkCapacity)
+		{
+			m_chunks.reserve(m_chunks.size() + 1);
+			m_chunks.push_back(static_cast<std::byte*>(::operator new(m_chunkBytes, std::align_val_t{ CHUNK_ALIGNMENT })));
+		}
+
+		m_entities.push_back(&entity);
+
+		return row;
+	}
+
+	void Archetype::popRow() noexcept
+	{
+		m_entities.pop_back();
+	}
+
+	Entity* Archetype::swapRemove(const size_t row) noexcept
+	{
+		const size_t lastRow = m_entities.size() - 1;
+
+		if (row == lastRow)
+		{
+			m_entities.pop_back();
+			return nullptr;
+		}
+
+		for (size_t column = 0; column < m_types.size(); column++)
+		{
+			void* lastComponent = getData(column, lastRow);
+
+			m_types[column]->m_moveConstruct(getData(column, row), lastComponent);
+			m_entities[lastRow]->m_componentIndex.relocate(getComponent(column, lastRow), getComponent(column, row));
+			m_types[column]->m_destroy(lastComponent);
+		}
+
+		m_entities[row] = m_entities[lastRow];
+		m_entities.pop_back();
+
+		return m_entities[row];
+	}
+}
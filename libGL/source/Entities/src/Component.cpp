@@ -1,19 +1,29 @@
 #include "Component.h"
 
+#include <utility>
+
 #include "Entity.h"
+#include "Debug/Assertion.h"
+#include "Memory/ObjectAllocator.h"
 
 namespace LibGL
 {
 	Component::Component(const Component& other) :
-		m_owner(other.getOwner()), m_id(s_currentId++),
-		m_isActive(other.isActive())
+		m_owner(other.m_owner), m_handle(s_components.insert(this)), m_id(s_currentId++),
+		m_isActive(other.isActive()), m_isAwake(other.isAwake()), m_updateInfo(other.m_updateInfo)
 	{
 	}
 
 	Component::Component(Component&& other) noexcept :
-		m_owner(other.getOwner()), m_id(other.m_id),
-		m_isActive(other.isActive())
+		m_owner(other.m_owner), m_handle(std::exchange(other.m_handle, {})), m_id(other.m_id),
+		m_isActive(other.isActive()), m_isAwake(other.isAwake()), m_updateInfo(other.m_updateInfo)
 	{
+		// The handle follows the component to its new address
+		if (Component** slot = s_components.find(m_handle))
+			*slot = this;
+
+		// Without id, the moved-from component's destructor doesn't remove the moved one from its owner
+		other.m_id = 0;
 	}
 
 	Component& Component::operator=(const Component& other)
@@ -22,8 +32,13 @@ namespace LibGL
 			return *this;
 
 		m_owner = other.m_owner;
-		m_isActive = other.m_isActive;
+
+		if (std::exchange(m_isActive, other.m_isActive) != m_isActive)
+			logStateChange();
+
+		setAwake(other.isAwake());
 		m_id = s_currentId++;
+		m_updateInfo = other.m_updateInfo;
 
 		return *this;
 	}
@@ -33,9 +48,21 @@ namespace LibGL
 		if (&other == this)
 			return *this;
 
-		m_owner = std::move(other.m_owner);
-		m_isActive = other.m_isActive;
+		m_owner = other.m_owner;
 		m_id = other.m_id;
+		m_updateInfo = other.m_updateInfo;
+
+		s_components.erase(m_handle);
+		m_handle = std::exchange(other.m_handle, {});
+
+		if (Component** slot = s_components.find(m_handle))
+			*slot = this;
+
+		// Logged under the handle taken over, the former one being released
+		if (std::exchange(m_isActive, other.m_isActive) != m_isActive)
+			logStateChange();
+
+		setAwake(other.isAwake());
 
 		other.m_id = 0;
 
@@ -52,9 +79,25 @@ namespace LibGL
 		return !(*this == other);
 	}
 
+	void* Component::operator new(const size_t size)
+	{
+		return Memory::ObjectAllocator::allocate(size);
+	}
+
+	void Component::operator delete(void* component, const size_t size)
+	{
+		Memory::ObjectAllocator::deallocate(component, size);
+	}
+
 	Component::~Component()
 	{
-		m_owner.removeComponent(m_id);
+		if (m_id != 0)
+		{
+			if (Entity* owner = Entity::find(m_owner))
+				owner->removeComponent(m_id);
+		}
+
+		s_components.erase(m_handle);
 	}
 
 	bool Component::isActive() const
@@ -68,22 +111,57 @@ namespace LibGL
 			return;
 
 		m_isActive = active;
+		logStateChange();
 
 		m_isActive ? onEnable() : onDisable();
 	}
 
+	bool Component::isAwake() const
+	{
+		return m_isAwake.load(std::memory_order_relaxed);
+	}
+
+	void Component::setAwake(const bool awake)
+	{
+		if (m_isAwake.exchange(awake, std::memory_order_relaxed) != awake)
+			logStateChange();
+	}
+
 	Component::ComponentId Component::getId() const
 	{
 		return m_id;
 	}
 
+	ComponentHandle Component::getHandle() const
+	{
+		return m_handle;
+	}
+
 	Entity& Component::getOwner() const
 	{
-		return m_owner;
+		Entity* owner = Entity::find(m_owner);
+		ASSERT(owner != nullptr);
+
+		return *owner;
+	}
+
+	Component* Component::find(const ComponentHandle handle)
+	{
+		Component* const* component = s_components.find(handle);
+		return component != nullptr ? *component : nullptr;
 	}
 
 	Component::Component(Entity& owner) :
-		m_owner(owner), m_id(s_currentId++)
+		m_owner(owner.getHandle()), m_handle(s_components.insert(this)), m_id(s_currentId++)
 	{
 	}
+
+	void Component::logStateChange() const
+	{
+		// Components may fall asleep or wake up from concurrent updates
+		std::scoped_lock lock(s_stateChangesMutex);
+
+		s_stateChanges.push_back(m_handle);
+		s_stateChangeCount.fetch_add(1, std::memory_order_release);
+	}
 }
@@ -0,0 +1,61 @@
+#include "ComponentIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace LibGL
+{
+	void ComponentIndex::add(Component& component, const std::span<const ComponentTypeId> lookupTypes)
+	{
+		for (const ComponentTypeId type : lookupTypes)
+		{
+			if (type >= m_bucketIndices.size())
+				m_bucketIndices.resize(type + 1, 0);
+
+			if (m_bucketIndices[type] == 0)
+			{
+				if (m_buckets.size() == std::numeric_limits<uint16_t>::max())
+					throw std::length_error("Too many component types on a single entity");
+
+				m_buckets.emplace_back();
+				m_bucketIndices[type] = static_cast<uint16_t>(m_buckets.size());
+			}
+
+			m_buckets[m_bucketIndices[type] - 1].push_back(&component);
+		}
+	}
+
+	void ComponentIndex::remove(const Component& component)
+	{
+		// Empty buckets are kept - an entity rarely has more than a few component types
+		for (std::vector<Component*>& bucket : m_buckets)
+			std::erase(bucket, &component);
+	}
+
+	void ComponentIndex::relocate(const Component& from, Component& to)
+	{
+		for (std::vector<Component*>& bucket : m_buckets)
+			std::ranges::replace(bucket, &from, &to);
+	}
+
+	std::span<Component* const> ComponentIndex::find(const ComponentTypeId type) const
+	{
+		if (type >= m_bucketIndices.size() || m_bucketIndices[type] == 0)
+			return {};
+
+		return m_buckets[m_bucketIndices[type] - 1];
+	}
+
+	Component* ComponentIndex::find(const Component::ComponentId id) const
+	{
+		// Every component is in the Component bucket
+		for (Component* component : find(getComponentTypeId<Component>()))
+		{
+			if (component->getId() == id)
+				return component;
+		}
+
+		return nullptr;
+	}
+}
@@ -0,0 +1,279 @@
+#include "ComponentStorage.h"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+#include "Entity.h"
+
+namespace LibGL
+{
+	namespace
+	{
+		/**
+		 * \brief Aligned buffer in which components are moved out of their row before being destroyed,
+		 * so their destructor runs while the storage is in a consistent state
+		 */
+		class ComponentBuffer
+		{
+		public:
+			ComponentBuffer(const size_t size, const size_t alignment) :
+				m_data(static_cast<std::byte*>(::operator new(size, std::align_val_t{ alignment }))), m_alignment(alignment)
+			{
+			}
+
+			ComponentBuffer(const ComponentBuffer& other) = delete;
+
+			~ComponentBuffer()
+			{
+				::operator delete(m_data, std::align_val_t{ m_alignment });
+			}
+
+			ComponentBuffer& operator=(const ComponentBuffer& other) = delete;
+
+			std::byte* get() const
+			{
+				return m_data;
+			}
+
+		private:
+			std::byte*	m_data;
+			size_t		m_alignment;
+		};
+	}
+
+	ComponentStorage::~ComponentStorage()
+	{
+		for (const std::unique_ptr<Archetype>& archetype : m_archetypes)
+		{
+			for (size_t row = 0; row < archetype->getSize(); row++)
+			{
+				Entity& entity = archetype->getEntity(row);
+
+				for (size_t column = 0; column < archetype->getColumnCount(); column++)
+					entity.m_componentIndex.remove(archetype->getComponent(column, row));
+
+				entity.m_componentStorage = nullptr;
+				entity.m_archetype = nullptr;
+			}
+
+			Entity::s_componentsVersion++;
+
+			for (size_t row = 0; row < archetype->getSize(); row++)
+			{
+				for (size_t column = 0; column < archetype->getColumnCount(); column++)
+					archetype->getType(column).m_destroy(archetype->getData(column, row));
+			}
+		}
+	}
+
+	void ComponentStorage::removeComponent(Entity& entity, const ComponentTypeId type)
+	{
+		checkStructuralChange();
+
+		Archetype* source = entity.m_archetype;
+		const size_t column = source != nullptr ? source->findColumn(type) : Archetype::INVALID_COLUMN;
+
+		if (column == Archetype::INVALID_COLUMN)
+			return;
+
+		const ComponentTypeInfo& typeInfo = source->getType(column);
+		Archetype* target = nullptr;
+
+		if (const auto edge = source->m_removeEdges.find(type); edge != source->m_removeEdges.end())
+		{
+			target = edge->second;
+		}
+		else if (source->getColumnCount() > 1)
+		{
+			std::vector<const ComponentTypeInfo*> types = source->m_types;
+			types.erase(types.begin() + static_cast<ptrdiff_t>(column));
+
+			target = &getArchetype(std::move(types));
+			source->m_removeEdges[type] = target;
+		}
+		else
+		{
+			source->m_removeEdges[type] = nullptr;
+		}
+
+		// Everything which can throw happens before the first component is moved
+		const ComponentBuffer buffer(typeInfo.m_size, typeInfo.m_alignment);
+		const size_t targetRow = target != nullptr ? target->pushRow(entity) : 0;
+
+		void* component = source->getData(column, entity.m_archetypeRow);
+		entity.m_componentIndex.remove(source->getComponent(column, entity.m_archetypeRow));
+		typeInfo.m_moveConstruct(buffer.get(), component);
+		typeInfo.m_destroy(component);
+
+		moveRow(entity, target, targetRow);
+
+		typeInfo.m_destroy(buffer.get());
+	}
+
+	void ComponentStorage::removeEntity(Entity& entity)
+	{
+		Archetype* source = entity.m_archetype;
+
+		if (source == nullptr)
+			return;
+
+		checkStructuralChange();
+
+		std::vector<size_t> offsets;
+		offsets.reserve(source->getColumnCount());
+
+		size_t bufferSize = 0;
+
+		for (size_t column = 0; column < source->getColumnCount(); column++)
+		{
+			const ComponentTypeInfo& type = source->getType(column);
+
+			bufferSize = (bufferSize + type.m_alignment - 1) / type.m_alignment * type.m_alignment;
+			offsets.push_back(bufferSize);
+			bufferSize += type.m_size;
+		}
+
+		const ComponentBuffer buffer(bufferSize, Archetype::CHUNK_ALIGNMENT);
+
+		for (size_t column = 0; column < source->getColumnCount(); column++)
+		{
+			const ComponentTypeInfo& type = source->getType(column);
+			void* component = source->getData(column, entity.m_archetypeRow);
+
+			entity.m_componentIndex.remove(source->getComponent(column, entity.m_archetypeRow));
+			type.m_moveConstruct(buffer.get() + offsets[column], component);
+			type.m_destroy(component);
+		}
+
+		moveRow(entity, nullptr, 0);
+
+		for (size_t column = 0; column < source->getColumnCount(); column++)
+			source->getType(column).m_destroy(buffer.get() + offsets[column]);
+	}
+
+	size_t ComponentStorage::getArchetypeCount() const
+	{
+		return m_archetypes.size();
+	}
+
+	ComponentStorage::IterationGuard::IterationGuard(ComponentStorage& storage) : m_storage(storage)
+	{
+		m_storage.m_iterationDepth++;
+	}
+
+	ComponentStorage::IterationGuard::~IterationGuard()
+	{
+		m_storage.m_iterationDepth--;
+	}
+
+	void* ComponentStorage::insertComponent(Entity& entity, const ComponentTypeInfo& type)
+	{
+		checkStructuralChange();
+
+		Archetype* source = entity.m_archetype;
+		Archetype* target;
+
+		if (source == nullptr)
+		{
+			target = &getArchetype({ &type });
+		}
+		else if (const auto edge = source->m_addEdges.find(type.m_id); edge != source->m_addEdges.end())
+		{
+			target = edge->second;
+		}
+		else
+		{
+			if (source->findColumn(type.m_id) != Archetype::INVALID_COLUMN)
+				throw std::logic_error("The entity already has a stored component of this type");
+
+			std::vector<const ComponentTypeInfo*> types = source->m_types;
+			types.push_back(&type);
+
+			target = &getArchetype(std::move(types));
+			source->m_addEdges[type.m_id] = target;
+		}
+
+		moveRow(entity, target, target->pushRow(entity));
+
+		return target->getData(target->findColumn(type.m_id), entity.m_archetypeRow);
+	}
+
+	void ComponentStorage::registerComponent(Entity& entity, Component& component, const std::span<const ComponentTypeId> lookupTypes,
+		const ComponentUpdateInfo& updateInfo)
+	{
+		entity.registerComponent(component, lookupTypes, updateInfo);
+	}
+
+	Archetype& ComponentStorage::getArchetype(std::vector<const ComponentTypeInfo*> types)
+	{
+		std::ranges::sort(types, {}, &ComponentTypeInfo::m_id);
+
+		Archetype::Signature signature;
+		signature.reserve(types.size());
+
+		for (const ComponentTypeInfo* type : types)
+			signature.push_back(type->m_id);
+
+		if (const auto iter = m_archetypesBySignature.find(signature); iter != m_archetypesBySignature.end())
+			return *iter->second;
+
+		m_archetypes.push_back(std::make_unique<Archetype>(std::move(types)));
+
+		Archetype& archetype = *m_archetypes.back();
+		m_archetypesBySignature.emplace(std::move(signature), &archetype);
+
+		return archetype;
+	}
+
+	void ComponentStorage::moveRow(Entity& entity, Archetype* target, const size_t targetRow) noexcept
+	{
+		Archetype* source = entity.m_archetype;
+		const size_t sourceRow = entity.m_archetypeRow;
+
+		if (source != nullptr)
+		{
+			if (target != nullptr)
+			{
+				for (size_t column = 0; column < source->getColumnCount(); column++)
+				{
+					const size_t targetColumn = target->findColumn(source->getType(column).m_id);
+
+					if (targetColumn == Archetype::INVALID_COLUMN)
+						continue;
+
+					void* component = source->getData(column, sourceRow);
+
+					source->getType(column).m_moveConstruct(target->getData(targetColumn, targetRow), component);
+					entity.m_componentIndex.relocate(source->getComponent(column, sourceRow), target->getComponent(targetColumn, targetRow));
+					source->getType(column).m_destroy(component);
+				}
+			}
+
+			if (Entity* movedEntity = source->swapRemove(sourceRow))
+				movedEntity->m_archetypeRow = sourceRow;
+		}
+
+		entity.m_archetype = target;
+		entity.m_archetypeRow = targetRow;
+
+		Entity::s_componentsVersion++;
+	}
+
+	void ComponentStorage::transferRow(Entity& source, Entity& destination) noexcept
+	{
+		destination.m_archetype = source.m_archetype;
+		destination.m_archetypeRow = source.m_archetypeRow;
+
+		if (destination.m_archetype != nullptr)
+			destination.m_archetype->m_entities[destination.m_archetypeRow] = &destination;
+
+		source.m_archetype = nullptr;
+	}
+
+	void ComponentStorage::checkStructuralChange() const
+	{
+		if (m_iterationDepth > 0)
+			throw std::logic_error("Components can't be added or removed while iterating over their storage");
+	}
+}
@@ -0,0 +1,47 @@
+#include "ComponentType.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Transform.h"
+
+namespace LibGL
+{
+	namespace
+	{
+		bool intersects(const std::vector<ComponentTypeId>& first, const std::vector<ComponentTypeId>& second)
+		{
+			// Both lists are sorted
+			auto firstIter = first.begin();
+			auto secondIter = second.begin();
+
+			while (firstIter != first.end() && secondIter != second.end())
+			{
+				if (*firstIter == *secondIter)
+					return true;
+
+				*firstIter < *secondIter ? ++firstIter : ++secondIter;
+			}
+
+			return false;
+		}
+	}
+
+	bool ComponentUpdateInfo::conflictsWith(const ComponentUpdateInfo& other) const
+	{
+		return intersects(m_writes, other.m_writes) || intersects(m_writes, other.m_reads)
+			|| intersects(m_reads, other.m_writes);
+	}
+
+	ComponentTypeId getTransformAccessId()
+	{
+		static const ComponentTypeId id = getUpdateAccessIds(ComponentTypeList<LibMath::Transform>{}).front();
+		return id;
+	}
+
+	ComponentTypeId nextComponentTypeId()
+	{
+		static std::atomic<ComponentTypeId> s_nextId = 0;
+		return s_nextId.fetch_add(1, std::memory_order_relaxed);
+	}
+}
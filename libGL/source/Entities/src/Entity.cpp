@@ -1,5 +1,8 @@
 #include "Entity.h"
 
+#include <stdexcept>
+#include <utility>
+
 #include "Debug/Assertion.h"
 #include "Vector/Vector4.h"
 
@@ -7,47 +10,74 @@ using namespace LibMath;
 
 namespace LibGL
 {
+	Entity::Entity() :
+		m_handle(s_entities.insert(this))
+	{
+		s_hierarchyVersion++;
+	}
+
 	Entity::Entity(Node* parent, const Transform& transform) :
-		Node(parent), Transform(transform)
+		Node(parent), Transform(transform), m_handle(s_entities.insert(this))
 	{
 		ASSERT(parent == nullptr || typeid(parent) == typeid(Entity*) ||
 			dynamic_cast<Entity*>(parent) != nullptr);
 
-		updateGlobalTransform();
+		if (const Entity* castParent = dynamic_cast<Entity*>(parent))
+			m_componentStorage = castParent->m_componentStorage;
+
+		s_hierarchyVersion++;
 	}
 
 	Entity::Entity(const Entity& other) :
-		Node(other), Transform(other),
-		m_components(other.m_components)
+		Node(other), Transform(other), m_handle(s_entities.insert(this)),
+		m_components(other.m_components), m_componentIndex(other.m_componentIndex),
+		m_componentStorage(other.m_componentStorage)
 	{
-		if (!m_components.empty())
-			for (const auto& component : m_components)
-				component->m_owner = *this;
+		// An archetype row belongs to a single entity - the copy doesn't share the stored components
+		for (size_t column = 0; other.m_archetype != nullptr && column < other.m_archetype->getColumnCount(); column++)
+			m_componentIndex.remove(other.m_archetype->getComponent(column, other.m_archetypeRow));
+
+		for (const auto& component : m_components)
+			component->m_owner = m_handle;
 
-		updateGlobalTransform();
+		s_hierarchyVersion++;
 	}
 
 	Entity::Entity(Entity&& other) noexcept :
-		Node(std::move(other)), Transform(std::move(other)),
-		m_components(std::move(other.m_components))
+		Node(std::move(other)), Transform(std::move(other)), m_handle(std::exchange(other.m_handle, {})),
+		m_components(std::move(other.m_components)), m_componentIndex(std::move(other.m_componentIndex)),
+		m_componentStorage(other.m_componentStorage)
 	{
-		if (!m_components.empty())
-			for (const auto& component : m_components)
-				component->m_owner = *this;
+		if (m_componentStorage != nullptr)
+			m_componentStorage->transferRow(other, *this);
 
-		updateGlobalTransform();
+		// The components refer to their owner by handle, which follows the entity to its new address
+		if (Entity** slot = s_entities.find(m_handle))
+			*slot = this;
+
+		s_hierarchyVersion++;
 	}
 
 	Entity::~Entity()
 	{
+		s_hierarchyVersion++;
+
+		if (m_componentStorage != nullptr)
+			m_componentStorage->removeEntity(*this);
+
 		if (!m_components.empty())
 		{
-			// Components remove themselves from the list on destruction.
-			// Can't for / foreach (would overflow)
-
-			while (!m_components.empty())
-				delete m_components[0];
+			// Unindexed first so the components don't look themselves up on destruction
+			const ComponentList components = std::move(m_components);
+			m_components.clear();
+			m_componentIndex = {};
+			s_componentsVersion++;
+
+			for (const ComponentPtr component : components)
+				delete component;
 		}
+
+		s_entities.erase(m_handle);
 	}
 
 	Entity& Entity::operator=(const Entity& other)
@@ -58,15 +88,22 @@ namespace LibGL
 		Node::operator=(other);
 		Transform::operator=(other);
 
+		if (m_componentStorage != nullptr)
+			m_componentStorage->removeEntity(*this);
+
 		m_components.clear();
 
 		m_components = other.m_components;
+		m_componentIndex = other.m_componentIndex;
+		m_componentStorage = other.m_componentStorage;
 
-		if (!m_components.empty())
-			for (const auto& component : m_components)
-				component->m_owner = *this;
+		for (size_t column = 0; other.m_archetype != nullptr && column < other.m_archetype->getColumnCount(); column++)
+			m_componentIndex.remove(other.m_archetype->getComponent(column, other.m_archetypeRow));
 
-		updateGlobalTransform();
+		for (const auto& component : m_components)
+			component->m_owner = m_handle;
+
+		s_hierarchyVersion++;
 
 		return *this;
 	}
@@ -79,34 +116,82 @@ namespace LibGL
 		Node::operator=(other);
 		Transform::operator=(other);
 
+		if (m_componentStorage != nullptr)
+			m_componentStorage->removeEntity(*this);
+
 		m_components.clear();
 
 		m_components = std::move(other.m_components);
-		m_globalTransform = std::move(other.m_globalTransform);
+		m_componentIndex = std::move(other.m_componentIndex);
+		m_componentStorage = other.m_componentStorage;
 
-		if (!m_components.empty())
-			for (const auto& component : m_components)
-				component->m_owner = *this;
+		if (m_componentStorage != nullptr)
+			m_componentStorage->transferRow(other, *this);
+
+		// Takes over the other entity's identity, which its components refer to
+		s_entities.erase(m_handle);
+		m_handle = std::exchange(other.m_handle, {});
 
-		updateGlobalTransform();
+		if (Entity** slot = s_entities.find(m_handle))
+			*slot = this;
+
+		s_hierarchyVersion++;
 
 		other.m_components.clear();
 
 		return *this;
 	}
 
+	EntityHandle Entity::getHandle() const
+	{
+		return m_handle;
+	}
+
+	Entity* Entity::find(const EntityHandle handle)
+	{
+		Entity* const* entity = s_entities.find(handle);
+		return entity != nullptr ? *entity : nullptr;
+	}
+
 	LibMath::Transform Entity::getGlobalTransform() const
 	{
-		return m_globalTransform;
+		return resolveGlobalTransform();
+	}
+
+
+	void Entity::setComponentStorage(ComponentStorage* storage)
+	{
+		if (storage == m_componentStorage)
+			return;
+
+		if (m_archetype != nullptr)
+			throw std::logic_error("Can't change the storage of an entity which has stored components");
+
+		m_componentStorage = storage;
 	}
 
+	ComponentStorage* Entity::getComponentStorage() const
+	{
+		return m_componentStorage;
+	}
 
 	void Entity::removeComponent(const Component& component)
 	{
+		if (m_archetype != nullptr)
+		{
+			const size_t column = m_archetype->findColumn(component, m_archetypeRow);
+
+			if (column != Archetype::INVALID_COLUMN)
+			{
+				m_componentStorage->removeComponent(*this, m_archetype->getType(column).m_id);
+				return;
+			}
+		}
+
 		if (m_components.empty())
 			return;
 
-		const auto findFunc = [component](const ComponentPtr& ptr)
+		const auto findFunc = [&component](const ComponentPtr& ptr)
 		{
 			return *ptr == component;
 		};
@@ -115,22 +200,36 @@ namespace LibGL
 
 		if (iter != m_components.end())
 		{
-			delete* iter;
+			// Erased first since the component's destructor looks it up in the list
+			const ComponentPtr removedComponent = *iter;
 			m_components.erase(iter);
+			m_componentIndex.remove(*removedComponent);
+			s_componentsVersion++;
+			delete removedComponent;
 		}
 	}
 
 	void Entity::removeComponent(const Component::ComponentId id)
 	{
-		if (m_components.empty())
+		Component* component = m_componentIndex.find(id);
+
+		if (component == nullptr)
 			return;
 
-		const auto findFunc = [id](const ComponentPtr& ptr)
+		if (m_archetype != nullptr)
 		{
-			return ptr->getId() == id;
-		};
+			const size_t column = m_archetype->findColumn(*component, m_archetypeRow);
+
+			if (column != Archetype::INVALID_COLUMN)
+			{
+				m_componentStorage->removeComponent(*this, m_archetype->getType(column).m_id);
+				return;
+			}
+		}
 
-		std::erase_if(m_components, findFunc);
+		m_componentIndex.remove(*component);
+		std::erase(m_components, component);
+		s_componentsVersion++;
 	}
 
 	void Entity::update()
@@ -138,34 +237,68 @@ namespace LibGL
 		for (const auto& component : m_components)
 			component->update();
 
+		// Indexed since an update may add or remove children
+		for (size_t i = 0; i < getChildren().size(); i++)
+			static_cast<Entity*>(getChildren()[i])->update();
+	}
+
+	void Entity::render()
+	{
 		for (const NodePtr& child : getChildren())
-			reinterpret_cast<Entity*>(child)->update();
+			if (child != nullptr)
+				static_cast<Entity*>(child)->render();
 	}
 
 	void Entity::onChange()
 	{
 		Transform::onChange();
 
-		updateGlobalTransform();
+		invalidateGlobalTransform();
+	}
 
-		for (const NodePtr& child : getChildren())
-			if (child != nullptr)
-				reinterpret_cast<Entity*>(child)->onChange();
+	void Entity::onParentChange()
+	{
+		s_hierarchyVersion++;
+		invalidateGlobalTransform();
+	}
+
+	void Entity::registerComponent(Component& component, const std::span<const ComponentTypeId> lookupTypes,
+		const ComponentUpdateInfo& updateInfo)
+	{
+		component.m_updateInfo = &updateInfo;
+		m_componentIndex.add(component, lookupTypes);
+		s_componentsVersion++;
 	}
 
-	void Entity::updateGlobalTransform()
+	void Entity::invalidateGlobalTransform()
 	{
-		m_globalTransform = static_cast<Transform>(*this);
+		if (m_isGlobalTransformDirty)
+			return;
+
+		m_isGlobalTransformDirty = true;
+		onGlobalTransformChange();
 
-		const Entity* castParent = dynamic_cast<Entity*>(getParent());
+		for (Component* component : m_componentIndex.find(getComponentTypeId<Component>()))
+			component->onOwnerTransformChange();
 
-		if (castParent != nullptr)
-			m_globalTransform = castParent->getGlobalTransform() * m_globalTransform;
+		for (const NodePtr& child : getChildren())
+			if (child != nullptr)
+				static_cast<Entity*>(child)->invalidateGlobalTransform();
 	}
 
-	void Entity::removeChild(Node& child)
+	const LibMath::Transform& Entity::resolveGlobalTransform() const
 	{
-		Node::removeChild(child);
-		reinterpret_cast<Entity&>(child).updateGlobalTransform();
+		if (!m_isGlobalTransformDirty)
+			return m_globalTransform;
+
+		// The constructor asserts the parent is an entity
+		if (const Entity* parent = static_cast<const Entity*>(getParent()))
+			m_globalTransform = parent->resolveGlobalTransform() * static_cast<const Transform&>(*this);
+		else
+			m_globalTransform = static_cast<const Transform&>(*this);
+
+		m_isGlobalTransformDirty = false;
+
+		return m_globalTransform;
 	}
 }
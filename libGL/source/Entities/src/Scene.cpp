@@ -2,11 +2,43 @@
 
 namespace LibGL::Resources
 {
+	Scene::Scene() :
+		m_commands(*this), m_updateScheduler(m_commands)
+	{
+	}
+
+	Scene::~Scene()
+	{
+		clear();
+	}
+
+	ComponentStorage& Scene::getComponentStorage()
+	{
+		return m_componentStorage;
+	}
+
+	StructuralCommandBuffer& Scene::getCommands()
+	{
+		return m_commands;
+	}
+
+	UpdateScheduler& Scene::getUpdateScheduler()
+	{
+		return m_updateScheduler;
+	}
+
 	void Scene::update()
 	{
-		const auto& nodes = getNodes();
+		m_updateScheduler.update(getNodes());
+	}
 
-		for (const auto node : nodes)
-			node->update();
+	void Scene::updateTransforms()
+	{
+		m_updateScheduler.updateTransforms(getNodes());
+	}
+
+	void Scene::onNodeAdded(Entity& node)
+	{
+		node.setComponentStorage(&m_componentStorage);
 	}
-}
+}
\ No newline at end of file
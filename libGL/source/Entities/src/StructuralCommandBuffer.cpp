@@ -0,0 +1,83 @@
+#include "StructuralCommandBuffer.h"
+
+namespace LibGL
+{
+	StructuralCommandBuffer::StructuralCommandBuffer(DataStructure::Graph<Entity>& graph) :
+		m_graph(graph)
+	{
+	}
+
+	void StructuralCommandBuffer::destroyEntity(const Entity& entity)
+	{
+		defer([this, handle = entity.getHandle()]
+		{
+			Entity* target = Entity::find(handle);
+
+			if (target == nullptr)
+				return;
+
+			if (DataStructure::Node* parent = target->getParent())
+				parent->removeChild(*target);
+			else
+				m_graph.removeNode(*target);
+		});
+	}
+
+	void StructuralCommandBuffer::setParent(const Entity& entity, const Entity* parent)
+	{
+		const EntityHandle parentHandle = parent != nullptr ? parent->getHandle() : EntityHandle();
+
+		defer([this, handle = entity.getHandle(), parentHandle]
+		{
+			Entity* target = Entity::find(handle);
+			Entity* newParent = Entity::find(parentHandle);
+
+			if (target != nullptr && (newParent != nullptr || parentHandle.isNull()))
+				m_graph.setParent(*target, newParent);
+		});
+	}
+
+	void StructuralCommandBuffer::removeComponent(const Component& component)
+	{
+		defer([handle = component.getHandle()]
+		{
+			if (Component* target = Component::find(handle))
+				target->getOwner().removeComponent(*target);
+		});
+	}
+
+	void StructuralCommandBuffer::defer(std::function<void()> command)
+	{
+		std::lock_guard lock(m_mutex);
+		m_commands.push_back(std::move(command));
+	}
+
+	void StructuralCommandBuffer::apply()
+	{
+		std::vector<std::function<void()>> commands;
+
+		while (true)
+		{
+			{
+				std::lock_guard lock(m_mutex);
+
+				if (m_commands.empty())
+					return;
+
+				// Swapped out so the commands can record more changes
+				commands.swap(m_commands);
+			}
+
+			for (const std::function<void()>& command : commands)
+				command();
+
+			commands.clear();
+		}
+	}
+
+	bool StructuralCommandBuffer::isEmpty() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_commands.empty();
+	}
+}
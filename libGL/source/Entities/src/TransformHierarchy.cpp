@@ -0,0 +1,74 @@
+#include "TransformHierarchy.h"
+
+#include <stdexcept>
+
+#include "Entity.h"
+
+namespace LibGL
+{
+	void TransformHierarchy::update(const std::vector<Entity*>& roots)
+	{
+		if (m_version != Entity::s_hierarchyVersion || m_roots != roots)
+			rebuild(roots);
+
+		for (size_t i = 0; i < m_entities.size(); i++)
+		{
+			const Entity& entity = *m_entities[i];
+
+			if (!entity.m_isGlobalTransformDirty)
+				continue;
+
+			const uint32_t parent = m_parents[i];
+
+			if (parent == NO_PARENT)
+			{
+				// A root may still have a parent outside of the hierarchy
+				entity.resolveGlobalTransform();
+				continue;
+			}
+
+			entity.m_globalTransform = m_entities[parent]->m_globalTransform * static_cast<const LibMath::Transform&>(entity);
+			entity.m_isGlobalTransformDirty = false;
+		}
+	}
+
+	size_t TransformHierarchy::getSize() const
+	{
+		return m_entities.size();
+	}
+
+	std::span<Entity* const> TransformHierarchy::getEntities() const
+	{
+		return m_entities;
+	}
+
+	void TransformHierarchy::rebuild(const std::vector<Entity*>& roots)
+	{
+		m_entities.clear();
+		m_parents.clear();
+
+		for (Entity* root : roots)
+		{
+			m_entities.push_back(root);
+			m_parents.push_back(NO_PARENT);
+		}
+
+		for (size_t i = 0; i < m_entities.size(); i++)
+		{
+			if (i >= NO_PARENT)
+				throw std::length_error("Too many entities in the hierarchy");
+
+			for (DataStructure::Node* child : m_entities[i]->getChildren())
+			{
+				if (child == nullptr)
+					continue;
+
+				m_entities.push_back(static_cast<Entity*>(child));
+				m_parents.push_back(static_cast<uint32_t>(i));
+			}
+		}
+
+		m_roots = roots;
+		m_version = Entity::s_hierarchyVersion;
+	}
+}
@@ -0,0 +1,365 @@
+#include "UpdateScheduler.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Entity.h"
+#include "StructuralCommandBuffer.h"
+#include "Debug/Assertion.h"
+#include "Jobs/JobSystem.h"
+#include "Utility/ServiceLocator.h"
+#include "Utility/Timer.h"
+
+namespace LibGL
+{
+	namespace
+	{
+		bool accessesTransforms(const ComponentUpdateInfo& info)
+		{
+			return std::ranges::binary_search(info.m_reads, getTransformAccessId())
+				|| std::ranges::binary_search(info.m_writes, getTransformAccessId());
+		}
+	}
+
+	UpdateScheduler::UpdateScheduler(StructuralCommandBuffer& commands) :
+		m_commands(commands)
+	{
+	}
+
+	void UpdateScheduler::update(const std::vector<Entity*>& roots)
+	{
+		m_commands.apply();
+
+		runPhase(EUpdatePhase::INPUT, roots);
+		runPhase(EUpdatePhase::LOGIC, roots);
+
+		Utility::Timer& timer = LGL_SERVICE(Utility::Timer);
+
+		while (timer.startFixedStep())
+			runPhase(EUpdatePhase::PHYSICS, roots);
+
+		updateTransforms(roots);
+
+		runPhase(EUpdatePhase::RENDER, roots);
+
+		for (Entity* root : roots)
+			if (root != nullptr)
+				root->render();
+	}
+
+	void UpdateScheduler::runPhase(const EUpdatePhase phase, const std::vector<Entity*>& roots)
+	{
+		if (isOutdated(roots))
+			rebuild(roots);
+		else if (m_stateChangeCount != Component::s_stateChangeCount.load(std::memory_order_acquire))
+			applyStateChanges();
+
+		const Phase& scheduledPhase = m_phases[static_cast<size_t>(phase)];
+
+		for (const TypeGroup& group : scheduledPhase.m_groups)
+		{
+			UpdateCounters& counters = m_counters[group.m_info->m_typeId];
+			const size_t updatedCount = group.m_info->m_isTicked ? group.m_awakeComponents.size() : 0;
+
+			counters.m_typeName = group.m_info->m_typeName;
+			counters.m_executed += updatedCount;
+			counters.m_skipped += group.m_components.size() - updatedCount;
+		}
+
+		for (const Wave& wave : scheduledPhase.m_waves)
+		{
+			if (!runWave(scheduledPhase, wave, roots))
+			{
+				// The groups may refer to destroyed components
+				rebuild(roots);
+				break;
+			}
+		}
+
+		m_commands.apply();
+	}
+
+	void UpdateScheduler::updateTransforms(const std::vector<Entity*>& roots)
+	{
+		m_transformHierarchy.update(roots);
+	}
+
+	const std::unordered_map<ComponentTypeId, UpdateScheduler::UpdateCounters>& UpdateScheduler::getUpdateCounters() const
+	{
+		return m_counters;
+	}
+
+	void UpdateScheduler::resetUpdateCounters()
+	{
+		m_counters.clear();
+	}
+
+	bool UpdateScheduler::isOutdated(const std::vector<Entity*>& roots) const
+	{
+		return m_hierarchyVersion != Entity::s_hierarchyVersion || m_componentsVersion != Entity::s_componentsVersion
+			|| m_roots != roots;
+	}
+
+	void UpdateScheduler::rebuild(const std::vector<Entity*>& roots)
+	{
+		m_transformHierarchy.update(roots);
+
+		for (Phase& phase : m_phases)
+			phase.m_groups.clear();
+
+		m_componentSlots.clear();
+
+		static const ComponentUpdateInfo& defaultInfo = getComponentUpdateInfo<Component>();
+		std::unordered_map<const ComponentUpdateInfo*, size_t> groupIndices;
+
+		for (const Entity* entity : m_transformHierarchy.getEntities())
+		{
+			for (Component* component : entity->m_componentIndex.find(getComponentTypeId<Component>()))
+			{
+				const ComponentUpdateInfo* info = component->m_updateInfo != nullptr ? component->m_updateInfo : &defaultInfo;
+				const size_t phase = static_cast<size_t>(info->m_phase);
+				std::vector<TypeGroup>& groups = m_phases[phase].m_groups;
+
+				const auto [iter, isNewGroup] = groupIndices.try_emplace(info, groups.size());
+
+				if (isNewGroup)
+					groups.push_back({ info, {}, {}, {}, false });
+
+				std::vector<Component*>& components = groups[iter->second].m_components;
+
+				m_componentSlots.emplace(component, ComponentSlot{ phase, iter->second, components.size() });
+				components.push_back(component);
+			}
+		}
+
+		for (Phase& phase : m_phases)
+			for (TypeGroup& group : phase.m_groups)
+				group.m_isSplit = canSplit(group);
+
+		for (Phase& phase : m_phases)
+			buildWaves(phase);
+
+		refreshAwakeComponents();
+
+		m_roots = roots;
+		m_hierarchyVersion = Entity::s_hierarchyVersion;
+		m_componentsVersion = Entity::s_componentsVersion;
+	}
+
+	bool UpdateScheduler::canSplit(const TypeGroup& group)
+	{
+		if (!group.m_info->m_isParallel)
+			return false;
+
+		if (!std::ranges::binary_search(group.m_info->m_writes, getTransformAccessId()))
+			return true;
+
+		std::unordered_set<const DataStructure::Node*> owners;
+
+		for (const Component* component : group.m_components)
+		{
+			if (!owners.insert(&component->getOwner()).second)
+				return false;
+		}
+
+		for (const Component* component : group.m_components)
+		{
+			for (const DataStructure::Node* node = component->getOwner().getParent(); node != nullptr; node = node->getParent())
+			{
+				if (owners.contains(node))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	void UpdateScheduler::refreshAwakeComponents()
+	{
+		{
+			// The refill covers every logged change. Read first so a change made during it is applied by the next phase
+			std::scoped_lock lock(Component::s_stateChangesMutex);
+
+			Component::s_stateChanges.clear();
+			m_stateChangeCount = Component::s_stateChangeCount.load(std::memory_order_relaxed);
+		}
+
+		for (Phase& phase : m_phases)
+		{
+			for (TypeGroup& group : phase.m_groups)
+			{
+				group.m_awakeComponents.clear();
+				group.m_awakeIndices.clear();
+
+				if (!group.m_info->m_isTicked)
+					continue;
+
+				for (size_t i = 0; i < group.m_components.size(); i++)
+				{
+					Component* component = group.m_components[i];
+
+					if (component->isActive() && component->isAwake())
+					{
+						group.m_awakeComponents.push_back(component);
+						group.m_awakeIndices.push_back(i);
+					}
+				}
+			}
+		}
+	}
+
+	void UpdateScheduler::applyStateChanges()
+	{
+		std::unique_lock lock(Component::s_stateChangesMutex);
+
+		std::vector<ComponentHandle>& changes = Component::s_stateChanges;
+		const uint64_t changeCount = Component::s_stateChangeCount.load(std::memory_order_relaxed);
+
+		// Another scheduler trimmed changes this one didn't apply yet
+		if (changeCount - changes.size() > m_stateChangeCount)
+		{
+			lock.unlock();
+			refreshAwakeComponents();
+			return;
+		}
+
+		for (size_t i = changes.size() - (changeCount - m_stateChangeCount); i < changes.size(); i++)
+		{
+			// Destroyed components were removed from the groups by the last rebuild
+			if (const Component* component = Component::find(changes[i]))
+				refreshAwakeComponent(*component);
+		}
+
+		changes.clear();
+		m_stateChangeCount = changeCount;
+	}
+
+	void UpdateScheduler::refreshAwakeComponent(const Component& component)
+	{
+		const auto slot = m_componentSlots.find(&component);
+
+		// Components added since the last rebuild are sorted out by the next one
+		if (slot == m_componentSlots.end())
+			return;
+
+		const auto [phase, groupIndex, index] = slot->second;
+		TypeGroup& group = m_phases[phase].m_groups[groupIndex];
+
+		if (!group.m_info->m_isTicked)
+			return;
+
+		const auto position = std::ranges::lower_bound(group.m_awakeIndices, index);
+		const auto offset = position - group.m_awakeIndices.begin();
+		const bool isListed = position != group.m_awakeIndices.end() && *position == index;
+
+		if (isListed == (component.isActive() && component.isAwake()))
+			return;
+
+		if (isListed)
+		{
+			group.m_awakeIndices.erase(position);
+			group.m_awakeComponents.erase(group.m_awakeComponents.begin() + offset);
+		}
+		else
+		{
+			group.m_awakeIndices.insert(position, index);
+			group.m_awakeComponents.insert(group.m_awakeComponents.begin() + offset, group.m_components[index]);
+		}
+	}
+
+	void UpdateScheduler::buildWaves(Phase& phase)
+	{
+		phase.m_waves.clear();
+
+		// Waves before a main thread wave are done by the time it runs
+		size_t firstAvailableWave = 0;
+
+		for (size_t group = 0; group < phase.m_groups.size(); group++)
+		{
+			const ComponentUpdateInfo& info = *phase.m_groups[group].m_info;
+
+			if (!info.m_isTicked)
+				continue;
+
+			if (!info.m_isThreadSafe)
+			{
+				phase.m_waves.push_back({ { group }, true, accessesTransforms(info) });
+				firstAvailableWave = phase.m_waves.size();
+				continue;
+			}
+
+			// Runs right after the last wave it conflicts with, to keep the declared order between conflicting types
+			size_t targetWave = firstAvailableWave;
+
+			for (size_t wave = phase.m_waves.size(); wave > firstAvailableWave; wave--)
+			{
+				const auto conflicts = [&phase, &info](const size_t otherGroup)
+				{
+					return info.conflictsWith(*phase.m_groups[otherGroup].m_info);
+				};
+
+				if (std::ranges::any_of(phase.m_waves[wave - 1].m_groups, conflicts))
+				{
+					targetWave = wave;
+					break;
+				}
+			}
+
+			if (targetWave == phase.m_waves.size())
+				phase.m_waves.push_back({ {}, false, false });
+
+			phase.m_waves[targetWave].m_groups.push_back(group);
+			phase.m_waves[targetWave].m_accessesTransforms |= accessesTransforms(info);
+		}
+	}
+
+	bool UpdateScheduler::runWave(const Phase& phase, const Wave& wave, const std::vector<Entity*>& roots)
+	{
+		if (wave.m_isMainThread)
+		{
+			for (Component* component : phase.m_groups[wave.m_groups.front()].m_awakeComponents)
+			{
+				component->update();
+
+				if (m_hierarchyVersion != Entity::s_hierarchyVersion || m_componentsVersion != Entity::s_componentsVersion)
+					return false;
+			}
+
+			return true;
+		}
+
+		// Resolving the global transforms up front keeps their lazy resolution from writing to shared entities
+		if (wave.m_accessesTransforms)
+			m_transformHierarchy.update(roots);
+
+		m_jobs.clear();
+
+		for (const size_t group : wave.m_groups)
+		{
+			const size_t count = phase.m_groups[group].m_awakeComponents.size();
+			const size_t jobSize = phase.m_groups[group].m_isSplit ? JOB_SIZE : count;
+
+			for (size_t begin = 0; begin < count; begin += jobSize)
+				m_jobs.push_back({ group, begin, std::min(begin + jobSize, count) });
+		}
+
+		LGL_SERVICE(Jobs::JobSystem).parallelFor(m_jobs.size(), 1, [this, &phase](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				const Job& job = m_jobs[i];
+				const std::vector<Component*>& components = phase.m_groups[job.m_group].m_awakeComponents;
+
+				for (size_t component = job.m_begin; component < job.m_end; component++)
+					components[component]->update();
+			}
+		});
+
+		// Thread safe updates must record their structural changes (see StructuralCommandBuffer)
+		ASSERT(m_hierarchyVersion == Entity::s_hierarchyVersion && m_componentsVersion == Entity::s_componentsVersion);
+
+		return true;
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "Geometry/AABB.h"
+#include "Vector/Vector3.h"
+
+namespace Bench
+{
+	// Every benchmark draws its inputs from the same seed so runs stay comparable with each other
+	constexpr unsigned g_seed = 42;
+
+	// Volume given to each collider - the world grows with the collider count so the density stays constant
+	constexpr float g_volumePerCollider = 64.f;
+
+	/**
+	 * \brief Gets the half size of a world holding the given number of colliders at the benchmarks' density
+	 * \param count The number of colliders in the world
+	 * \return The world's half size
+	 */
+	inline float worldExtent(const size_t count)
+	{
+		return std::cbrt(static_cast<float>(count) * g_volumePerCollider) * .5f;
+	}
+
+	/**
+	 * \brief Generates the given number of boxes, of 0.5 to 2 units, spread uniformly in a world of constant density
+	 * \param count The number of boxes to generate
+	 * \return The generated boxes
+	 */
+	inline std::vector<LibMath::AABB> randomBoxes(const size_t count)
+	{
+		const float extent = worldExtent(count);
+
+		std::mt19937 generator(g_seed);
+		std::uniform_real_distribution<float> position(-extent, extent);
+		std::uniform_real_distribution<float> halfSize(.25f, 1.f);
+
+		std::vector<LibMath::AABB> boxes(count);
+
+		for (LibMath::AABB& box : boxes)
+		{
+			const LibMath::Vector3 center(position(generator), position(generator), position(generator));
+			box = LibMath::AABB::fromCenterExtents(center, { halfSize(generator), halfSize(generator), halfSize(generator) });
+		}
+
+		return boxes;
+	}
+
+	/**
+	 * \brief Generates the given number of normalized directions
+	 * \param count The number of directions to generate
+	 * \return The generated directions
+	 */
+	inline std::vector<LibMath::Vector3> randomDirections(const size_t count)
+	{
+		std::mt19937 generator(g_seed + 1);
+		std::uniform_real_distribution<float> component(-1.f, 1.f);
+
+		std::vector<LibMath::Vector3> directions(count);
+
+		for (LibMath::Vector3& direction : directions)
+		{
+			do
+				direction = { component(generator), component(generator), component(generator) };
+			while (direction.magnitudeSquared() < .01f);
+
+			direction = direction.normalized();
+		}
+
+		return directions;
+	}
+
+	/**
+	 * \brief Fills the given broadphase with a proxy per given box, then finishes its deferred work
+	 * \param broadphase The broadphase to fill
+	 * \param boxes The proxies' boxes
+	 * \param proxies Filled with the proxies' ids, in the boxes' order
+	 */
+	template <typename Broadphase>
+	void buildBroadphase(Broadphase& broadphase, const std::vector<LibMath::AABB>& boxes, std::vector<uint32_t>& proxies)
+	{
+		proxies.resize(boxes.size());
+
+		for (size_t i = 0; i < boxes.size(); i++)
+			proxies[i] = broadphase.createProxy(boxes[i], { static_cast<uint32_t>(i), 1 });
+
+		broadphase.update();
+	}
+}
@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "DynamicAABBTree.h"
+
+using namespace LibGL;
+using namespace LibGL::Physics;
+using namespace LibMath;
+using namespace Bench;
+
+// Compares the dynamic AABB tree with the linear scans it replaced, from 100 to 50k colliders
+namespace
+{
+	constexpr size_t g_rayCount = 256;
+
+	DynamicAABBTree buildTree(const std::vector<AABB>& boxes, std::vector<uint32_t>& proxies)
+	{
+		DynamicAABBTree tree;
+		proxies.resize(boxes.size());
+
+		for (size_t i = 0; i < boxes.size(); i++)
+			proxies[i] = tree.createProxy(boxes[i], { static_cast<uint32_t>(i), 1 });
+
+		return tree;
+	}
+
+	void treeBuild(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+
+		for (auto _ : state)
+		{
+			DynamicAABBTree tree = buildTree(boxes, proxies);
+			benchmark::DoNotOptimize(tree.getHeight());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void treeRefitSmallMoves(benchmark::State& state)
+	{
+		std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		DynamicAABBTree tree = buildTree(boxes, proxies);
+
+		// Every collider moves a bit each frame, staying within its fat box
+		Vector3 offset(DynamicAABBTree::FAT_MARGIN * .5f, 0.f, 0.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < boxes.size(); i++)
+				tree.moveProxy(proxies[i], { boxes[i].m_min + offset, boxes[i].m_max + offset });
+
+			offset = -offset;
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void treeRefitReinserts(benchmark::State& state)
+	{
+		std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		DynamicAABBTree tree = buildTree(boxes, proxies);
+
+		// A tenth of the colliders leave their fat box each frame
+		const size_t movedCount = boxes.size() / 10;
+		Vector3 offset(1.f, 0.f, 0.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < movedCount; i++)
+			{
+				boxes[i] = { boxes[i].m_min + offset, boxes[i].m_max + offset };
+				tree.moveProxy(proxies[i], boxes[i]);
+			}
+
+			offset = -offset;
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(movedCount));
+	}
+
+	void treePairs(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		const DynamicAABBTree tree = buildTree(boxes, proxies);
+		size_t pairCount = 0;
+
+		for (auto _ : state)
+		{
+			pairCount = 0;
+
+			for (const AABB& box : boxes)
+			{
+				tree.query(box, [&pairCount](uint32_t)
+				{
+					pairCount++;
+					return true;
+				});
+			}
+
+			benchmark::DoNotOptimize(pairCount);
+		}
+
+		state.counters["candidates"] = static_cast<double>(pairCount);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void bruteForcePairs(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		size_t pairCount = 0;
+
+		for (auto _ : state)
+		{
+			pairCount = 0;
+
+			for (const AABB& box : boxes)
+			{
+				for (const AABB& other : boxes)
+					pairCount += box.intersects(other);
+			}
+
+			benchmark::DoNotOptimize(pairCount);
+		}
+
+		state.counters["candidates"] = static_cast<double>(pairCount);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void treeRaycasts(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<AABB> boxes = randomBoxes(size);
+		const std::vector<Vector3> directions = randomDirections(g_rayCount);
+		std::vector<uint32_t> proxies;
+		const DynamicAABBTree tree = buildTree(boxes, proxies);
+		const float maxDistance = worldExtent(size);
+
+		for (auto _ : state)
+		{
+			for (const Vector3& direction : directions)
+			{
+				const Vector3 inverseDirection = Vector3::one() / direction;
+				float closest = maxDistance;
+
+				// Shortens the ray to each hit, like a closest hit query
+				tree.raycast(Vector3::zero(), direction, maxDistance, [&](const uint32_t proxy)
+				{
+					float distanceIn, distanceOut;
+					tree.getFatBox(proxy).raycast(Vector3::zero(), inverseDirection, distanceIn, distanceOut);
+
+					closest = std::min(closest, std::max(distanceIn, 0.f));
+					return closest;
+				});
+
+				benchmark::DoNotOptimize(closest);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_rayCount));
+	}
+
+	void bruteForceRaycasts(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<AABB> boxes = randomBoxes(size);
+		const std::vector<Vector3> directions = randomDirections(g_rayCount);
+		const float maxDistance = worldExtent(size);
+
+		for (auto _ : state)
+		{
+			for (const Vector3& direction : directions)
+			{
+				const Vector3 inverseDirection = Vector3::one() / direction;
+				float closest = maxDistance;
+
+				for (const AABB& box : boxes)
+				{
+					float distanceIn, distanceOut;
+
+					if (box.raycast(Vector3::zero(), inverseDirection, distanceIn, distanceOut))
+						closest = std::min(closest, std::max(distanceIn, 0.f));
+				}
+
+				benchmark::DoNotOptimize(closest);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_rayCount));
+	}
+}
+
+BENCHMARK(treeBuild)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(treeRefitSmallMoves)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(treeRefitReinserts)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(treePairs)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(bruteForcePairs)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(treeRaycasts)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(bruteForceRaycasts)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
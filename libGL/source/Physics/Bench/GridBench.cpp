@@ -0,0 +1,110 @@
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "DynamicAABBTree.h"
+#include "SpatialHashGrid.h"
+#include "SweepAndPrune.h"
+
+using namespace LibGL;
+using namespace LibGL::Physics;
+using namespace LibMath;
+using namespace Bench;
+
+// Compares the spatial hash grid with the other broadphases on refits and on small volume queries
+namespace
+{
+	constexpr size_t	g_queryCount = 1024;
+	constexpr float		g_queryRadius = 2.f;	// About a gameplay trigger's range
+
+	void gridBuild(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+
+		for (auto _ : state)
+		{
+			SpatialHashGrid broadphase;
+			buildBroadphase(broadphase, boxes, proxies);
+			benchmark::DoNotOptimize(broadphase.getPairCount());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void gridRefitReinserts(benchmark::State& state)
+	{
+		std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		SpatialHashGrid broadphase;
+		buildBroadphase(broadphase, boxes, proxies);
+
+		// A tenth of the colliders leave their fat box each frame
+		const size_t movedCount = boxes.size() / 10;
+		Vector3 offset(1.f, 0.f, 0.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < movedCount; i++)
+			{
+				boxes[i] = { boxes[i].m_min + offset, boxes[i].m_max + offset };
+				broadphase.moveProxy(proxies[i], boxes[i]);
+			}
+
+			offset = -offset;
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(movedCount));
+	}
+
+	template <typename Broadphase>
+	void smallQueries(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<AABB> boxes = randomBoxes(size);
+		std::vector<uint32_t> proxies;
+		Broadphase broadphase;
+		buildBroadphase(broadphase, boxes, proxies);
+
+		const float extent = worldExtent(size);
+		std::mt19937 generator(g_seed + 2);
+		std::uniform_real_distribution<float> position(-extent, extent);
+		std::vector<AABB> queries(g_queryCount);
+
+		for (AABB& query : queries)
+		{
+			const Vector3 center(position(generator), position(generator), position(generator));
+			query = AABB::fromCenterExtents(center, Vector3(g_queryRadius));
+		}
+
+		size_t candidateCount = 0;
+
+		for (auto _ : state)
+		{
+			candidateCount = 0;
+
+			for (const AABB& query : queries)
+			{
+				broadphase.query(query, [&candidateCount](uint32_t)
+				{
+					candidateCount++;
+					return true;
+				});
+			}
+
+			benchmark::DoNotOptimize(candidateCount);
+		}
+
+		state.counters["candidates"] = static_cast<double>(candidateCount);
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_queryCount));
+	}
+}
+
+BENCHMARK(gridBuild)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(gridRefitReinserts)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(smallQueries<SpatialHashGrid>)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(smallQueries<DynamicAABBTree>)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(smallQueries<SweepAndPrune>)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
@@ -0,0 +1,4 @@
+#include <benchmark/benchmark.h>
+
+// Run with --benchmark_filter=<regex> to compare a subset, e.g. --benchmark_filter=Queries
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "DynamicAABBTree.h"
+
+using namespace LibGL;
+using namespace LibGL::Physics;
+using namespace LibMath;
+using namespace Bench;
+
+// Compares tracing coherent rays one by one with tracing them in packets, as for visibility sampling
+namespace
+{
+	constexpr size_t g_raysPerSide = 16;
+
+	/**
+	 * \brief Generates a grid of rays cast from outside the world towards its middle plane, neighbours being close
+	 * \param extent The world's half size
+	 * \param directions Filled with the rays' normalized directions
+	 * \return The rays' shared origin
+	 */
+	Vector3 viewRays(const float extent, std::vector<Vector3>& directions)
+	{
+		const Vector3 origin(-2.f * extent, 0.f, 0.f);
+		const float step = 2.f * extent / static_cast<float>(g_raysPerSide - 1);
+
+		directions.clear();
+
+		for (size_t y = 0; y < g_raysPerSide; y++)
+		{
+			for (size_t z = 0; z < g_raysPerSide; z++)
+			{
+				const Vector3 target(0.f, -extent + static_cast<float>(y) * step, -extent + static_cast<float>(z) * step);
+				directions.push_back((target - origin).normalized());
+			}
+		}
+
+		return origin;
+	}
+
+	void treeSingleRays(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<AABB> boxes = randomBoxes(size);
+		std::vector<uint32_t> proxies;
+		DynamicAABBTree tree;
+		buildBroadphase(tree, boxes, proxies);
+
+		std::vector<Vector3> directions;
+		const Vector3 origin = viewRays(worldExtent(size), directions);
+		const float maxDistance = 4.f * worldExtent(size);
+
+		for (auto _ : state)
+		{
+			for (const Vector3& direction : directions)
+			{
+				const Vector3 inverseDirection = Vector3::one() / direction;
+				float closest = maxDistance;
+
+				// Shortens the ray to each hit, like a closest hit query
+				tree.raycast(origin, direction, maxDistance, [&](const uint32_t proxy)
+				{
+					float distanceIn, distanceOut;
+					tree.getFatBox(proxy).raycast(origin, inverseDirection, distanceIn, distanceOut);
+
+					closest = std::min(closest, std::max(distanceIn, 0.f));
+					return closest;
+				});
+
+				benchmark::DoNotOptimize(closest);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(directions.size()));
+	}
+
+	void treePacketRays(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<AABB> boxes = randomBoxes(size);
+		std::vector<uint32_t> proxies;
+		DynamicAABBTree tree;
+		buildBroadphase(tree, boxes, proxies);
+
+		std::vector<Vector3> directions;
+		const Vector3 origin = viewRays(worldExtent(size), directions);
+		const float maxDistance = 4.f * worldExtent(size);
+
+		IBroadphase::RayPacket packet;
+		packet.m_rayCount = IBroadphase::PACKET_SIZE;
+		packet.m_origins.fill(origin);
+		packet.m_maxDistances.fill(maxDistance);
+
+		for (auto _ : state)
+		{
+			for (size_t first = 0; first < directions.size(); first += IBroadphase::PACKET_SIZE)
+			{
+				std::copy_n(directions.begin() + static_cast<ptrdiff_t>(first), IBroadphase::PACKET_SIZE,
+					packet.m_directions.begin());
+
+				std::array<float, IBroadphase::PACKET_SIZE> closest;
+				closest.fill(maxDistance);
+
+				tree.raycastPacket(packet, [&](const size_t ray, const uint32_t proxy)
+				{
+					float distanceIn, distanceOut;
+					tree.getFatBox(proxy).raycast(origin, Vector3::one() / packet.m_directions[ray], distanceIn, distanceOut);
+
+					closest[ray] = std::min(closest[ray], std::max(distanceIn, 0.f));
+					return closest[ray];
+				});
+
+				benchmark::DoNotOptimize(closest);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(directions.size()));
+	}
+}
+
+BENCHMARK(treeSingleRays)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(treePacketRays)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
@@ -0,0 +1,111 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "DynamicAABBTree.h"
+#include "SweepAndPrune.h"
+
+using namespace LibGL;
+using namespace LibGL::Physics;
+using namespace LibMath;
+using namespace Bench;
+
+// Compares sweep and prune with the dynamic AABB tree on the work of a physics step: refits and pair reads
+namespace
+{
+	void sapBuild(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+
+		for (auto _ : state)
+		{
+			SweepAndPrune broadphase;
+			buildBroadphase(broadphase, boxes, proxies);
+			benchmark::DoNotOptimize(broadphase.getPairCount());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void sapRefitSmallMoves(benchmark::State& state)
+	{
+		std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		SweepAndPrune broadphase;
+		buildBroadphase(broadphase, boxes, proxies);
+
+		// Every collider moves a bit each frame, staying within its fat box
+		Vector3 offset(SweepAndPrune::FAT_MARGIN * .5f, 0.f, 0.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < boxes.size(); i++)
+				broadphase.moveProxy(proxies[i], { boxes[i].m_min + offset, boxes[i].m_max + offset });
+
+			offset = -offset;
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void sapRefitReinserts(benchmark::State& state)
+	{
+		std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		SweepAndPrune broadphase;
+		buildBroadphase(broadphase, boxes, proxies);
+
+		// A tenth of the colliders leave their fat box each frame
+		const size_t movedCount = boxes.size() / 10;
+		Vector3 offset(1.f, 0.f, 0.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < movedCount; i++)
+			{
+				boxes[i] = { boxes[i].m_min + offset, boxes[i].m_max + offset };
+				broadphase.moveProxy(proxies[i], boxes[i]);
+			}
+
+			offset = -offset;
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(movedCount));
+	}
+
+	template <typename Broadphase>
+	void cachedPairs(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(static_cast<size_t>(state.range(0)));
+		std::vector<uint32_t> proxies;
+		Broadphase broadphase;
+		buildBroadphase(broadphase, boxes, proxies);
+		size_t pairCount = 0;
+
+		// Reads each collider's pairs, like the rigidbodies' narrowphase
+		for (auto _ : state)
+		{
+			pairCount = 0;
+
+			for (const uint32_t proxy : proxies)
+			{
+				for (const uint32_t other : broadphase.getOverlaps(proxy))
+					pairCount += other != proxy;
+			}
+
+			benchmark::DoNotOptimize(pairCount);
+		}
+
+		state.counters["candidates"] = static_cast<double>(pairCount);
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+
+BENCHMARK(sapBuild)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(sapRefitSmallMoves)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(sapRefitReinserts)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(cachedPairs<SweepAndPrune>)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
+BENCHMARK(cachedPairs<DynamicAABBTree>)->RangeMultiplier(10)->Range(100, 10000)->Arg(50000);
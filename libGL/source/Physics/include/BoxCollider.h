@@ -1,5 +1,6 @@
 #pragma once
 #include "ICollider.h"
+#include "Geometry/AABB.h"
 #include "Vector/Vector3.h"
 
 namespace LibGL
@@ -67,6 +68,23 @@ namespace LibGL::Physics
 		 */
 		bool checkCapsule(const CapsuleCollider& other) const;
 
+		/**
+		 * \brief Checks if the given world space box is colliding with the box collider.
+		 * \param box The box to check collision for.
+		 * \return True if the box is colliding with the box collider.
+		 * False otherwise.
+		 */
+		bool overlapsBox(const LibMath::AABB& box) const override;
+
+		/**
+		 * \brief Checks if the given world space sphere is colliding with the box collider.
+		 * \param center The sphere's center
+		 * \param radius The sphere's radius
+		 * \return True if the sphere is colliding with the box collider.
+		 * False otherwise.
+		 */
+		bool overlapsSphere(const LibMath::Vector3& center, float radius) const override;
+
 		/**
 		 * \brief Computes the closest point to the given position inside the collider
 		 * \param point The point of which we want the closest in-bounds point
@@ -85,6 +103,12 @@ namespace LibGL::Physics
 		LibMath::Vector3	m_center;
 		LibMath::Vector3	m_size;
 
+		/**
+		 * \brief Computes the box collider's axis aligned bounding box from its bounds
+		 * \return The box collider's axis aligned bounding box
+		 */
+		LibMath::AABB getBox() const;
+
 		/**
 		 * \brief Calculates a box collider's bounds
 		 * \param center The box collider's center
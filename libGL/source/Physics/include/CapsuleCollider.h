@@ -85,6 +85,23 @@ namespace LibGL::Physics
 		 */
 		bool checkCapsule(const CapsuleCollider& other) const;
 
+		/**
+		 * \brief Checks if the given world space box is colliding with the capsule collider.
+		 * \param box The box to check collision for.
+		 * \return True if the box is colliding with the capsule collider.
+		 * False otherwise.
+		 */
+		bool overlapsBox(const LibMath::AABB& box) const override;
+
+		/**
+		 * \brief Checks if the given world space sphere is colliding with the capsule collider.
+		 * \param center The sphere's center
+		 * \param radius The sphere's radius
+		 * \return True if the sphere is colliding with the capsule collider.
+		 * False otherwise.
+		 */
+		bool overlapsSphere(const LibMath::Vector3& center, float radius) const override;
+
 		/**
 		 * \brief Computes the closest point to the given position inside the collider
 		 * \param point The point of which we want the closest in-bounds point
@@ -1,4 +1,5 @@
 #pragma once
+#include <span>
 #include <vector>
 
 #include "Vector/Vector3.h"
@@ -16,6 +17,27 @@ namespace LibGL::Physics
 	std::vector<ICollider*> overlapBox(const LibMath::Vector3& center,
 		const LibMath::Vector3& size);
 
+	/**
+	 * \brief Fills the given buffer with active colliders overlapping the given box, without allocating.
+	 * \param center The center of the box
+	 * \param size The size of the box
+	 * \param results The buffer to fill. The search stops once it is full
+	 * \return The number of colliders written to the buffer
+	 */
+	size_t overlapBox(const LibMath::Vector3& center, const LibMath::Vector3& size,
+		std::span<ICollider*> results);
+
+	/**
+	 * \brief Calls the given visitor for each active collider overlapping the given box, without allocating.
+	 * \param center The center of the box
+	 * \param size The size of the box
+	 * \param visitor Called with each overlapping collider. Returns false to stop the search.
+	 * Must not add, remove or move colliders
+	 */
+	template <typename Visitor>
+	void visitBoxOverlaps(const LibMath::Vector3& center, const LibMath::Vector3& size,
+		Visitor&& visitor);
+
 	/**
 	 * \brief Gets all active colliders overlapping the given sphere.
 	 * \param center The center of the sphere
@@ -25,6 +47,27 @@ namespace LibGL::Physics
 	std::vector<ICollider*> overlapSphere(const LibMath::Vector3& center,
 		float radius);
 
+	/**
+	 * \brief Fills the given buffer with active colliders overlapping the given sphere, without allocating.
+	 * \param center The center of the sphere
+	 * \param radius The radius of the sphere
+	 * \param results The buffer to fill. The search stops once it is full
+	 * \return The number of colliders written to the buffer
+	 */
+	size_t overlapSphere(const LibMath::Vector3& center, float radius,
+		std::span<ICollider*> results);
+
+	/**
+	 * \brief Calls the given visitor for each active collider overlapping the given sphere, without allocating.
+	 * \param center The center of the sphere
+	 * \param radius The radius of the sphere
+	 * \param visitor Called with each overlapping collider. Returns false to stop the search.
+	 * Must not add, remove or move colliders
+	 */
+	template <typename Visitor>
+	void visitSphereOverlaps(const LibMath::Vector3& center, float radius,
+		Visitor&& visitor);
+
 	/**
 	 * \brief Gets all active colliders overlapping the given capsule.
 	 * \param center The center of the capsule
@@ -36,3 +79,5 @@ namespace LibGL::Physics
 	std::vector<ICollider*> overlapCapsule(const LibMath::Vector3& center,
 		const LibMath::Vector3& up, float height, float radius);
 }
+
+#include "ColliderOverlaps.inl"
@@ -0,0 +1,43 @@
+#pragma once
+#include "ColliderOverlaps.h"
+
+#include "IBroadphase.h"
+#include "ICollider.h"
+#include "Geometry/AABB.h"
+
+namespace LibGL::Physics
+{
+	template <typename Visitor>
+	void visitBoxOverlaps(const LibMath::Vector3& center, const LibMath::Vector3& size, Visitor&& visitor)
+	{
+		const LibMath::AABB box = LibMath::AABB::fromCenterExtents(center, size / 2.f);
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+
+		broadphase.query(box, [&broadphase, &box, &visitor](const uint32_t proxy)
+		{
+			ICollider* collider = ICollider::find(broadphase.getCollider(proxy));
+
+			if (collider == nullptr || !collider->isActive() || !collider->overlapsBox(box))
+				return true;
+
+			return static_cast<bool>(visitor(*collider));
+		});
+	}
+
+	template <typename Visitor>
+	void visitSphereOverlaps(const LibMath::Vector3& center, const float radius, Visitor&& visitor)
+	{
+		const LibMath::AABB box = LibMath::AABB::fromCenterExtents(center, LibMath::Vector3(radius));
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+
+		broadphase.query(box, [&broadphase, &center, radius, &visitor](const uint32_t proxy)
+		{
+			ICollider* collider = ICollider::find(broadphase.getCollider(proxy));
+
+			if (collider == nullptr || !collider->isActive() || !collider->overlapsSphere(center, radius))
+				return true;
+
+			return static_cast<bool>(visitor(*collider));
+		});
+	}
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Component.h"
+#include "IBroadphase.h"
+#include "Geometry/AABB.h"
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+	/**
+	 * \brief Bounding volume hierarchy over the colliders' world bounds, used as broadphase.
+	 * Each collider is a leaf (a proxy) holding its fat box. Leaves are inserted next to the sibling which grows
+	 * the tree's surface the least, then the ancestors are rotated to keep the tree balanced (see balance).
+	 * Queries only visit the subtrees whose boxes overlap the queried volume, in O(log n) for small volumes.
+	 * Raycasts visit the nearest subtrees first, and packets of rays share a single traversal.
+	 * The pairs of a leaf are found by querying its fat box whenever it is reinserted
+	 */
+	class DynamicAABBTree final : public IBroadphase
+	{
+	public:
+		static constexpr uint32_t NULL_NODE = NULL_PROXY;
+
+		DynamicAABBTree() = default;
+		DynamicAABBTree(const DynamicAABBTree& other) = default;
+		DynamicAABBTree(DynamicAABBTree&& other) noexcept = default;
+		~DynamicAABBTree() override = default;
+
+		DynamicAABBTree& operator=(const DynamicAABBTree& other) = default;
+		DynamicAABBTree& operator=(DynamicAABBTree&& other) noexcept = default;
+
+		/**
+		 * \brief Adds a leaf for the given collider to the tree
+		 * \param box The collider's world bounding box
+		 * \param collider The collider's handle
+		 * \return The leaf's proxy id, valid until the leaf is destroyed
+		 */
+		uint32_t createProxy(const LibMath::AABB& box, ComponentHandle collider) override;
+
+		/**
+		 * \brief Removes the given leaf from the tree
+		 * \param proxy The leaf's proxy id
+		 */
+		void destroyProxy(uint32_t proxy) override;
+
+		/**
+		 * \brief Updates the given leaf's box. The leaf is only reinserted if the box left its fat box
+		 * \param proxy The leaf's proxy id
+		 * \param box The collider's new world bounding box
+		 * \return True if the leaf was reinserted. False otherwise.
+		 */
+		bool moveProxy(uint32_t proxy, const LibMath::AABB& box) override;
+
+		/**
+		 * \brief Gets the broadphase's implementation type
+		 * \return EBroadphaseType::DYNAMIC_AABB_TREE
+		 */
+		EBroadphaseType getType() const override;
+
+		/**
+		 * \brief Gets the enlarged box stored for the given leaf
+		 * \param proxy The leaf's proxy id
+		 * \return The leaf's fat box
+		 */
+		const LibMath::AABB& getFatBox(uint32_t proxy) const override;
+
+		/**
+		 * \brief Gets the collider of the given leaf
+		 * \param proxy The leaf's proxy id
+		 * \return The leaf's collider handle
+		 */
+		ComponentHandle getCollider(uint32_t proxy) const override;
+
+		/**
+		 * \brief Calls the given callback for each leaf whose fat box overlaps the given box, without indirection
+		 * \param box The queried box
+		 * \param callback Called with each overlapping leaf's proxy id. Returns false to stop the query
+		 */
+		template <typename Callback>
+		void query(const LibMath::AABB& box, Callback&& callback) const;
+
+		/**
+		 * \brief Calls the given callback for each leaf whose fat box the given ray crosses within the given distance,
+		 * without indirection. The nodes are visited front to back, so the leaves behind a hit are mostly skipped
+		 * \param origin The ray's origin
+		 * \param direction The ray's normalized direction
+		 * \param maxDistance The distance up to which the ray is tested
+		 * \param callback Called with each crossed leaf's proxy id. Returns the distance up to which the ray should
+		 * keep being tested, so the remaining leaves behind a hit are skipped. Negative to stop the query
+		 */
+		template <typename Callback>
+		void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			Callback&& callback) const;
+
+		/**
+		 * \brief Gets the number of leaves in the tree
+		 * \return The tree's proxy count
+		 */
+		size_t getProxyCount() const override;
+
+		/**
+		 * \brief Gets the height of the tree. 0 for an empty tree or a single leaf
+		 * \return The tree's height
+		 */
+		uint32_t getHeight() const;
+
+		/**
+		 * \brief Gets the ratio between the sum of the nodes' surfaces and the root's surface - lower is better
+		 * \return The tree's surface area heuristic cost
+		 */
+		float getAreaRatio() const;
+
+	private:
+		static constexpr uint32_t FREE_HEIGHT = UINT32_MAX;
+
+		/**
+		 * \brief A leaf (a collider's fat box) or a branch (the box enclosing its two children)
+		 */
+		struct TreeNode
+		{
+			LibMath::AABB	m_box;
+			ComponentHandle	m_collider;
+			uint32_t		m_parent = NULL_NODE;	// The next free node's index while the node is free
+			uint32_t		m_child1 = NULL_NODE;
+			uint32_t		m_child2 = NULL_NODE;
+			uint32_t		m_height = 0;			// 0 for leaves, FREE_HEIGHT for free nodes
+
+			bool isLeaf() const
+			{
+				return m_child1 == NULL_NODE;
+			}
+		};
+
+		/**
+		 * \brief A node left to visit by a raycast, with the distance at which the ray enters it
+		 */
+		struct RayStackEntry
+		{
+			uint32_t	m_node;
+			float		m_entryDistance;
+		};
+
+		std::vector<TreeNode>	m_nodes;
+		uint32_t				m_root = NULL_NODE;
+		uint32_t				m_freeNode = NULL_NODE;
+		size_t					m_proxyCount = 0;
+
+		void queryProxies(const LibMath::AABB& box, void* callback, QueryFunction function) const override;
+
+		void raycastProxies(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			void* callback, RaycastFunction function) const override;
+
+		/**
+		 * \brief Traces the given rays together: each visited node's box is tested against all of them at once
+		 * (see raycastPacket)
+		 * \param packet The rays
+		 * \param callback The type erased callback
+		 * \param function Calls the callback
+		 */
+		void raycastPacketProxies(const RayPacket& packet, void* callback, PacketRaycastFunction function) const override;
+
+		/**
+		 * \brief Takes a node from the free list, growing the node array if it is empty
+		 * \return The allocated node's index
+		 */
+		uint32_t allocateNode();
+
+		/**
+		 * \brief Gives the given node back to the free list
+		 * \param node The node's index
+		 */
+		void freeNode(uint32_t node);
+
+		/**
+		 * \brief Attaches the given leaf next to the sibling which minimizes the growth of the tree's surface
+		 * \param leaf The leaf's index
+		 */
+		void insertLeaf(uint32_t leaf);
+
+		/**
+		 * \brief Detaches the given leaf, replacing its parent by its sibling
+		 * \param leaf The leaf's index
+		 */
+		void removeLeaf(uint32_t leaf);
+
+		/**
+		 * \brief Refits the boxes and heights from the given node up to the root, rotating the unbalanced nodes on the way
+		 * \param node The index of the first node to refit
+		 */
+		void refitAncestors(uint32_t node);
+
+		/**
+		 * \brief Swaps the given node's higher child with its lower grandchild if their heights differ by more than 1
+		 * \param node The node's index
+		 * \return The index of the node now at the given node's place
+		 */
+		uint32_t balance(uint32_t node);
+	};
+}
+
+#include "DynamicAABBTree.inl"
@@ -0,0 +1,124 @@
+#pragma once
+#include "DynamicAABBTree.h"
+
+#include "DataStructure/SmallVector.h"
+
+namespace LibGL::Physics
+{
+	template <typename Callback>
+	void DynamicAABBTree::query(const LibMath::AABB& box, Callback&& callback) const
+	{
+		if (m_root == NULL_NODE)
+			return;
+
+		DataStructure::SmallVector<uint32_t, 64> stack;
+		stack.pushBack(m_root);
+
+		while (!stack.isEmpty())
+		{
+			const uint32_t index = stack.back();
+			const TreeNode& node = m_nodes[index];
+			stack.popBack();
+
+			if (!node.m_box.intersects(box))
+				continue;
+
+			if (node.isLeaf())
+			{
+				if (!callback(index))
+					return;
+
+				continue;
+			}
+
+			stack.pushBack(node.m_child1);
+			stack.pushBack(node.m_child2);
+		}
+	}
+
+	template <typename Callback>
+	void DynamicAABBTree::raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction,
+		float maxDistance, Callback&& callback) const
+	{
+		if (m_root == NULL_NODE)
+			return;
+
+		const LibMath::Vector3 inverseDirection = LibMath::Vector3::one() / direction;
+
+		// Gets whether the ray enters the given node within the max distance, and the distance at which it does
+		const auto isCrossed = [&](const uint32_t index, float& outEntryDistance)
+		{
+			float distanceOut;
+
+			if (!m_nodes[index].m_box.raycast(origin, inverseDirection, outEntryDistance, distanceOut))
+				return false;
+
+			outEntryDistance = outEntryDistance > 0.f ? outEntryDistance : 0.f;
+			return outEntryDistance <= maxDistance;
+		};
+
+		float rootDistance;
+
+		if (!isCrossed(m_root, rootDistance))
+			return;
+
+		DataStructure::SmallVector<RayStackEntry, 64> stack;
+		stack.pushBack({ m_root, rootDistance });
+
+		while (!stack.isEmpty())
+		{
+			const auto [index, entryDistance] = stack.back();
+			stack.popBack();
+
+			// The hits found since the node was stacked may already be closer than it
+			if (entryDistance > maxDistance)
+				continue;
+
+			const TreeNode& node = m_nodes[index];
+
+			if (node.isLeaf())
+			{
+				maxDistance = callback(index);
+
+				if (maxDistance < 0.f)
+					return;
+
+				continue;
+			}
+
+			float distance1, distance2;
+			const bool isChild1Crossed = isCrossed(node.m_child1, distance1);
+			const bool isChild2Crossed = isCrossed(node.m_child2, distance2);
+
+			if (isChild1Crossed && isChild2Crossed)
+			{
+				bool isChild1First = distance1 < distance2;
+
+				// When the ray starts in both children, the one whose center is further along the ray comes last
+				if (distance1 == distance2)
+				{
+					const LibMath::AABB& box1 = m_nodes[node.m_child1].m_box;
+					const LibMath::AABB& box2 = m_nodes[node.m_child2].m_box;
+
+					isChild1First = (box2.m_min + box2.m_max - box1.m_min - box1.m_max).dot(direction) >= 0.f;
+				}
+
+				// Visits the nearest child first so its hits can cut the farthest one off
+				if (isChild1First)
+				{
+					stack.pushBack({ node.m_child2, distance2 });
+					stack.pushBack({ node.m_child1, distance1 });
+				}
+				else
+				{
+					stack.pushBack({ node.m_child1, distance1 });
+					stack.pushBack({ node.m_child2, distance2 });
+				}
+			}
+			else if (isChild1Crossed)
+				stack.pushBack({ node.m_child1, distance1 });
+			else if (isChild2Crossed)
+				stack.pushBack({ node.m_child2, distance2 });
+		}
+	}
+}
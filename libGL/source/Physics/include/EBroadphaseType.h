@@ -0,0 +1,11 @@
+#pragma once
+
+namespace LibGL::Physics
+{
+	enum class EBroadphaseType
+	{
+		DYNAMIC_AABB_TREE,
+		SWEEP_AND_PRUNE,
+		SPATIAL_HASH_GRID
+	};
+}
@@ -0,0 +1,232 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include "Component.h"
+#include "EBroadphaseType.h"
+#include "PairCache.h"
+#include "Eventing/Event.h"
+#include "Geometry/AABB.h"
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+	/**
+	 * \brief Spatial structure over the colliders' world bounds, answering which colliders may touch a volume.
+	 * Each collider is a proxy holding its bounding box enlarged by a margin, so small moves don't change the structure.
+	 * The proxies whose fat boxes overlap are kept in a persistent pair cache, which only changes when proxies move
+	 */
+	class IBroadphase
+	{
+	public:
+		typedef Event<ComponentHandle, ComponentHandle> OverlapEvent;
+
+		static constexpr uint32_t	NULL_PROXY = UINT32_MAX;
+		static constexpr float		FAT_MARGIN = .1f;	// Added to each side of the proxies' boxes
+		static constexpr size_t		PACKET_SIZE = 4;	// Max number of rays traced together by raycastPacket
+
+		/**
+		 * \brief Rays traced together by raycastPacket
+		 */
+		struct RayPacket
+		{
+			std::array<LibMath::Vector3, PACKET_SIZE>	m_origins;
+			std::array<LibMath::Vector3, PACKET_SIZE>	m_directions;	// Normalized
+			std::array<float, PACKET_SIZE>				m_maxDistances {};
+			size_t										m_rayCount = 0;
+		};
+
+		/**
+		 * \brief Invoked with the colliders of each pair starting or stopping to overlap, while the proxies are updated.
+		 * The actions may run on a worker thread and must not use the broadphase
+		 */
+		OverlapEvent	m_overlapBeginEvent;
+		OverlapEvent	m_overlapEndEvent;
+
+		IBroadphase() = default;
+		IBroadphase(const IBroadphase& other) = default;
+		IBroadphase(IBroadphase&& other) noexcept = default;
+		virtual ~IBroadphase() = default;
+
+		IBroadphase& operator=(const IBroadphase& other) = default;
+		IBroadphase& operator=(IBroadphase&& other) noexcept = default;
+
+		/**
+		 * \brief Adds a proxy for the given collider
+		 * \param box The collider's world bounding box
+		 * \param collider The collider's handle
+		 * \return The proxy's id, valid until the proxy is destroyed
+		 */
+		virtual uint32_t createProxy(const LibMath::AABB& box, ComponentHandle collider) = 0;
+
+		/**
+		 * \brief Removes the given proxy, ending its pairs
+		 * \param proxy The proxy's id
+		 */
+		virtual void destroyProxy(uint32_t proxy) = 0;
+
+		/**
+		 * \brief Updates the given proxy's box. Nothing changes if the box is still inside the proxy's fat box
+		 * \param proxy The proxy's id
+		 * \param box The collider's new world bounding box
+		 * \return True if the proxy's fat box changed. False otherwise.
+		 */
+		virtual bool moveProxy(uint32_t proxy, const LibMath::AABB& box) = 0;
+
+		/**
+		 * \brief Finishes the work deferred by the proxies' creations and moves, if any.
+		 * Called once the proxies are up to date, before the broadphase is queried
+		 */
+		virtual void update() {}
+
+		/**
+		 * \brief Gets the broadphase's implementation type
+		 * \return The broadphase's type
+		 */
+		virtual EBroadphaseType getType() const = 0;
+
+		/**
+		 * \brief Gets the enlarged box stored for the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's fat box
+		 */
+		virtual const LibMath::AABB& getFatBox(uint32_t proxy) const = 0;
+
+		/**
+		 * \brief Gets the collider of the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's collider handle
+		 */
+		virtual ComponentHandle getCollider(uint32_t proxy) const = 0;
+
+		/**
+		 * \brief Gets the number of proxies
+		 * \return The broadphase's proxy count
+		 */
+		virtual size_t getProxyCount() const = 0;
+
+		/**
+		 * \brief Gets the proxies whose fat boxes overlap the given proxy's
+		 * \param proxy The proxy's id
+		 * \return A view over the overlapping proxies, invalidated by the next proxy change
+		 */
+		std::span<const uint32_t> getOverlaps(uint32_t proxy) const;
+
+		/**
+		 * \brief Gets the number of overlapping proxy pairs
+		 * \return The pair cache's size
+		 */
+		size_t getPairCount() const;
+
+		/**
+		 * \brief Calls the given callback for each proxy whose fat box overlaps the given box
+		 * \param box The queried box
+		 * \param callback Called with each overlapping proxy's id. Returns false to stop the query
+		 */
+		template <typename Callback>
+		void query(const LibMath::AABB& box, Callback&& callback) const;
+
+		/**
+		 * \brief Calls the given callback for each proxy whose fat box the given ray crosses within the given distance
+		 * \param origin The ray's origin
+		 * \param direction The ray's normalized direction
+		 * \param maxDistance The distance up to which the ray is tested
+		 * \param callback Called with each crossed proxy's id. Returns the distance up to which the ray should
+		 * keep being tested, so the proxies behind a hit can be skipped. Negative to stop the query
+		 */
+		template <typename Callback>
+		void raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			Callback&& callback) const;
+
+		/**
+		 * \brief Calls the given callback for each proxy whose fat box one of the given rays crosses within its distance.
+		 * Meant for coherent rays (e.g. cast from the same point), which implementations may trace together
+		 * \param packet The rays
+		 * \param callback Called with each crossing ray's index in the packet and the crossed proxy's id. Returns the distance
+		 * up to which this ray should keep being tested. Negative to stop testing this ray
+		 */
+		template <typename Callback>
+		void raycastPacket(const RayPacket& packet, Callback&& callback) const;
+
+	protected:
+		typedef bool (*QueryFunction)(void* callback, uint32_t proxy);
+		typedef float (*RaycastFunction)(void* callback, uint32_t proxy);
+		typedef float (*PacketRaycastFunction)(void* callback, size_t ray, uint32_t proxy);
+
+		/**
+		 * \brief Calls the given query callback for each proxy whose fat box overlaps the given box (see query)
+		 * \param box The queried box
+		 * \param callback The type erased callback
+		 * \param function Calls the callback
+		 */
+		virtual void queryProxies(const LibMath::AABB& box, void* callback, QueryFunction function) const = 0;
+
+		/**
+		 * \brief Calls the given raycast callback for each proxy crossed by the given ray (see raycast)
+		 * \param origin The ray's origin
+		 * \param direction The ray's normalized direction
+		 * \param maxDistance The distance up to which the ray is tested
+		 * \param callback The type erased callback
+		 * \param function Calls the callback
+		 */
+		virtual void raycastProxies(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			void* callback, RaycastFunction function) const = 0;
+
+		/**
+		 * \brief Calls the given raycast callback for each proxy crossed by one of the given rays (see raycastPacket).
+		 * Traces the rays one by one by default
+		 * \param packet The rays
+		 * \param callback The type erased callback
+		 * \param function Calls the callback
+		 */
+		virtual void raycastPacketProxies(const RayPacket& packet, void* callback, PacketRaycastFunction function) const;
+
+		/**
+		 * \brief Computes the fat box of the given box
+		 * \param box The collider's bounding box
+		 * \return The box enlarged by the margin
+		 */
+		static LibMath::AABB fatten(const LibMath::AABB& box);
+
+		/**
+		 * \brief Checks whether the given fat box can be kept for the given box: it must contain the box,
+		 * without having grown much larger than it
+		 * \param fatBox The proxy's fat box
+		 * \param box The collider's new bounding box
+		 * \return True if the fat box is still valid. False otherwise.
+		 */
+		static bool fits(const LibMath::AABB& fatBox, const LibMath::AABB& box);
+
+		/**
+		 * \brief Adds the given pair to the cache, notifying the listeners if it wasn't there yet
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 */
+		void beginOverlap(uint32_t proxyA, uint32_t proxyB);
+
+		/**
+		 * \brief Removes the given pair from the cache, notifying the listeners if it was there
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 */
+		void endOverlap(uint32_t proxyA, uint32_t proxyB);
+
+		/**
+		 * \brief Ends every pair of the given proxy
+		 * \param proxy The proxy's id
+		 */
+		void endOverlaps(uint32_t proxy);
+
+		/**
+		 * \brief Pairs the given proxy with the proxies its fat box overlaps, and ends its other pairs
+		 * \param proxy The proxy's id
+		 */
+		void updateOverlaps(uint32_t proxy);
+
+	private:
+		PairCache	m_pairs;
+	};
+}
+
+#include "IBroadphase.inl"
@@ -0,0 +1,43 @@
+#pragma once
+#include <type_traits>
+
+#include "IBroadphase.h"
+
+namespace LibGL::Physics
+{
+	template <typename Callback>
+	void IBroadphase::query(const LibMath::AABB& box, Callback&& callback) const
+	{
+		typedef std::remove_reference_t<Callback> CallbackT;
+
+		queryProxies(box, const_cast<std::remove_const_t<CallbackT>*>(&callback), [](void* erased, const uint32_t proxy) -> bool
+		{
+			return (*static_cast<CallbackT*>(erased))(proxy);
+		});
+	}
+
+	template <typename Callback>
+	void IBroadphase::raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, const float maxDistance,
+		Callback&& callback) const
+	{
+		typedef std::remove_reference_t<Callback> CallbackT;
+
+		raycastProxies(origin, direction, maxDistance, const_cast<std::remove_const_t<CallbackT>*>(&callback),
+			[](void* erased, const uint32_t proxy) -> float
+			{
+				return (*static_cast<CallbackT*>(erased))(proxy);
+			});
+	}
+
+	template <typename Callback>
+	void IBroadphase::raycastPacket(const RayPacket& packet, Callback&& callback) const
+	{
+		typedef std::remove_reference_t<Callback> CallbackT;
+
+		raycastPacketProxies(packet, const_cast<std::remove_const_t<CallbackT>*>(&callback),
+			[](void* erased, const size_t ray, const uint32_t proxy) -> float
+			{
+				return (*static_cast<CallbackT*>(erased))(ray, proxy);
+			});
+	}
+}
@@ -1,7 +1,14 @@
 #pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Component.h"
+#include "DynamicAABBTree.h"
+#include "EBroadphaseType.h"
+#include "IBroadphase.h"
+#include "Geometry/AABB.h"
 #include "Vector/Vector3.h"
 
 namespace LibGL
@@ -55,14 +62,59 @@ namespace LibGL::Physics
 	class ICollider : public Component
 	{
 	public:
-		virtual ~ICollider() override;
+		typedef ComponentTypeList<ICollider, Component> LookupTypes;
+
+		static constexpr uint8_t	LAYER_COUNT = 32;
+		static constexpr uint32_t	ALL_LAYERS = UINT32_MAX;	// Layer mask matching every collider
+
+		ICollider(const ICollider& other);
+		ICollider(ICollider&& other) noexcept;
+		~ICollider() override;
+
+		ICollider& operator=(const ICollider& other);
+		ICollider& operator=(ICollider&& other) noexcept;
 
 		/**
-		 * \brief Gets the collider's bounding data in world space
+		 * \brief Gets the collider's bounding data in world space.
+		 * Cached by the broadphase update which follows a change of the owner's transform, computed until then
 		 * \return The collider's bounds in world space
 		 */
 		Bounds getBounds() const;
 
+		/**
+		 * \brief Gets the box enclosing both the collider's bounding sphere and bounding box in world space.
+		 * Every collision check fails for colliders whose bounding boxes don't overlap.
+		 * Cached by the broadphase update which follows a change of the owner's transform, computed until then
+		 * \return The collider's world bounding box
+		 */
+		LibMath::AABB getBoundingBox() const;
+
+		/**
+		 * \brief Gets the collider's proxy in the broadphase
+		 * \return The collider's proxy id. IBroadphase::NULL_PROXY until the next broadphase access
+		 */
+		uint32_t getProxy() const;
+
+		/**
+		 * \brief Gets the collider's layer, used to filter the colliders queries can hit
+		 * \return The collider's layer index, in [0, LAYER_COUNT[
+		 */
+		uint8_t getLayer() const;
+
+		/**
+		 * \brief Sets the collider's layer, used to filter the colliders queries can hit
+		 * \param layer The collider's new layer index, in [0, LAYER_COUNT[
+		 * \throw std::out_of_range if the layer isn't lower than LAYER_COUNT
+		 */
+		void setLayer(uint8_t layer);
+
+		/**
+		 * \brief Checks whether the collider's layer is part of the given layer mask
+		 * \param layerMask The mask with the bit of each accepted layer set
+		 * \return True if the collider's layer is in the mask. False otherwise.
+		 */
+		bool isInLayers(uint32_t layerMask) const;
+
 		/**
 		 * \brief Checks if a given point is colliding with the collider.
 		 * \param point The point to check collision for.
@@ -89,6 +141,25 @@ namespace LibGL::Physics
 		 */
 		virtual bool check(const ICollider& other) const;
 
+		/**
+		 * \brief Checks if the given world space box is colliding with the collider.
+		 * Compares it with the collider's bounding sphere by default
+		 * \param box The box to check collision for.
+		 * \return True if the box is colliding with the collider.
+		 * False otherwise.
+		 */
+		virtual bool overlapsBox(const LibMath::AABB& box) const;
+
+		/**
+		 * \brief Checks if the given world space sphere is colliding with the collider.
+		 * Compares it with the collider's bounding sphere by default
+		 * \param center The sphere's center
+		 * \param radius The sphere's radius
+		 * \return True if the sphere is colliding with the collider.
+		 * False otherwise.
+		 */
+		virtual bool overlapsSphere(const LibMath::Vector3& center, float radius) const;
+
 		/**
 		 * \brief Computes the closest point to the given position inside the collider
 		 * \param point The point of which we want the closest in-bounds point
@@ -104,18 +175,84 @@ namespace LibGL::Physics
 		virtual LibMath::Vector3 getClosestPointOnSurface(const LibMath::Vector3& point) const = 0;
 
 		/**
-		 * \brief Gets a list of all loaded colliders
-		 * \return A list of all loaded colliders
+		 * \brief Gets the collider referred to by the given handle
+		 * \param handle The collider's handle
+		 * \return A pointer to the collider. nullptr if it was destroyed
 		 */
-		static std::vector<ICollider*> getColliders();
+		static ICollider* find(ComponentHandle handle);
+
+		/**
+		 * \brief Gets the broadphase holding every collider, once the proxies of the colliders which moved are updated.
+		 * Queries go through it to only test the colliders near the queried volume - an unbounded box visits every collider.
+		 * It is derived from the entities' transforms: it must not be used while another thread changes them
+		 * \return The colliders' broadphase
+		 */
+		static const IBroadphase& getBroadphase();
+
+		/**
+		 * \brief Replaces the broadphase by one of the given type, moving every collider's proxy over.
+		 * The former broadphase's event subscriptions are lost.
+		 * Must be called from the main thread, while no collider is queried
+		 * \param type The new broadphase's type
+		 */
+		static void setBroadphase(EBroadphaseType type);
+
+		/**
+		 * \brief Replaces the broadphase by the given one, moving every collider's proxy over.
+		 * Used to configure the broadphase (e.g. a SpatialHashGrid's cell size).
+		 * The former broadphase's event subscriptions are lost.
+		 * Must be called from the main thread, while no collider is queried
+		 * \param broadphase The new broadphase, without proxies
+		 */
+		static void setBroadphase(std::unique_ptr<IBroadphase> broadphase);
 
 	protected:
 		ICollider(Entity& owner, const Bounds& bounds);
 
 	private:
-		inline static std::vector<ICollider*> m_colliders{};
+		inline static std::unique_ptr<IBroadphase>	s_broadphase = std::make_unique<DynamicAABBTree>();
+		inline static std::vector<ComponentHandle>	s_outdatedColliders;	// The colliders whose proxy must be created or moved
+		inline static std::vector<uint32_t>			s_movedProxies;			// The proxies whose fat box changed during an update
+		inline static std::mutex					s_broadphaseMutex;		// Concurrent queries may all try to update the proxies
+
+		Bounds				m_bounds;
+		Bounds				m_worldBounds;		// Written under the broadphase's lock while outdated, read-only otherwise
+		LibMath::AABB		m_worldBox;
+		uint32_t			m_proxy = IBroadphase::NULL_PROXY;
+		uint8_t				m_layer = 0;
+		bool				m_isProxyOutdated = false;	// Guarded by the broadphase's lock
+		std::atomic<bool>	m_isWorldBoundsOutdated = true;
 
-		Bounds	m_bounds;
+		/**
+		 * \brief Computes the collider's world bounds from its owner's global transform
+		 * \return The collider's bounds in world space
+		 */
+		Bounds computeWorldBounds() const;
+
+		/**
+		 * \brief Computes the box enclosing both the given bounding sphere and bounding box
+		 * \param worldBounds A collider's bounds in world space
+		 * \return The collider's world bounding box
+		 */
+		static LibMath::AABB computeBoundingBox(const Bounds& worldBounds);
+
+		/**
+		 * \brief Wakes up the bodies whose colliders overlap the given proxy, since it may have been supporting them
+		 * (see Rigidbody::sleep). Needs the broadphase's lock
+		 * \param proxy The proxy's id
+		 */
+		static void wakeUpOverlappingBodies(uint32_t proxy);
+
+		/**
+		 * \brief Outdates the collider's world bounds and queues its proxy for an update on the next broadphase access.
+		 * Can be called from several threads at once, for colliders of different entities
+		 */
+		void onOwnerTransformChange() override;
+
+		/**
+		 * \brief Wakes up the bodies resting against the collider
+		 */
+		void onDisable() override;
 	};
 
 	LibMath::Vector3 getClosestPointOnSegment(const LibMath::Vector3& point,
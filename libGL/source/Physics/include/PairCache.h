@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructure/SmallVector.h"
+
+namespace LibGL::Physics
+{
+	/**
+	 * \brief The persistent set of overlapping proxy pairs of a broadphase.
+	 * Pairs are kept in a hash set for constant time lookups, and each proxy lists the proxies it overlaps,
+	 * so the pairs of a proxy are read without searching
+	 */
+	class PairCache
+	{
+	public:
+		/**
+		 * \brief Adds the given pair to the cache
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 * \return True if the pair wasn't cached yet. False otherwise.
+		 */
+		bool add(uint32_t proxyA, uint32_t proxyB);
+
+		/**
+		 * \brief Removes the given pair from the cache
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 * \return True if the pair was cached. False otherwise.
+		 */
+		bool remove(uint32_t proxyA, uint32_t proxyB);
+
+		/**
+		 * \brief Checks whether the given pair is cached
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 * \return True if the proxies overlap. False otherwise.
+		 */
+		bool contains(uint32_t proxyA, uint32_t proxyB) const;
+
+		/**
+		 * \brief Gets the proxies paired with the given one
+		 * \param proxy The proxy whose pairs to get
+		 * \return A view over the paired proxies, in no particular order, invalidated by the next change
+		 */
+		std::span<const uint32_t> getOverlaps(uint32_t proxy) const;
+
+		/**
+		 * \brief Gets the number of cached pairs
+		 * \return The number of overlapping pairs
+		 */
+		size_t getPairCount() const;
+
+		/**
+		 * \brief Removes every pair
+		 */
+		void clear();
+
+	private:
+		typedef DataStructure::SmallVector<uint32_t, 4> OverlapList;
+
+		std::unordered_set<uint64_t>	m_pairs;
+		std::vector<OverlapList>		m_overlaps;	// The paired proxies of each proxy, by proxy id
+
+		/**
+		 * \brief Gets the given pair's key, which doesn't depend on the proxies' order
+		 * \param proxyA The pair's first proxy
+		 * \param proxyB The pair's second proxy
+		 * \return The pair's key
+		 */
+		static uint64_t getKey(uint32_t proxyA, uint32_t proxyB);
+
+		/**
+		 * \brief Removes the given proxy from the given proxy's overlap list
+		 * \param proxy The proxy whose list to update
+		 * \param other The proxy to remove from the list
+		 */
+		void removeOverlap(uint32_t proxy, uint32_t other);
+	};
+}
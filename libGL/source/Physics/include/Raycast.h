@@ -1,10 +1,13 @@
 #pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "ICollider.h"
 #include "Vector/Vector3.h"
 
 namespace LibGL::Physics
 {
-	class ICollider;
-
 	struct RaycastHit
 	{
 		LibMath::Vector3	m_position = LibMath::Vector3(INFINITY);
@@ -32,4 +35,56 @@ namespace LibGL::Physics
 	 * \return True when the ray intersects with a collider. False otherwise.
 	 */
 	bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, RaycastHit& hitInfo, float maxDistance = INFINITY);
+
+	/**
+	 * \brief Checks collisions for a ray of the given length, from the given point,
+	 * in the given direction, against the active colliders of the given layers.
+	 * \param origin The starting point of the ray in world coordinates
+	 * \param direction The direction of the ray
+	 * \param hitInfo A reference to the object in which the raycast hit information should be output
+	 * \param maxDistance The max distance the ray should check for collisions
+	 * \param layerMask The mask with the bit of each layer the ray can hit set (see ICollider::getLayer)
+	 * \return True when the ray intersects with a collider. False otherwise.
+	 */
+	bool raycast(const LibMath::Vector3& origin, const LibMath::Vector3& direction, RaycastHit& hitInfo,
+		float maxDistance, uint32_t layerMask);
+
+	/**
+	 * \brief Finds every active collider of the given layers hit by a ray of the given length,
+	 * from the given point, in the given direction.
+	 * \param origin The starting point of the ray in world coordinates
+	 * \param direction The direction of the ray
+	 * \param maxDistance The max distance the ray should check for collisions
+	 * \param layerMask The mask with the bit of each layer the ray can hit set (see ICollider::getLayer)
+	 * \return The hits, from the closest to the farthest
+	 */
+	std::vector<RaycastHit> raycastAll(const LibMath::Vector3& origin, const LibMath::Vector3& direction,
+		float maxDistance = INFINITY, uint32_t layerMask = ICollider::ALL_LAYERS);
+
+	/**
+	 * \brief Finds the closest active colliders of the given layers hit by a ray of the given length,
+	 * from the given point, in the given direction, without allocating.
+	 * \param origin The starting point of the ray in world coordinates
+	 * \param direction The direction of the ray
+	 * \param hits The array in which the closest hits should be written, from the closest to the farthest
+	 * \param maxDistance The max distance the ray should check for collisions
+	 * \param layerMask The mask with the bit of each layer the ray can hit set (see ICollider::getLayer)
+	 * \return The number of hits written, at most the array's size
+	 */
+	size_t raycastAll(const LibMath::Vector3& origin, const LibMath::Vector3& direction, std::span<RaycastHit> hits,
+		float maxDistance = INFINITY, uint32_t layerMask = ICollider::ALL_LAYERS);
+
+	/**
+	 * \brief Checks collisions for each of the given rays against the active colliders of the given layers.
+	 * The rays are traced in packets (see IBroadphase::raycastPacket), which pays off when they are coherent,
+	 * e.g. cast from the same point in close directions.
+	 * \param rays The rays to cast, in world coordinates
+	 * \param hits The array in which each ray's closest hit should be written, at the ray's index.
+	 * Rays which hit nothing get a hit without collider
+	 * \param maxDistance The max distance the rays should check for collisions
+	 * \param layerMask The mask with the bit of each layer the rays can hit set (see ICollider::getLayer)
+	 * \throw std::invalid_argument if the hit array is smaller than the ray array
+	 */
+	void raycastBatch(std::span<const Ray> rays, std::span<RaycastHit> hits,
+		float maxDistance = INFINITY, uint32_t layerMask = ICollider::ALL_LAYERS);
 }
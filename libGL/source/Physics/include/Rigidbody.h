@@ -3,18 +3,27 @@
 #include "Component.h"
 #include "ECollisionDetectionMode.h"
 #include "EForceMode.h"
+#include "ICollider.h"
+#include "Transform.h"
 
 namespace LibGL::Physics
 {
-	class ICollider;
-
-	inline static LibMath::Vector3	g_gravity(0.f, -9.8f, 0.f);
-	inline static float				g_friction = .4f;
-	inline static uint8_t			g_continuousCollisionSteps = 8;
+	inline LibMath::Vector3	g_gravity(0.f, -9.8f, 0.f);
+	inline float			g_friction = .4f;
+	inline uint8_t			g_continuousCollisionSteps = 8;
 
 	class Rigidbody final : public Component
 	{
 	public:
+		// Colliding bodies exchange impulses, so the bodies are simulated one after the other, in a single job
+		static constexpr EUpdatePhase UPDATE_PHASE = EUpdatePhase::PHYSICS;
+		static constexpr bool IS_THREAD_SAFE = true;
+		typedef ComponentTypeList<ICollider, LibMath::Transform> UpdateReads;
+		typedef ComponentTypeList<Rigidbody, LibMath::Transform> UpdateWrites;
+
+		// Plain data, always looked up through its owner, so its scene keeps it in dense archetype arrays
+		static constexpr bool IS_RELOCATABLE = true;
+
 		LibMath::Vector3		m_velocity = LibMath::Vector3::zero();
 
 		ECollisionDetectionMode	m_collisionDetectionMode = ECollisionDetectionMode::DISCRETE;
@@ -28,8 +37,19 @@ namespace LibGL::Physics
 
 		void update() override;
 
+		/**
+		 * \brief Changes the body's velocity, waking it up if it gets fast enough
+		 * \param force The force to apply
+		 * \param forceMode How the force changes the velocity
+		 */
 		void addForce(const LibMath::Vector3& force, EForceMode forceMode = EForceMode::FORCE);
 
+		/**
+		 * \brief Stops simulating the body until it is woken up (see Component::setAwake).
+		 * Bodies fall asleep on their own once they rest against a collider, and wake up when a force moves them,
+		 * when their owner is moved, or when a collider they touch moves, is disabled or is destroyed.
+		 * A collider moving against a sleeping body wakes it up on the next broadphase update (see ICollider::getBroadphase)
+		 */
 		void sleep();
 
 		void wakeUp();
@@ -39,11 +59,23 @@ namespace LibGL::Physics
 		LibMath::Vector3 getDraggedVelocity() const;
 
 	private:
-		bool	m_isSleeping = false;
-
 		void simulate();
 
 		static LibMath::Vector3 getBoundsNormal(const ICollider& entityCollider, const ICollider& worldCollider);
+
+		/**
+		 * \brief Applies the impulses and friction of a collision between the given colliders
+		 * \param entityCollider The body's colliding collider
+		 * \param worldCollider The collider hit by the body
+		 * \param velocity The body's velocity before the collision
+		 */
+		void resolveCollision(const ICollider& entityCollider, const ICollider& worldCollider, const LibMath::Vector3& velocity);
+
 		void move();
+
+		/**
+		 * \brief Wakes the body up, as its owner was moved
+		 */
+		void onOwnerTransformChange() override;
 	};
 }
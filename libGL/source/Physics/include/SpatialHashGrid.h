@@ -0,0 +1,175 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Component.h"
+#include "IBroadphase.h"
+#include "Geometry/AABB.h"
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+	/**
+	 * \brief Broadphase splitting space into uniform cubic cells, each listing the proxies whose fat box touches it.
+	 * Only the occupied cells are stored, in a hash map.
+	 * Moving a proxy only updates the cells it entered or left, and small volume queries only read the few cells
+	 * they cover, so the cost doesn't depend on the number of colliders as long as the cell size matches their size.
+	 * Proxies covering too many cells are kept aside and tested by every query
+	 */
+	class SpatialHashGrid final : public IBroadphase
+	{
+	public:
+		static constexpr float	DEFAULT_CELL_SIZE = 4.f;
+		static constexpr size_t	MAX_PROXY_CELLS = 1024;	// Proxies covering more cells are kept out of the grid
+
+		/**
+		 * \brief Creates an empty grid
+		 * \param cellSize The length of the cells' sides, ideally a bit larger than most colliders
+		 */
+		explicit SpatialHashGrid(float cellSize = DEFAULT_CELL_SIZE);
+		SpatialHashGrid(const SpatialHashGrid& other) = default;
+		SpatialHashGrid(SpatialHashGrid&& other) noexcept = default;
+		~SpatialHashGrid() override = default;
+
+		SpatialHashGrid& operator=(const SpatialHashGrid& other) = default;
+		SpatialHashGrid& operator=(SpatialHashGrid&& other) noexcept = default;
+
+		/**
+		 * \brief Adds a proxy for the given collider to the cells its fat box touches
+		 * \param box The collider's world bounding box
+		 * \param collider The collider's handle
+		 * \return The proxy's id, valid until the proxy is destroyed
+		 */
+		uint32_t createProxy(const LibMath::AABB& box, ComponentHandle collider) override;
+
+		/**
+		 * \brief Removes the given proxy from its cells, ending its pairs
+		 * \param proxy The proxy's id
+		 */
+		void destroyProxy(uint32_t proxy) override;
+
+		/**
+		 * \brief Updates the given proxy's box. If it left its fat box, the proxy is moved to the cells it now touches
+		 * \param proxy The proxy's id
+		 * \param box The collider's new world bounding box
+		 * \return True if the proxy's fat box changed. False otherwise.
+		 */
+		bool moveProxy(uint32_t proxy, const LibMath::AABB& box) override;
+
+		/**
+		 * \brief Gets the broadphase's implementation type
+		 * \return EBroadphaseType::SPATIAL_HASH_GRID
+		 */
+		EBroadphaseType getType() const override;
+
+		/**
+		 * \brief Gets the enlarged box stored for the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's fat box
+		 */
+		const LibMath::AABB& getFatBox(uint32_t proxy) const override;
+
+		/**
+		 * \brief Gets the collider of the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's collider handle
+		 */
+		ComponentHandle getCollider(uint32_t proxy) const override;
+
+		/**
+		 * \brief Gets the number of proxies
+		 * \return The broadphase's proxy count
+		 */
+		size_t getProxyCount() const override;
+
+		/**
+		 * \brief Gets the length of the cells' sides
+		 * \return The grid's cell size
+		 */
+		float getCellSize() const;
+
+		/**
+		 * \brief Gets the number of cells holding at least a proxy
+		 * \return The grid's occupied cell count
+		 */
+		size_t getCellCount() const;
+
+	private:
+		static constexpr int32_t	CELL_LIMIT = 1 << 20;	// Cell coordinates are clamped to [-CELL_LIMIT, CELL_LIMIT[
+		static constexpr int		KEY_BITS = 21;			// Bits per coordinate in a cell's key
+
+		typedef std::array<int32_t, 3> Cell;
+
+		/**
+		 * \brief The cells between two corner cells, both included
+		 */
+		struct CellRange
+		{
+			Cell	m_min { 0, 0, 0 };
+			Cell	m_max { -1, -1, -1 };
+
+			bool isEmpty() const;
+			bool contains(const Cell& cell) const;
+			uint64_t getCellCount() const;
+		};
+
+		struct Proxy
+		{
+			LibMath::AABB	m_box;
+			ComponentHandle	m_collider;
+			CellRange		m_cells;
+			uint32_t		m_nextFree = NULL_PROXY;
+			bool			m_isLarge = false;	// Whether the proxy is kept out of the cells (see MAX_PROXY_CELLS)
+			bool			m_isFree = false;
+		};
+
+		std::unordered_map<uint64_t, std::vector<uint32_t>>	m_cells;
+		std::vector<Proxy>									m_proxies;
+		std::vector<uint32_t>								m_largeProxies;
+		CellRange											m_bounds;	// Encloses every cell which held a proxy
+		float												m_cellSize;
+		float												m_inverseCellSize;
+		uint32_t											m_freeProxy = NULL_PROXY;
+		size_t												m_proxyCount = 0;
+
+		void queryProxies(const LibMath::AABB& box, void* callback, QueryFunction function) const override;
+
+		void raycastProxies(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			void* callback, RaycastFunction function) const override;
+
+		/**
+		 * \brief Gets the cells touched by the given box
+		 * \param box The box whose cells to get
+		 * \return The box's cell range
+		 */
+		CellRange getCells(const LibMath::AABB& box) const;
+
+		/**
+		 * \brief Adds the given proxy to its cells, or to the large proxies
+		 * \param proxy The proxy's id
+		 */
+		void insertProxy(uint32_t proxy);
+
+		/**
+		 * \brief Removes the given proxy from its cells, or from the large proxies
+		 * \param proxy The proxy's id
+		 */
+		void removeProxy(uint32_t proxy);
+
+		/**
+		 * \brief Gets the key of the given cell in the cell map
+		 * \param cell The cell's coordinates
+		 * \return The cell's key
+		 */
+		static uint64_t getKey(const Cell& cell);
+
+		/**
+		 * \brief Gets the cell of the given key in the cell map
+		 * \param key The cell's key
+		 * \return The cell's coordinates
+		 */
+		static Cell getCell(uint64_t key);
+	};
+}
@@ -0,0 +1,182 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Component.h"
+#include "IBroadphase.h"
+#include "Geometry/AABB.h"
+#include "Vector/Vector3.h"
+
+namespace LibGL::Physics
+{
+	/**
+	 * \brief Broadphase keeping the proxies' fat box bounds sorted along each axis.
+	 * Moving a proxy re-sorts its bounds in place: since colliders move little from one step to the next,
+	 * each bound only swaps with a few neighbours, and each swap of a lower bound with an upper bound
+	 * starts or ends a pair. Mostly static scenes with many contacts update in near constant time per moved proxy.
+	 * Created proxies are only sorted in on the next update, in a single pass when many are created at once.
+	 * Queries scan the x axis around the queried box; raycasts test every proxy
+	 */
+	class SweepAndPrune final : public IBroadphase
+	{
+	public:
+		static constexpr size_t REBUILD_THRESHOLD = 32;	// Pending proxies from which the axes are sorted again from scratch
+
+		SweepAndPrune() = default;
+		SweepAndPrune(const SweepAndPrune& other) = default;
+		SweepAndPrune(SweepAndPrune&& other) noexcept = default;
+		~SweepAndPrune() override = default;
+
+		SweepAndPrune& operator=(const SweepAndPrune& other) = default;
+		SweepAndPrune& operator=(SweepAndPrune&& other) noexcept = default;
+
+		/**
+		 * \brief Adds a proxy for the given collider. It is sorted in, and paired, on the next update
+		 * \param box The collider's world bounding box
+		 * \param collider The collider's handle
+		 * \return The proxy's id, valid until the proxy is destroyed
+		 */
+		uint32_t createProxy(const LibMath::AABB& box, ComponentHandle collider) override;
+
+		/**
+		 * \brief Removes the given proxy's bounds from the axes, ending its pairs
+		 * \param proxy The proxy's id
+		 */
+		void destroyProxy(uint32_t proxy) override;
+
+		/**
+		 * \brief Updates the given proxy's box. If it left its fat box, the proxy's bounds are moved along the axes,
+		 * updating the pairs on the way
+		 * \param proxy The proxy's id
+		 * \param box The collider's new world bounding box
+		 * \return True if the proxy's fat box changed. False otherwise.
+		 */
+		bool moveProxy(uint32_t proxy, const LibMath::AABB& box) override;
+
+		/**
+		 * \brief Sorts the pending proxies in and pairs them
+		 */
+		void update() override;
+
+		/**
+		 * \brief Gets the broadphase's implementation type
+		 * \return EBroadphaseType::SWEEP_AND_PRUNE
+		 */
+		EBroadphaseType getType() const override;
+
+		/**
+		 * \brief Gets the enlarged box stored for the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's fat box
+		 */
+		const LibMath::AABB& getFatBox(uint32_t proxy) const override;
+
+		/**
+		 * \brief Gets the collider of the given proxy
+		 * \param proxy The proxy's id
+		 * \return The proxy's collider handle
+		 */
+		ComponentHandle getCollider(uint32_t proxy) const override;
+
+		/**
+		 * \brief Gets the number of proxies, pending ones included
+		 * \return The broadphase's proxy count
+		 */
+		size_t getProxyCount() const override;
+
+	private:
+		static constexpr size_t AXIS_COUNT = 3;
+
+		/**
+		 * \brief A proxy's lower or upper bound along an axis
+		 */
+		struct Endpoint
+		{
+			float		m_value;
+			uint32_t	m_data;	// The proxy's id shifted left, with the lowest bit set for upper bounds
+
+			uint32_t getProxy() const
+			{
+				return m_data >> 1;
+			}
+
+			bool isMax() const
+			{
+				return (m_data & 1) != 0;
+			}
+		};
+
+		struct Proxy
+		{
+			LibMath::AABB							m_box;
+			ComponentHandle							m_collider;
+			std::array<uint32_t, AXIS_COUNT>		m_minIndices {};	// The proxy's endpoints' indices, by axis
+			std::array<uint32_t, AXIS_COUNT>		m_maxIndices {};
+			uint32_t								m_nextFree = NULL_PROXY;
+			bool									m_isPending = false;
+			bool									m_isFree = false;
+		};
+
+		std::array<std::vector<Endpoint>, AXIS_COUNT>	m_axes;
+		std::vector<Proxy>								m_proxies;
+		std::vector<uint32_t>							m_pendingProxies;
+		uint32_t										m_freeProxy = NULL_PROXY;
+		size_t											m_proxyCount = 0;
+		float											m_maxWidth = 0.f;	// No sorted fat box is wider along x
+
+		void queryProxies(const LibMath::AABB& box, void* callback, QueryFunction function) const override;
+
+		void raycastProxies(const LibMath::Vector3& origin, const LibMath::Vector3& direction, float maxDistance,
+			void* callback, RaycastFunction function) const override;
+
+		/**
+		 * \brief Checks whether the given endpoint sorts before the other.
+		 * Lower bounds come first at equal values, so boxes which touch overlap
+		 * \param endpoint The first endpoint
+		 * \param other The second endpoint
+		 * \return True if the first endpoint comes first. False otherwise.
+		 */
+		static bool isBefore(const Endpoint& endpoint, const Endpoint& other);
+
+		/**
+		 * \brief Sorts the given pending proxy in by binary search and pairs it with the proxies it overlaps
+		 * \param proxy The proxy's id
+		 */
+		void insertProxy(uint32_t proxy);
+
+		/**
+		 * \brief Sorts every proxy again and pairs the pending ones with the proxies they overlap
+		 */
+		void rebuild();
+
+		/**
+		 * \brief Moves the given endpoint towards the start of the axis until it is sorted
+		 * \param axis The endpoint's axis
+		 * \param index The endpoint's index
+		 */
+		void sortDown(size_t axis, uint32_t index);
+
+		/**
+		 * \brief Moves the given endpoint towards the end of the axis until it is sorted
+		 * \param axis The endpoint's axis
+		 * \param index The endpoint's index
+		 */
+		void sortUp(size_t axis, uint32_t index);
+
+		/**
+		 * \brief Starts or ends the pair of the given endpoints' proxies once the moving endpoint passed the other
+		 * \param moving The endpoint being sorted
+		 * \param passed The endpoint it passed
+		 * \param isMovingDown Whether the moving endpoint went towards the start of the axis
+		 */
+		void onEndpointSwap(const Endpoint& moving, const Endpoint& passed, bool isMovingDown);
+
+		/**
+		 * \brief Updates the endpoint indices stored by the proxies of the given axis' endpoints from the given index
+		 * \param axis The axis to update
+		 * \param first The index of the first moved endpoint
+		 */
+		void updateIndices(size_t axis, size_t first);
+	};
+}
@@ -17,14 +17,7 @@ namespace LibGL::Physics
 
 	bool BoxCollider::check(const Vector3& point) const
 	{
-		const auto [center, size, _] = getBounds();
-
-		const Vector3 min = center - size / 2.f;
-		const Vector3 max = center + size / 2.f;
-
-		return min.m_x <= point.m_x && max.m_x >= point.m_x &&
-			min.m_y <= point.m_y && max.m_y >= point.m_y &&
-			min.m_z <= point.m_z && max.m_z >= point.m_z;
+		return getBox().contains(point);
 	}
 
 	bool BoxCollider::check(const Ray& ray, float& distanceSqr) const
@@ -33,30 +26,11 @@ namespace LibGL::Physics
 		if (!ICollider::check(ray, distanceSqr))
 			return false;
 
-		const auto [center, size, radius] = getBounds();
-
-		const Vector3 boxMin = center - size / 2.f;
-		const Vector3 boxMax = center + size / 2.f;
-
 		const Vector3 dirInverse = Vector3::one() / ray.m_direction.normalized();
 
-		// point = rayOrigin + t * rayDir <=> t = (point - rayOrigin) / rayDir
-		const Vector3 distMinVec = (boxMin - ray.m_origin) * dirInverse;
-		const Vector3 distMaxVec = (boxMax - ray.m_origin) * dirInverse;
-
-		const float distMin = max(max(
-			min(distMinVec.m_x, distMaxVec.m_x),
-			min(distMinVec.m_y, distMaxVec.m_y)),
-			min(distMinVec.m_z, distMaxVec.m_z)
-		);
+		float distMin, distMax;
 
-		const float distMax = min(min(
-			max(distMinVec.m_x, distMaxVec.m_x),
-			max(distMinVec.m_y, distMaxVec.m_y)),
-			max(distMinVec.m_z, distMaxVec.m_z)
-		);
-
-		if (distMax < 0 || distMin > distMax)
+		if (!getBox().raycast(ray.m_origin, dirInverse, distMin, distMax))
 		{
 			distanceSqr = INFINITY;
 			return false;
@@ -85,17 +59,7 @@ namespace LibGL::Physics
 
 	bool BoxCollider::checkBox(const BoxCollider& other) const
 	{
-		const auto [center, size, radius] = getBounds();
-		const auto [otherCenter, otherSize, otherRadius] = other.getBounds();
-
-		const Vector3 min = center - size / 2.f;
-		const Vector3 max = center + size / 2.f;
-		const Vector3 otherMin = otherCenter - otherSize / 2.f;
-		const Vector3 otherMax = otherCenter + otherSize / 2.f;
-
-		return min.m_x <= otherMax.m_x && max.m_x >= otherMin.m_x &&
-			min.m_y <= otherMax.m_y && max.m_y >= otherMin.m_y &&
-			min.m_z <= otherMax.m_z && max.m_z >= otherMin.m_z;
+		return getBox().intersects(other.getBox());
 	}
 
 	bool BoxCollider::checkSphere(const SphereCollider& other) const
@@ -174,13 +138,19 @@ namespace LibGL::Physics
 		return dist < capsuleRadius * capsuleRadius;
 	}
 
-	Vector3 BoxCollider::getClosestPoint(const Vector3& point) const
+	bool BoxCollider::overlapsBox(const AABB& box) const
 	{
-		const auto [center, size, _] = getBounds();
-		const auto min = center - (size / 2.f);
-		const auto max = center + (size / 2.f);
+		return getBox().intersects(box);
+	}
 
-		return clamp(point, min, max);
+	bool BoxCollider::overlapsSphere(const Vector3& center, const float radius) const
+	{
+		return getBox().distanceSquaredFrom(center) <= radius * radius;
+	}
+
+	Vector3 BoxCollider::getClosestPoint(const Vector3& point) const
+	{
+		return getBox().closestPoint(point);
 	}
 
 	Vector3 BoxCollider::getClosestPointOnSurface(const Vector3& point) const
@@ -222,6 +192,12 @@ namespace LibGL::Physics
 			snappedZ;
 	}
 
+	AABB BoxCollider::getBox() const
+	{
+		const auto [center, size, _] = getBounds();
+		return AABB::fromCenterExtents(center, size / 2.f);
+	}
+
 	Bounds BoxCollider::calculateBounds(const Vector3& center, const Vector3& size)
 	{
 		return { center, size, (size / 2.f).magnitude() };
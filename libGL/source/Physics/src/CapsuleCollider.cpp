@@ -4,6 +4,7 @@
 #include "SphereCollider.h"
 
 #include "Entity.h"
+#include "Interpolation.h"
 #include "Debug/Log.h"
 #include "Matrix/Matrix4.h"
 #include "Vector/Vector4.h"
@@ -81,7 +82,7 @@ namespace LibGL::Physics
 		rayClosest = ray.getClosestPoint(capsuleClosest);
 
 		const bool colliding = rayClosest.distanceSquaredFrom(center) <= radius * radius;
-		distanceSqr = colliding ? rayClosest.distanceFrom(ray.m_origin) : INFINITY;
+		distanceSqr = colliding ? rayClosest.distanceSquaredFrom(ray.m_origin) : INFINITY;
 		return colliding;
 	}
 
@@ -144,6 +145,49 @@ namespace LibGL::Physics
 		return closest.distanceSquaredFrom(otherClosest) <= totalRadius * totalRadius;
 	}
 
+	bool CapsuleCollider::overlapsBox(const AABB& box) const
+	{
+		// Check the bounding spheres first to avoid unnecessary computation
+		if (!ICollider::overlapsBox(box))
+			return false;
+
+		const auto [ center, _, halfHeight ] = getBounds();
+		const float radius = getRadius();
+
+		const Vector3 offset = getUpDirection() * (halfHeight - radius);
+		const Vector3 base = center - offset;
+		const Vector3 tip = center + offset;
+
+		// The distance from the box to a point moving along the center segment is convex: ternary search its minimum
+		float start = 0.f;
+		float end = 1.f;
+
+		for (int i = 0; i < 24; i++)
+		{
+			const float third = (end - start) / 3.f;
+
+			if (box.distanceSquaredFrom(lerp(base, tip, start + third)) <
+				box.distanceSquaredFrom(lerp(base, tip, end - third)))
+				end -= third;
+			else
+				start += third;
+		}
+
+		return box.distanceSquaredFrom(lerp(base, tip, (start + end) / 2.f)) <= radius * radius;
+	}
+
+	bool CapsuleCollider::overlapsSphere(const Vector3& sphereCenter, const float sphereRadius) const
+	{
+		const auto [ center, _, halfHeight ] = getBounds();
+		const float radius = getRadius();
+
+		const Vector3 offset = getUpDirection() * (halfHeight - radius);
+		const Vector3 closestPoint = getClosestPointOnSegment(sphereCenter, center - offset, center + offset);
+		const float totalRadius = radius + sphereRadius;
+
+		return sphereCenter.distanceSquaredFrom(closestPoint) <= totalRadius * totalRadius;
+	}
+
 	Vector3 CapsuleCollider::getClosestPoint(const Vector3& point) const
 	{
 		const auto [ center, _, halfHeight ] = getBounds();
@@ -2,73 +2,104 @@
 
 #include <algorithm>
 
-#include "BoxCollider.h"
 #include "CapsuleCollider.h"
 #include "Entity.h"
+#include "IBroadphase.h"
 #include "ICollider.h"
-#include "SphereCollider.h"
 
 using namespace LibMath;
 
 namespace LibGL::Physics
 {
+	namespace
+	{
+		std::vector<ICollider*> getOverlaps(const IBroadphase& broadphase, const ICollider& shape)
+		{
+			std::vector<ICollider*> colliders;
+
+			broadphase.query(shape.getBoundingBox(), [&broadphase, &shape, &colliders](const uint32_t proxy)
+			{
+				ICollider* worldCollider = ICollider::find(broadphase.getCollider(proxy));
+
+				if (worldCollider != nullptr &&
+					worldCollider->isActive() &&
+					shape.check(*worldCollider))
+				{
+					colliders.push_back(worldCollider);
+				}
+
+				return true;
+			});
+
+			return colliders;
+		}
+	}
+
 	std::vector<ICollider*> overlapBox(const Vector3& center, const Vector3& size)
 	{
-		Entity tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
-		const BoxCollider tmpCollider(tmpEntity, center, size);
 		std::vector<ICollider*> colliders;
 
-		for (const auto& worldCollider : ICollider::getColliders())
+		visitBoxOverlaps(center, size, [&colliders](ICollider& collider)
 		{
-			if (worldCollider != nullptr &&
-				worldCollider != &tmpCollider &&
-				worldCollider->isActive() &&
-				tmpCollider.check(*worldCollider))
-			{
-				colliders.push_back(worldCollider);
-			}
-		}
+			colliders.push_back(&collider);
+			return true;
+		});
 
 		return colliders;
 	}
 
+	size_t overlapBox(const Vector3& center, const Vector3& size, const std::span<ICollider*> results)
+	{
+		size_t count = 0;
+
+		if (results.empty())
+			return count;
+
+		visitBoxOverlaps(center, size, [&count, results](ICollider& collider)
+		{
+			results[count++] = &collider;
+			return count < results.size();
+		});
+
+		return count;
+	}
+
 	std::vector<ICollider*> overlapSphere(const Vector3& center, const float radius)
 	{
-		Entity tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
-		const SphereCollider tmpCollider(tmpEntity, center, radius);
 		std::vector<ICollider*> colliders;
 
-		for (const auto& worldCollider : ICollider::getColliders())
+		visitSphereOverlaps(center, radius, [&colliders](ICollider& collider)
 		{
-			if (worldCollider != nullptr &&
-				worldCollider != &tmpCollider &&
-				worldCollider->isActive() &&
-				tmpCollider.check(*worldCollider))
-			{
-				colliders.push_back(worldCollider);
-			}
-		}
+			colliders.push_back(&collider);
+			return true;
+		});
 
 		return colliders;
 	}
 
+	size_t overlapSphere(const Vector3& center, const float radius, const std::span<ICollider*> results)
+	{
+		size_t count = 0;
+
+		if (results.empty())
+			return count;
+
+		visitSphereOverlaps(center, radius, [&count, results](ICollider& collider)
+		{
+			results[count++] = &collider;
+			return count < results.size();
+		});
+
+		return count;
+	}
+
 	std::vector<ICollider*> overlapCapsule(const Vector3& center, const Vector3& up, const float height, const float radius)
 	{
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+
 		Entity tmpEntity(nullptr, { Vector3::zero(), Vector3::zero(), Vector3::one() });
 		const CapsuleCollider tmpCollider(tmpEntity, center, up, height, radius);
-		std::vector<ICollider*> colliders;
 
-		for (const auto& worldCollider : ICollider::getColliders())
-		{
-			if (worldCollider != nullptr &&
-				worldCollider != &tmpCollider &&
-				worldCollider->isActive() &&
-				tmpCollider.check(*worldCollider))
-			{
-				colliders.push_back(worldCollider);
-			}
-		}
-
-		return colliders;
+		return getOverlaps(broadphase, tmpCollider);
 	}
 }
@@ -0,0 +1,475 @@
+#include "DynamicAABBTree.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "Simd.h"
+#include "Debug/Assertion.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+	namespace
+	{
+#ifdef LIBMATH_USE_SIMD
+		static_assert(IBroadphase::PACKET_SIZE == 4, "The packets' rays are tested in a single SSE register");
+#endif
+
+		/**
+		 * \brief The rays of a packet laid out so a box can be tested against all of them at once
+		 */
+		class PacketRays
+		{
+		public:
+			explicit PacketRays(const IBroadphase::RayPacket& packet)
+			{
+				std::array<Vector3, IBroadphase::PACKET_SIZE> origins {};
+				std::array<Vector3, IBroadphase::PACKET_SIZE> inverseDirections {};
+
+				for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+				{
+					origins[ray] = packet.m_origins[ray];
+					inverseDirections[ray] = Vector3::one() / packet.m_directions[ray];
+				}
+
+#ifdef LIBMATH_USE_SIMD
+				m_originX = _mm_setr_ps(origins[0].m_x, origins[1].m_x, origins[2].m_x, origins[3].m_x);
+				m_originY = _mm_setr_ps(origins[0].m_y, origins[1].m_y, origins[2].m_y, origins[3].m_y);
+				m_originZ = _mm_setr_ps(origins[0].m_z, origins[1].m_z, origins[2].m_z, origins[3].m_z);
+
+				m_inverseX = _mm_setr_ps(inverseDirections[0].m_x, inverseDirections[1].m_x,
+					inverseDirections[2].m_x, inverseDirections[3].m_x);
+				m_inverseY = _mm_setr_ps(inverseDirections[0].m_y, inverseDirections[1].m_y,
+					inverseDirections[2].m_y, inverseDirections[3].m_y);
+				m_inverseZ = _mm_setr_ps(inverseDirections[0].m_z, inverseDirections[1].m_z,
+					inverseDirections[2].m_z, inverseDirections[3].m_z);
+#else
+				m_origins = origins;
+				m_inverseDirections = inverseDirections;
+#endif
+			}
+
+			/**
+			 * \brief Gets the rays which enter the given box within their max distance
+			 * \param box The box to test
+			 * \param maxDistances The distance up to which each ray is tested
+			 * \return A mask with the bit of each crossing ray's index set
+			 */
+			unsigned getCrossingRays(const AABB& box, const std::array<float, IBroadphase::PACKET_SIZE>& maxDistances) const
+			{
+#ifdef LIBMATH_USE_SIMD
+				// Same slab test as AABB::raycast, with a ray per lane
+				const __m128 toMinX = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_min.m_x), m_originX), m_inverseX);
+				const __m128 toMinY = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_min.m_y), m_originY), m_inverseY);
+				const __m128 toMinZ = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_min.m_z), m_originZ), m_inverseZ);
+				const __m128 toMaxX = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_max.m_x), m_originX), m_inverseX);
+				const __m128 toMaxY = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_max.m_y), m_originY), m_inverseY);
+				const __m128 toMaxZ = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(box.m_max.m_z), m_originZ), m_inverseZ);
+
+				const __m128 distanceIn = _mm_max_ps(_mm_max_ps(_mm_min_ps(toMinX, toMaxX), _mm_min_ps(toMinY, toMaxY)),
+					_mm_min_ps(toMinZ, toMaxZ));
+				const __m128 distanceOut = _mm_min_ps(_mm_min_ps(_mm_max_ps(toMinX, toMaxX), _mm_max_ps(toMinY, toMaxY)),
+					_mm_max_ps(toMinZ, toMaxZ));
+
+				const __m128 isCrossing = _mm_and_ps(
+					_mm_and_ps(_mm_cmpge_ps(distanceOut, _mm_setzero_ps()), _mm_cmple_ps(distanceIn, distanceOut)),
+					_mm_cmple_ps(distanceIn, _mm_loadu_ps(maxDistances.data())));
+
+				return static_cast<unsigned>(_mm_movemask_ps(isCrossing));
+#else
+				unsigned crossingRays = 0;
+
+				for (size_t ray = 0; ray < IBroadphase::PACKET_SIZE; ray++)
+				{
+					float distanceIn, distanceOut;
+
+					if (box.raycast(m_origins[ray], m_inverseDirections[ray], distanceIn, distanceOut) &&
+						distanceIn <= maxDistances[ray])
+					{
+						crossingRays |= 1u << ray;
+					}
+				}
+
+				return crossingRays;
+#endif
+			}
+
+		private:
+#ifdef LIBMATH_USE_SIMD
+			__m128	m_originX, m_originY, m_originZ;
+			__m128	m_inverseX, m_inverseY, m_inverseZ;
+#else
+			std::array<Vector3, IBroadphase::PACKET_SIZE>	m_origins;
+			std::array<Vector3, IBroadphase::PACKET_SIZE>	m_inverseDirections;
+#endif
+		};
+	}
+
+	uint32_t DynamicAABBTree::createProxy(const AABB& box, const ComponentHandle collider)
+	{
+		const uint32_t proxy = allocateNode();
+
+		TreeNode& leaf = m_nodes[proxy];
+		leaf.m_box = fatten(box);
+		leaf.m_collider = collider;
+		leaf.m_height = 0;
+
+		insertLeaf(proxy);
+		m_proxyCount++;
+
+		updateOverlaps(proxy);
+
+		return proxy;
+	}
+
+	void DynamicAABBTree::destroyProxy(const uint32_t proxy)
+	{
+		ASSERT(proxy < m_nodes.size() && m_nodes[proxy].isLeaf() && m_nodes[proxy].m_height != FREE_HEIGHT);
+
+		endOverlaps(proxy);
+
+		removeLeaf(proxy);
+		freeNode(proxy);
+		m_proxyCount--;
+	}
+
+	bool DynamicAABBTree::moveProxy(const uint32_t proxy, const AABB& box)
+	{
+		ASSERT(proxy < m_nodes.size() && m_nodes[proxy].isLeaf() && m_nodes[proxy].m_height != FREE_HEIGHT);
+
+		if (fits(m_nodes[proxy].m_box, box))
+			return false;
+
+		removeLeaf(proxy);
+		m_nodes[proxy].m_box = fatten(box);
+		insertLeaf(proxy);
+
+		updateOverlaps(proxy);
+
+		return true;
+	}
+
+	EBroadphaseType DynamicAABBTree::getType() const
+	{
+		return EBroadphaseType::DYNAMIC_AABB_TREE;
+	}
+
+	const AABB& DynamicAABBTree::getFatBox(const uint32_t proxy) const
+	{
+		return m_nodes[proxy].m_box;
+	}
+
+	ComponentHandle DynamicAABBTree::getCollider(const uint32_t proxy) const
+	{
+		return m_nodes[proxy].m_collider;
+	}
+
+	size_t DynamicAABBTree::getProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	uint32_t DynamicAABBTree::getHeight() const
+	{
+		return m_root == NULL_NODE ? 0 : m_nodes[m_root].m_height;
+	}
+
+	float DynamicAABBTree::getAreaRatio() const
+	{
+		if (m_root == NULL_NODE)
+			return 0.f;
+
+		const float rootArea = m_nodes[m_root].m_box.surfaceArea();
+		float totalArea = 0.f;
+
+		for (const TreeNode& node : m_nodes)
+		{
+			if (node.m_height != FREE_HEIGHT)
+				totalArea += node.m_box.surfaceArea();
+		}
+
+		return rootArea > 0.f ? totalArea / rootArea : 0.f;
+	}
+
+	void DynamicAABBTree::queryProxies(const AABB& box, void* callback, const QueryFunction function) const
+	{
+		query(box, [callback, function](const uint32_t proxy)
+		{
+			return function(callback, proxy);
+		});
+	}
+
+	void DynamicAABBTree::raycastProxies(const Vector3& origin, const Vector3& direction, const float maxDistance,
+		void* callback, const RaycastFunction function) const
+	{
+		raycast(origin, direction, maxDistance, [callback, function](const uint32_t proxy)
+		{
+			return function(callback, proxy);
+		});
+	}
+
+	void DynamicAABBTree::raycastPacketProxies(const RayPacket& packet, void* callback,
+		const PacketRaycastFunction function) const
+	{
+		ASSERT(packet.m_rayCount <= PACKET_SIZE);
+
+		if (m_root == NULL_NODE || packet.m_rayCount == 0)
+			return;
+
+		const PacketRays rays(packet);
+		std::array<float, PACKET_SIZE> maxDistances = packet.m_maxDistances;
+		unsigned activeRays = (1u << packet.m_rayCount) - 1;
+
+		// The children are visited in the order the packet's average ray meets them
+		Vector3 direction = Vector3::zero();
+
+		for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+			direction += packet.m_directions[ray];
+
+		DataStructure::SmallVector<uint32_t, 64> stack;
+		stack.pushBack(m_root);
+
+		while (!stack.isEmpty())
+		{
+			const uint32_t index = stack.back();
+			const TreeNode& node = m_nodes[index];
+			stack.popBack();
+
+			const unsigned crossingRays = rays.getCrossingRays(node.m_box, maxDistances) & activeRays;
+
+			if (crossingRays == 0)
+				continue;
+
+			if (node.isLeaf())
+			{
+				for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+				{
+					if ((crossingRays & 1u << ray) == 0)
+						continue;
+
+					const float distance = function(callback, ray, index);
+
+					if (distance < 0.f)
+						activeRays &= ~(1u << ray);
+					else
+						maxDistances[ray] = distance;
+				}
+
+				if (activeRays == 0)
+					return;
+
+				continue;
+			}
+
+			const AABB& box1 = m_nodes[node.m_child1].m_box;
+			const AABB& box2 = m_nodes[node.m_child2].m_box;
+
+			// The nearest child is stacked last, so it is visited first
+			if ((box2.m_min + box2.m_max - box1.m_min - box1.m_max).dot(direction) >= 0.f)
+			{
+				stack.pushBack(node.m_child2);
+				stack.pushBack(node.m_child1);
+			}
+			else
+			{
+				stack.pushBack(node.m_child1);
+				stack.pushBack(node.m_child2);
+			}
+		}
+	}
+
+	uint32_t DynamicAABBTree::allocateNode()
+	{
+		if (m_freeNode == NULL_NODE)
+		{
+			if (m_nodes.size() >= NULL_NODE)
+				throw std::length_error("Too many nodes in the tree");
+
+			m_nodes.emplace_back();
+			return static_cast<uint32_t>(m_nodes.size() - 1);
+		}
+
+		const uint32_t node = m_freeNode;
+		m_freeNode = m_nodes[node].m_parent;
+		m_nodes[node] = {};
+
+		return node;
+	}
+
+	void DynamicAABBTree::freeNode(const uint32_t node)
+	{
+		m_nodes[node] = {};
+		m_nodes[node].m_parent = m_freeNode;
+		m_nodes[node].m_height = FREE_HEIGHT;
+		m_freeNode = node;
+	}
+
+	void DynamicAABBTree::insertLeaf(const uint32_t leaf)
+	{
+		if (m_root == NULL_NODE)
+		{
+			m_root = leaf;
+			m_nodes[leaf].m_parent = NULL_NODE;
+			return;
+		}
+
+		const AABB leafBox = m_nodes[leaf].m_box;
+		uint32_t sibling = m_root;
+
+		// Goes down while pairing the leaf with a child costs less than pairing it with the current node
+		while (!m_nodes[sibling].isLeaf())
+		{
+			const TreeNode& node = m_nodes[sibling];
+
+			const float area = node.m_box.surfaceArea();
+			const float combinedArea = node.m_box.merged(leafBox).surfaceArea();
+
+			// Pairing with the current node creates a parent enclosing both
+			const float pairCost = 2.f * combinedArea;
+
+			// Going further down grows the current node's box in any case
+			const float inheritanceCost = 2.f * (combinedArea - area);
+
+			const auto descentCost = [this, &leafBox, inheritanceCost](const uint32_t child)
+			{
+				const AABB& childBox = m_nodes[child].m_box;
+				const float mergedArea = childBox.merged(leafBox).surfaceArea();
+
+				// Pairing with a branch grows it instead of creating a new parent
+				return m_nodes[child].isLeaf() ? mergedArea + inheritanceCost :
+					mergedArea - childBox.surfaceArea() + inheritanceCost;
+			};
+
+			const float cost1 = descentCost(node.m_child1);
+			const float cost2 = descentCost(node.m_child2);
+
+			if (pairCost < cost1 && pairCost < cost2)
+				break;
+
+			sibling = cost1 < cost2 ? node.m_child1 : node.m_child2;
+		}
+
+		const uint32_t oldParent = m_nodes[sibling].m_parent;
+		const uint32_t newParent = allocateNode();
+
+		m_nodes[newParent].m_parent = oldParent;
+		m_nodes[newParent].m_box = m_nodes[sibling].m_box.merged(leafBox);
+		m_nodes[newParent].m_height = m_nodes[sibling].m_height + 1;
+		m_nodes[newParent].m_child1 = sibling;
+		m_nodes[newParent].m_child2 = leaf;
+
+		if (oldParent == NULL_NODE)
+			m_root = newParent;
+		else if (m_nodes[oldParent].m_child1 == sibling)
+			m_nodes[oldParent].m_child1 = newParent;
+		else
+			m_nodes[oldParent].m_child2 = newParent;
+
+		m_nodes[sibling].m_parent = newParent;
+		m_nodes[leaf].m_parent = newParent;
+
+		refitAncestors(newParent);
+	}
+
+	void DynamicAABBTree::removeLeaf(const uint32_t leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NULL_NODE;
+			return;
+		}
+
+		const uint32_t parent = m_nodes[leaf].m_parent;
+		const uint32_t grandParent = m_nodes[parent].m_parent;
+		const uint32_t sibling = m_nodes[parent].m_child1 == leaf ? m_nodes[parent].m_child2 : m_nodes[parent].m_child1;
+
+		m_nodes[sibling].m_parent = grandParent;
+		freeNode(parent);
+
+		if (grandParent == NULL_NODE)
+		{
+			m_root = sibling;
+			return;
+		}
+
+		if (m_nodes[grandParent].m_child1 == parent)
+			m_nodes[grandParent].m_child1 = sibling;
+		else
+			m_nodes[grandParent].m_child2 = sibling;
+
+		refitAncestors(grandParent);
+	}
+
+	void DynamicAABBTree::refitAncestors(uint32_t node)
+	{
+		while (node != NULL_NODE)
+		{
+			node = balance(node);
+
+			TreeNode& current = m_nodes[node];
+			const TreeNode& child1 = m_nodes[current.m_child1];
+			const TreeNode& child2 = m_nodes[current.m_child2];
+
+			current.m_height = 1 + std::max(child1.m_height, child2.m_height);
+			current.m_box = child1.m_box.merged(child2.m_box);
+
+			node = current.m_parent;
+		}
+	}
+
+	uint32_t DynamicAABBTree::balance(const uint32_t node)
+	{
+		TreeNode& a = m_nodes[node];
+
+		if (a.isLeaf() || a.m_height < 2)
+			return node;
+
+		const uint32_t indexB = a.m_child1;
+		const uint32_t indexC = a.m_child2;
+		const int64_t heightDifference = static_cast<int64_t>(m_nodes[indexC].m_height) - m_nodes[indexB].m_height;
+
+		if (heightDifference >= -1 && heightDifference <= 1)
+			return node;
+
+		// Lifts the higher child in place of the node, which takes the child's lower child in exchange
+		const bool isChild2Higher = heightDifference > 1;
+		const uint32_t higher = isChild2Higher ? indexC : indexB;
+		const uint32_t lower = isChild2Higher ? indexB : indexC;
+
+		TreeNode& lifted = m_nodes[higher];
+		const uint32_t grandChild1 = lifted.m_child1;
+		const uint32_t grandChild2 = lifted.m_child2;
+		const bool isGrandChild1Higher = m_nodes[grandChild1].m_height > m_nodes[grandChild2].m_height;
+		const uint32_t kept = isGrandChild1Higher ? grandChild1 : grandChild2;
+		const uint32_t given = isGrandChild1Higher ? grandChild2 : grandChild1;
+
+		lifted.m_child1 = node;
+		lifted.m_child2 = kept;
+		lifted.m_parent = a.m_parent;
+		a.m_parent = higher;
+
+		if (lifted.m_parent == NULL_NODE)
+			m_root = higher;
+		else if (m_nodes[lifted.m_parent].m_child1 == node)
+			m_nodes[lifted.m_parent].m_child1 = higher;
+		else
+			m_nodes[lifted.m_parent].m_child2 = higher;
+
+		if (isChild2Higher)
+			a.m_child2 = given;
+		else
+			a.m_child1 = given;
+
+		m_nodes[given].m_parent = node;
+
+		a.m_box = m_nodes[lower].m_box.merged(m_nodes[given].m_box);
+		a.m_height = 1 + std::max(m_nodes[lower].m_height, m_nodes[given].m_height);
+
+		lifted.m_box = a.m_box.merged(m_nodes[kept].m_box);
+		lifted.m_height = 1 + std::max(a.m_height, m_nodes[kept].m_height);
+
+		return higher;
+	}
+}
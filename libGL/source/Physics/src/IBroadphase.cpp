@@ -0,0 +1,80 @@
+#include "IBroadphase.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+	std::span<const uint32_t> IBroadphase::getOverlaps(const uint32_t proxy) const
+	{
+		return m_pairs.getOverlaps(proxy);
+	}
+
+	size_t IBroadphase::getPairCount() const
+	{
+		return m_pairs.getPairCount();
+	}
+
+	void IBroadphase::raycastPacketProxies(const RayPacket& packet, void* callback, const PacketRaycastFunction function) const
+	{
+		for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+		{
+			raycast(packet.m_origins[ray], packet.m_directions[ray], packet.m_maxDistances[ray],
+				[callback, function, ray](const uint32_t proxy)
+				{
+					return function(callback, ray, proxy);
+				});
+		}
+	}
+
+	AABB IBroadphase::fatten(const AABB& box)
+	{
+		return box.expanded(Vector3(FAT_MARGIN));
+	}
+
+	bool IBroadphase::fits(const AABB& fatBox, const AABB& box)
+	{
+		// Shrinks the fat boxes which got much larger than their collider as well, so they don't bloat the queries
+		return fatBox.contains(box) && box.expanded(Vector3(4.f * FAT_MARGIN)).contains(fatBox);
+	}
+
+	void IBroadphase::beginOverlap(const uint32_t proxyA, const uint32_t proxyB)
+	{
+		if (m_pairs.add(proxyA, proxyB))
+			m_overlapBeginEvent.invoke(getCollider(proxyA), getCollider(proxyB));
+	}
+
+	void IBroadphase::endOverlap(const uint32_t proxyA, const uint32_t proxyB)
+	{
+		if (m_pairs.remove(proxyA, proxyB))
+			m_overlapEndEvent.invoke(getCollider(proxyA), getCollider(proxyB));
+	}
+
+	void IBroadphase::endOverlaps(const uint32_t proxy)
+	{
+		// Ending a pair swaps the proxy's last overlap into its place
+		while (!m_pairs.getOverlaps(proxy).empty())
+			endOverlap(proxy, m_pairs.getOverlaps(proxy).back());
+	}
+
+	void IBroadphase::updateOverlaps(const uint32_t proxy)
+	{
+		const AABB& box = getFatBox(proxy);
+
+		// Ending a pair swaps the proxy's last overlap into its place, which was already checked
+		for (size_t i = m_pairs.getOverlaps(proxy).size(); i-- > 0;)
+		{
+			const uint32_t other = m_pairs.getOverlaps(proxy)[i];
+
+			if (!box.intersects(getFatBox(other)))
+				endOverlap(proxy, other);
+		}
+
+		query(box, [this, proxy](const uint32_t other)
+		{
+			if (other != proxy)
+				beginOverlap(proxy, other);
+
+			return true;
+		});
+	}
+}
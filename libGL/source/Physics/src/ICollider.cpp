@@ -1,8 +1,14 @@
 #include "ICollider.h"
 
+#include <stdexcept>
+#include <utility>
+
 #include "Arithmetic.h"
 #include "Entity.h"
 #include "Interpolation.h"
+#include "Rigidbody.h"
+#include "SpatialHashGrid.h"
+#include "SweepAndPrune.h"
 #include "Vector/Vector4.h"
 
 using namespace LibMath;
@@ -59,26 +65,112 @@ namespace LibGL::Physics
 		return closest.distanceSquaredFrom(otherClosest);
 	}
 
+	ICollider::ICollider(const ICollider& other) :
+		Component(other), m_bounds(other.m_bounds), m_layer(other.m_layer)
+	{
+		onOwnerTransformChange();
+	}
+
+	ICollider::ICollider(ICollider&& other) noexcept :
+		Component(std::move(other)), m_bounds(other.m_bounds), m_layer(other.m_layer)
+	{
+		// The proxy refers to the collider through its handle, which followed the collider
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		m_worldBounds = other.m_worldBounds;
+		m_worldBox = other.m_worldBox;
+		m_proxy = std::exchange(other.m_proxy, IBroadphase::NULL_PROXY);
+		m_isProxyOutdated = other.m_isProxyOutdated;
+		m_isWorldBoundsOutdated = other.m_isWorldBoundsOutdated.load();
+	}
+
 	ICollider::~ICollider()
 	{
-		m_colliders.erase(std::ranges::find(m_colliders, this));
+		// Moved-from colliders have no proxy - the moved collider took it
+		if (m_proxy != IBroadphase::NULL_PROXY)
+		{
+			std::scoped_lock lock(s_broadphaseMutex);
+
+			wakeUpOverlappingBodies(m_proxy);
+			s_broadphase->destroyProxy(m_proxy);
+		}
+	}
+
+	ICollider& ICollider::operator=(const ICollider& other)
+	{
+		if (&other == this)
+			return *this;
+
+		Component::operator=(other);
+		m_bounds = other.m_bounds;
+		m_layer = other.m_layer;
+		onOwnerTransformChange();
+
+		return *this;
+	}
+
+	ICollider& ICollider::operator=(ICollider&& other) noexcept
+	{
+		if (&other == this)
+			return *this;
+
+		// Concurrent queries refresh the proxies and their cached bounds under the same lock
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		// The collider takes the other's handle, so its own proxy would no longer resolve
+		if (m_proxy != IBroadphase::NULL_PROXY)
+			s_broadphase->destroyProxy(m_proxy);
+
+		Component::operator=(std::move(other));
+		m_bounds = other.m_bounds;
+		m_worldBounds = other.m_worldBounds;
+		m_worldBox = other.m_worldBox;
+		m_proxy = std::exchange(other.m_proxy, IBroadphase::NULL_PROXY);
+		m_layer = other.m_layer;
+		m_isProxyOutdated = other.m_isProxyOutdated;
+		m_isWorldBoundsOutdated = other.m_isWorldBoundsOutdated.load();
+
+		return *this;
 	}
 
 	Bounds ICollider::getBounds() const
 	{
-		const Transform transform = getOwner().getGlobalTransform();
-		const Vector3 worldCenter = (transform.getMatrix() * Vector4(m_bounds.m_center, 1.f)).xyz();
-		Vector3 worldSize = (transform.getMatrix() * Vector4(m_bounds.m_boxSize, 0)).xyz();
+		// The cache is only refreshed by the broadphase update, so concurrent readers never write
+		if (m_isWorldBoundsOutdated.load(std::memory_order_acquire))
+			return computeWorldBounds();
 
-		worldSize.m_x = LibMath::abs(worldSize.m_x);
-		worldSize.m_y = LibMath::abs(worldSize.m_y);
-		worldSize.m_z = LibMath::abs(worldSize.m_z);
+		return m_worldBounds;
+	}
 
-		const Vector3 scale = transform.getScale();
-		const float radiusScale = max(max(scale.m_x, scale.m_y), scale.m_z);
-		const float worldRadius = m_bounds.m_sphereRadius * radiusScale;
+	AABB ICollider::getBoundingBox() const
+	{
+		if (m_isWorldBoundsOutdated.load(std::memory_order_acquire))
+			return computeBoundingBox(computeWorldBounds());
 
-		return { worldCenter, worldSize, worldRadius };
+		return m_worldBox;
+	}
+
+	uint32_t ICollider::getProxy() const
+	{
+		return m_proxy;
+	}
+
+	uint8_t ICollider::getLayer() const
+	{
+		return m_layer;
+	}
+
+	void ICollider::setLayer(const uint8_t layer)
+	{
+		if (layer >= LAYER_COUNT)
+			throw std::out_of_range("Collider layer out of range");
+
+		m_layer = layer;
+	}
+
+	bool ICollider::isInLayers(const uint32_t layerMask) const
+	{
+		return (layerMask >> m_layer & 1u) != 0;
 	}
 
 	bool ICollider::check(const Vector3& point) const
@@ -105,15 +197,182 @@ namespace LibGL::Physics
 		return center.distanceSquaredFrom(otherCenter) <= totalRadius * totalRadius;
 	}
 
-	std::vector<ICollider*> ICollider::getColliders()
+	bool ICollider::overlapsBox(const AABB& box) const
+	{
+		const auto [center, _, radius] = getBounds();
+		return box.distanceSquaredFrom(center) <= radius * radius;
+	}
+
+	bool ICollider::overlapsSphere(const Vector3& center, const float radius) const
+	{
+		const auto [boundsCenter, _, boundsRadius] = getBounds();
+		const float totalRadius = radius + boundsRadius;
+
+		return center.distanceSquaredFrom(boundsCenter) <= totalRadius * totalRadius;
+	}
+
+	ICollider* ICollider::find(const ComponentHandle handle)
+	{
+		// Only colliders are given to the broadphase
+		return static_cast<ICollider*>(Component::find(handle));
+	}
+
+	const IBroadphase& ICollider::getBroadphase()
+	{
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		for (const ComponentHandle handle : s_outdatedColliders)
+		{
+			ICollider* collider = find(handle);
+
+			if (collider == nullptr)
+				continue;
+
+			// Published before the proxy is moved - readers seeing the bounds as up to date only read them from then on
+			collider->m_worldBounds = collider->computeWorldBounds();
+			collider->m_worldBox = computeBoundingBox(collider->m_worldBounds);
+			collider->m_isWorldBoundsOutdated.store(false, std::memory_order_release);
+
+			if (collider->m_proxy == IBroadphase::NULL_PROXY)
+			{
+				collider->m_proxy = s_broadphase->createProxy(collider->m_worldBox, handle);
+			}
+			else if (s_broadphase->moveProxy(collider->m_proxy, collider->m_worldBox))
+			{
+				// The bodies the collider leaves may lose their support
+				wakeUpOverlappingBodies(collider->m_proxy);
+				s_movedProxies.push_back(collider->m_proxy);
+			}
+
+			collider->m_isProxyOutdated = false;
+		}
+
+		s_outdatedColliders.clear();
+		s_broadphase->update();
+
+		// The bodies the colliders reach may be pushed
+		for (const uint32_t proxy : s_movedProxies)
+			wakeUpOverlappingBodies(proxy);
+
+		s_movedProxies.clear();
+
+		return *s_broadphase;
+	}
+
+	void ICollider::setBroadphase(const EBroadphaseType type)
 	{
-		return m_colliders;
+		if (type == s_broadphase->getType())
+			return;
+
+		switch (type)
+		{
+		case EBroadphaseType::DYNAMIC_AABB_TREE:
+			setBroadphase(std::make_unique<DynamicAABBTree>());
+			break;
+		case EBroadphaseType::SWEEP_AND_PRUNE:
+			setBroadphase(std::make_unique<SweepAndPrune>());
+			break;
+		case EBroadphaseType::SPATIAL_HASH_GRID:
+			setBroadphase(std::make_unique<SpatialHashGrid>());
+			break;
+		default:
+			throw std::invalid_argument("Unknown broadphase type");
+		}
+	}
+
+	void ICollider::setBroadphase(std::unique_ptr<IBroadphase> broadphase)
+	{
+		if (broadphase == nullptr)
+			throw std::invalid_argument("The broadphase can't be null");
+
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		// The colliders without a proxy yet are still queued, and get one in the new broadphase on the next access
+		s_broadphase->update();
+		s_broadphase->query(AABB(Vector3(-INFINITY), Vector3(INFINITY)), [&broadphase](const uint32_t proxy)
+		{
+			const ComponentHandle handle = s_broadphase->getCollider(proxy);
+
+			if (ICollider* collider = find(handle))
+				collider->m_proxy = broadphase->createProxy(collider->getBoundingBox(), handle);
+
+			return true;
+		});
+
+		broadphase->update();
+		s_broadphase = std::move(broadphase);
 	}
 
 	ICollider::ICollider(Entity& owner, const Bounds& bounds) :
 		Component(owner), m_bounds(bounds)
 	{
-		m_colliders.push_back(this);
+		// The proxy is created on the next broadphase access, once the collider is fully constructed
+		onOwnerTransformChange();
+	}
+
+	Bounds ICollider::computeWorldBounds() const
+	{
+		const Transform transform = getOwner().getGlobalTransform();
+		const Vector3 worldCenter = (transform.getMatrix() * Vector4(m_bounds.m_center, 1.f)).xyz();
+		Vector3 worldSize = (transform.getMatrix() * Vector4(m_bounds.m_boxSize, 0)).xyz();
+
+		worldSize.m_x = LibMath::abs(worldSize.m_x);
+		worldSize.m_y = LibMath::abs(worldSize.m_y);
+		worldSize.m_z = LibMath::abs(worldSize.m_z);
+
+		const Vector3 scale = transform.getScale();
+		const float radiusScale = max(max(scale.m_x, scale.m_y), scale.m_z);
+		const float worldRadius = m_bounds.m_sphereRadius * radiusScale;
+
+		return { worldCenter, worldSize, worldRadius };
+	}
+
+	AABB ICollider::computeBoundingBox(const Bounds& worldBounds)
+	{
+		return AABB::fromCenterExtents(worldBounds.m_center, worldBounds.m_boxSize / 2.f)
+			.merged(AABB::fromCenterExtents(worldBounds.m_center, Vector3(worldBounds.m_sphereRadius)));
+	}
+
+	void ICollider::wakeUpOverlappingBodies(const uint32_t proxy)
+	{
+		for (const uint32_t other : s_broadphase->getOverlaps(proxy))
+		{
+			const ICollider* collider = find(s_broadphase->getCollider(other));
+
+			if (collider == nullptr)
+				continue;
+
+			if (Rigidbody* body = collider->getOwner().getComponent<Rigidbody>())
+				body->wakeUp();
+		}
+	}
+
+	void ICollider::onOwnerTransformChange()
+	{
+		m_isWorldBoundsOutdated.store(true, std::memory_order_relaxed);
+
+		// Entities moved by parallel updates queue their colliders at the same time.
+		// The broadphase update resolves the owner's global transform, which re-arms this notification
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		// A body's simulation updates the broadphase, which wakes its neighbours once its fat box changes.
+		// Other colliders may move while nothing updates it
+		if (m_proxy != IBroadphase::NULL_PROXY && getOwner().getComponent<Rigidbody>() == nullptr)
+			wakeUpOverlappingBodies(m_proxy);
+
+		if (m_isProxyOutdated)
+			return;
+
+		m_isProxyOutdated = true;
+		s_outdatedColliders.push_back(getHandle());
+	}
+
+	void ICollider::onDisable()
+	{
+		std::scoped_lock lock(s_broadphaseMutex);
+
+		if (m_proxy != IBroadphase::NULL_PROXY)
+			wakeUpOverlappingBodies(m_proxy);
 	}
 
 	Vector3 getClosestPointOnSegment(const Vector3& point,
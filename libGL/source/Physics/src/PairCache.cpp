@@ -0,0 +1,82 @@
+#include "PairCache.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace LibGL::Physics
+{
+	bool PairCache::add(const uint32_t proxyA, const uint32_t proxyB)
+	{
+		if (!m_pairs.insert(getKey(proxyA, proxyB)).second)
+			return false;
+
+		const uint32_t highest = std::max(proxyA, proxyB);
+
+		if (m_overlaps.size() <= highest)
+			m_overlaps.resize(static_cast<size_t>(highest) + 1);
+
+		m_overlaps[proxyA].pushBack(proxyB);
+		m_overlaps[proxyB].pushBack(proxyA);
+
+		return true;
+	}
+
+	bool PairCache::remove(const uint32_t proxyA, const uint32_t proxyB)
+	{
+		if (m_pairs.erase(getKey(proxyA, proxyB)) == 0)
+			return false;
+
+		removeOverlap(proxyA, proxyB);
+		removeOverlap(proxyB, proxyA);
+
+		return true;
+	}
+
+	bool PairCache::contains(const uint32_t proxyA, const uint32_t proxyB) const
+	{
+		return m_pairs.contains(getKey(proxyA, proxyB));
+	}
+
+	std::span<const uint32_t> PairCache::getOverlaps(const uint32_t proxy) const
+	{
+		if (proxy >= m_overlaps.size())
+			return {};
+
+		return m_overlaps[proxy].getValues();
+	}
+
+	size_t PairCache::getPairCount() const
+	{
+		return m_pairs.size();
+	}
+
+	void PairCache::clear()
+	{
+		m_pairs.clear();
+		m_overlaps.clear();
+	}
+
+	uint64_t PairCache::getKey(uint32_t proxyA, uint32_t proxyB)
+	{
+		if (proxyA > proxyB)
+			std::swap(proxyA, proxyB);
+
+		return static_cast<uint64_t>(proxyA) << 32 | proxyB;
+	}
+
+	void PairCache::removeOverlap(const uint32_t proxy, const uint32_t other)
+	{
+		OverlapList& overlaps = m_overlaps[proxy];
+
+		for (size_t i = 0; i < overlaps.getSize(); i++)
+		{
+			if (overlaps[i] == other)
+			{
+				// The order doesn't matter - fills the hole with the last overlap
+				overlaps[i] = overlaps.back();
+				overlaps.popBack();
+				return;
+			}
+		}
+	}
+}
@@ -1,12 +1,62 @@
 #include "Raycast.h"
 
-#include "Arithmetic.h"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "FastMath.h"
+#include "IBroadphase.h"
 #include "ICollider.h"
 
 using namespace LibMath;
 
 namespace LibGL::Physics
 {
+	namespace
+	{
+		/**
+		 * \brief Checks whether the given ray hits the collider of the given proxy, if it can
+		 * \param broadphase The broadphase holding the proxy
+		 * \param proxy The proxy's id
+		 * \param ray The ray, with a normalized direction
+		 * \param layerMask The mask with the bit of each layer the ray can hit set
+		 * \param distanceSqr The squared distance from the ray's origin to the hit
+		 * \return The hit collider. nullptr if the ray missed it or can't hit it
+		 */
+		ICollider* checkProxy(const IBroadphase& broadphase, const uint32_t proxy, const Ray& ray,
+			const uint32_t layerMask, float& distanceSqr)
+		{
+			ICollider* collider = ICollider::find(broadphase.getCollider(proxy));
+
+			if (collider == nullptr || !collider->isActive() || !collider->isInLayers(layerMask) ||
+				!collider->check(ray, distanceSqr))
+			{
+				return nullptr;
+			}
+
+			return collider;
+		}
+
+		/**
+		 * \brief Turns the squared distance of the given closest hit into its distance and position
+		 * \param hitInfo The hit, whose distance is squared
+		 * \param ray The ray, with a normalized direction
+		 */
+		void completeHit(RaycastHit& hitInfo, const Ray& ray)
+		{
+			if (hitInfo.m_collider != nullptr)
+			{
+				hitInfo.m_distance = Fast::sqrt(hitInfo.m_distance);
+				hitInfo.m_position = ray.m_origin + ray.m_direction * hitInfo.m_distance;
+			}
+			else
+			{
+				hitInfo.m_distance = INFINITY;
+				hitInfo.m_position = Vector3(INFINITY);
+			}
+		}
+	}
+
 	bool raycast(const Vector3& origin, const Vector3& direction,
 		const float maxDistance)
 	{
@@ -17,37 +67,150 @@ namespace LibGL::Physics
 	bool raycast(const Vector3& origin, const Vector3& direction,
 		RaycastHit& hitInfo, const float maxDistance)
 	{
-		const Vector3 dir = direction.normalized();
-		const auto colliders = ICollider::getColliders();
-		const Ray ray{ origin, dir };
+		return raycast(origin, direction, hitInfo, maxDistance, ICollider::ALL_LAYERS);
+	}
+
+	bool raycast(const Vector3& origin, const Vector3& direction,
+		RaycastHit& hitInfo, const float maxDistance, const uint32_t layerMask)
+	{
+		const Ray ray{ origin, direction.normalized() };
 		const float maxDistanceSqr = maxDistance * maxDistance;
+		const IBroadphase& broadphase = ICollider::getBroadphase();
 
-		for (const auto& collider : colliders)
+		broadphase.raycast(ray.m_origin, ray.m_direction, maxDistance, [&](const uint32_t proxy)
 		{
-			if (collider == nullptr || !collider->isActive())
-				continue;
+			float distanceSqr;
+			ICollider* collider = checkProxy(broadphase, proxy, ray, layerMask, distanceSqr);
 
-			const auto closestOnCollider = collider->getClosestPoint(origin);
-			const float distanceSqr = origin.distanceSquaredFrom(closestOnCollider);
+			if (collider != nullptr && distanceSqr < hitInfo.m_distance && distanceSqr <= maxDistanceSqr)
+			{
+				hitInfo.m_collider = collider;
+				hitInfo.m_distance = distanceSqr;
+			}
 
-			if (distanceSqr > maxDistanceSqr || distanceSqr >= hitInfo.m_distance ||
-				!collider->check(ray, hitInfo.m_distance) || hitInfo.m_distance > maxDistanceSqr)
-				continue;
+			// The colliders whose bounding box starts past the closest hit can't be hit first
+			return hitInfo.m_collider != nullptr ? Fast::sqrt(hitInfo.m_distance) : maxDistance;
+		});
 
-			hitInfo.m_collider = collider;
-		}
+		completeHit(hitInfo, ray);
+		return hitInfo.m_collider != nullptr;
+	}
 
-		if (hitInfo.m_collider != nullptr)
+	std::vector<RaycastHit> raycastAll(const Vector3& origin, const Vector3& direction,
+		const float maxDistance, const uint32_t layerMask)
+	{
+		const Ray ray{ origin, direction.normalized() };
+		const float maxDistanceSqr = maxDistance * maxDistance;
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+		std::vector<RaycastHit> hits;
+
+		broadphase.raycast(ray.m_origin, ray.m_direction, maxDistance, [&](const uint32_t proxy)
 		{
-			hitInfo.m_distance = squareRoot(hitInfo.m_distance);
-			hitInfo.m_position = origin + dir * hitInfo.m_distance;
-		}
-		else
+			float distanceSqr;
+			ICollider* collider = checkProxy(broadphase, proxy, ray, layerMask, distanceSqr);
+
+			if (collider != nullptr && distanceSqr <= maxDistanceSqr)
+			{
+				const float distance = Fast::sqrt(distanceSqr);
+				hits.push_back({ ray.m_origin + ray.m_direction * distance, collider, distance });
+			}
+
+			return maxDistance;
+		});
+
+		std::sort(hits.begin(), hits.end(), [](const RaycastHit& hit, const RaycastHit& other)
 		{
-			hitInfo.m_distance = INFINITY;
-			hitInfo.m_position = Vector3(INFINITY);
-		}
+			return hit.m_distance < other.m_distance;
+		});
 
-		return hitInfo.m_collider != nullptr;
+		return hits;
+	}
+
+	size_t raycastAll(const Vector3& origin, const Vector3& direction, const std::span<RaycastHit> hits,
+		const float maxDistance, const uint32_t layerMask)
+	{
+		if (hits.empty())
+			return 0;
+
+		const Ray ray{ origin, direction.normalized() };
+		const float maxDistanceSqr = maxDistance * maxDistance;
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+		size_t hitCount = 0;
+
+		broadphase.raycast(ray.m_origin, ray.m_direction, maxDistance, [&](const uint32_t proxy)
+		{
+			float distanceSqr;
+			ICollider* collider = checkProxy(broadphase, proxy, ray, layerMask, distanceSqr);
+
+			if (collider == nullptr || distanceSqr > maxDistanceSqr)
+				return hitCount == hits.size() ? hits.back().m_distance : maxDistance;
+
+			const float distance = Fast::sqrt(distanceSqr);
+
+			// Keeps the hits sorted, dropping the farthest one once the array is full
+			if (hitCount < hits.size() || distance < hits.back().m_distance)
+			{
+				size_t index = std::min(hitCount, hits.size() - 1);
+
+				for (; index > 0 && hits[index - 1].m_distance > distance; index--)
+					hits[index] = hits[index - 1];
+
+				hits[index] = { ray.m_origin + ray.m_direction * distance, collider, distance };
+				hitCount = std::min(hitCount + 1, hits.size());
+			}
+
+			// Once the array is full, only the colliders closer than the farthest kept hit matter
+			return hitCount == hits.size() ? hits.back().m_distance : maxDistance;
+		});
+
+		return hitCount;
+	}
+
+	void raycastBatch(const std::span<const Ray> rays, const std::span<RaycastHit> hits,
+		const float maxDistance, const uint32_t layerMask)
+	{
+		if (hits.size() < rays.size())
+			throw std::invalid_argument("The hit array is smaller than the ray array");
+
+		const float maxDistanceSqr = maxDistance * maxDistance;
+		const IBroadphase& broadphase = ICollider::getBroadphase();
+
+		IBroadphase::RayPacket packet;
+		std::array<Ray, IBroadphase::PACKET_SIZE> packetRays;
+
+		for (size_t first = 0; first < rays.size(); first += IBroadphase::PACKET_SIZE)
+		{
+			packet.m_rayCount = std::min(IBroadphase::PACKET_SIZE, rays.size() - first);
+
+			for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+			{
+				packetRays[ray] = { rays[first + ray].m_origin, rays[first + ray].m_direction.normalized() };
+
+				packet.m_origins[ray] = packetRays[ray].m_origin;
+				packet.m_directions[ray] = packetRays[ray].m_direction;
+				packet.m_maxDistances[ray] = maxDistance;
+
+				hits[first + ray] = {};
+			}
+
+			broadphase.raycastPacket(packet, [&](const size_t ray, const uint32_t proxy)
+			{
+				RaycastHit& hitInfo = hits[first + ray];
+
+				float distanceSqr;
+				ICollider* collider = checkProxy(broadphase, proxy, packetRays[ray], layerMask, distanceSqr);
+
+				if (collider != nullptr && distanceSqr < hitInfo.m_distance && distanceSqr <= maxDistanceSqr)
+				{
+					hitInfo.m_collider = collider;
+					hitInfo.m_distance = distanceSqr;
+				}
+
+				return hitInfo.m_collider != nullptr ? Fast::sqrt(hitInfo.m_distance) : maxDistance;
+			});
+
+			for (size_t ray = 0; ray < packet.m_rayCount; ray++)
+				completeHit(hits[first + ray], packetRays[ray]);
+		}
 	}
 }
@@ -2,6 +2,7 @@
 #include "Rigidbody.h"
 #include "Component.h"
 #include "Entity.h"
+#include "IBroadphase.h"
 #include "ICollider.h"
 #include "Debug/Log.h"
 #include "Utility/ServiceLocator.h"
@@ -48,21 +49,24 @@ namespace LibGL::Physics
 			DEBUG_LOG(msg.c_str());
 			throw std::out_of_range(msg);
 		}
+
+		if (m_velocity.magnitudeSquared() >= m_sleepThreshold)
+			wakeUp();
 	}
 
 	void Rigidbody::sleep()
 	{
-		m_isSleeping = true;
+		setAwake(false);
 	}
 
 	void Rigidbody::wakeUp()
 	{
-		m_isSleeping = false;
+		setAwake(true);
 	}
 
 	bool Rigidbody::isSleeping() const
 	{
-		return m_isSleeping;
+		return !isAwake();
 	}
 
 	Vector3 Rigidbody::getDraggedVelocity() const
@@ -85,14 +89,6 @@ namespace LibGL::Physics
 		if (m_useGravity)
 			addForce(g_gravity, EForceMode::ACCELERATION);
 
-		if (isSleeping())
-		{
-			if (m_velocity.magnitudeSquared() >= m_sleepThreshold)
-				wakeUp();
-
-			return;
-		}
-
 		if (floatEquals(getDraggedVelocity().magnitudeSquared(), 0.f))
 			return;
 
@@ -144,6 +140,54 @@ namespace LibGL::Physics
 		return Vector3::zero();
 	}
 
+	void Rigidbody::resolveCollision(const ICollider& entityCollider, const ICollider& worldCollider, const Vector3& velocity)
+	{
+		const Vector3 normal = getBoundsNormal(entityCollider, worldCollider);
+
+		const Vector3 normalMask
+		{
+			LibMath::abs(normal.m_x) > 0.f ? sign(normal.m_x) : 0.f,
+			LibMath::abs(normal.m_y) > 0.f ? sign(normal.m_y) : 0.f,
+			LibMath::abs(normal.m_z) > 0.f ? sign(normal.m_z) : 0.f
+		};
+
+		const Vector3 frictionMask
+		{
+			floatEquals(normalMask.m_x, 0.f) ? sign(normalMask.m_x) : 0.f,
+			floatEquals(normalMask.m_y, 0.f) ? sign(normalMask.m_y) : 0.f,
+			floatEquals(normalMask.m_z, 0.f) ? sign(normalMask.m_z) : 0.f
+		};
+
+		Rigidbody* otherRigidbody = worldCollider.getOwner().getComponent<Rigidbody>();
+
+		// There is a collision, apply opposite forces
+		if (otherRigidbody != nullptr && otherRigidbody->isActive())
+		{
+			const Vector3 otherVelocity = otherRigidbody->getDraggedVelocity();
+
+			if (!otherRigidbody->m_isKinematic)
+			{
+				if (normal.dot(otherVelocity) >= 0.f)
+					otherRigidbody->addForce((otherVelocity * normalMask).magnitude() * -normal, EForceMode::VELOCITY_CHANGE);
+
+				if (normal.dot(-velocity) >= 0.f)
+					otherRigidbody->addForce((velocity * m_mass * normalMask).magnitude() * -normal, EForceMode::IMPULSE);
+			}
+
+			if (normal.dot(-velocity) >= 0.f)
+				addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
+
+			if (normal.dot(otherVelocity) >= 0.f)
+				addForce((otherVelocity * otherRigidbody->m_mass * normalMask).magnitude() * normal, EForceMode::IMPULSE);
+		}
+		else if (normal.dot(-velocity) >= 0.f)
+		{
+			addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
+		}
+
+		addForce(-velocity * frictionMask * g_friction * g_gravity.magnitude(), EForceMode::ACCELERATION);
+	}
+
 	void Rigidbody::move()
 	{
 		if (!isActive() || isSleeping())
@@ -162,8 +206,6 @@ namespace LibGL::Physics
 			return;
 		}
 
-		const auto worldColliders = ICollider::getColliders();
-
 		int stepsCount;
 
 		switch (m_collisionDetectionMode)
@@ -181,72 +223,34 @@ namespace LibGL::Physics
 		}
 
 		std::unordered_map<ComponentId, std::vector<ComponentId>> checkedCollidersMap;
+		bool hasCollided = false;
 
 		for (int i = 0; i < stepsCount; i++)
 		{
 			const Vector3 velocity = getDraggedVelocity();
+			const IBroadphase& broadphase = ICollider::getBroadphase();
 
 			for (const auto& entityCollider : ownerColliders)
 			{
-				if (!entityCollider->isActive())
+				if (!entityCollider->isActive() || entityCollider->getProxy() == IBroadphase::NULL_PROXY)
 					continue;
 
 				auto& checkedColliders = checkedCollidersMap[entityCollider->getId()];
 
-				for (const auto& worldCollider : worldColliders)
+				// Only the colliders whose bounding boxes overlap can collide, and the broadphase keeps them paired
+				for (const uint32_t proxy : broadphase.getOverlaps(entityCollider->getProxy()))
 				{
+					const ICollider* worldCollider = ICollider::find(broadphase.getCollider(proxy));
+
 					if (worldCollider == nullptr || !worldCollider->isActive() ||
 						std::ranges::find(checkedColliders, worldCollider->getId()) != checkedColliders.end())
 						continue;
 
-					if (*entityCollider != *worldCollider && entityCollider->check(*worldCollider))
+					if (entityCollider->check(*worldCollider))
 					{
-						const Vector3 normal = getBoundsNormal(*entityCollider, *worldCollider);
-
-						const Vector3 normalMask
-						{
-							LibMath::abs(normal.m_x) > 0.f ? sign(normal.m_x) : 0.f,
-							LibMath::abs(normal.m_y) > 0.f ? sign(normal.m_y) : 0.f,
-							LibMath::abs(normal.m_z) > 0.f ? sign(normal.m_z) : 0.f
-						};
-
-						const Vector3 frictionMask
-						{
-							floatEquals(normalMask.m_x, 0.f) ? sign(normalMask.m_x) : 0.f,
-							floatEquals(normalMask.m_y, 0.f) ? sign(normalMask.m_y) : 0.f,
-							floatEquals(normalMask.m_z, 0.f) ? sign(normalMask.m_z) : 0.f
-						};
-
-						Rigidbody* otherRigidbody = worldCollider->getOwner().getComponent<Rigidbody>();
-
-						// There is a collision, apply opposite forces
-						if (otherRigidbody != nullptr && otherRigidbody->isActive())
-						{
-							const Vector3 otherVelocity = otherRigidbody->getDraggedVelocity();
-
-							if (!otherRigidbody->m_isKinematic)
-							{
-								if (normal.dot(otherVelocity) >= 0.f)
-									otherRigidbody->addForce((otherVelocity * normalMask).magnitude() * -normal, EForceMode::VELOCITY_CHANGE);
-
-								if (normal.dot(-velocity) >= 0.f)
-									otherRigidbody->addForce((velocity * m_mass * normalMask).magnitude() * -normal, EForceMode::IMPULSE);
-							}
-
-							if (normal.dot(-velocity) >= 0.f)
-								addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
-
-							if (normal.dot(otherVelocity) >= 0.f)
-								addForce((otherVelocity * otherRigidbody->m_mass * normalMask).magnitude() * normal, EForceMode::IMPULSE);
-						}
-						else if (normal.dot(-velocity) >= 0.f)
-						{
-							addForce((velocity * normalMask).magnitude() * normal, EForceMode::VELOCITY_CHANGE);
-						}
-
-						addForce(-velocity * frictionMask * g_friction * g_gravity.magnitude(), EForceMode::ACCELERATION);
-
+						resolveCollision(*entityCollider, *worldCollider, velocity);
 						checkedColliders.push_back(worldCollider->getId());
+						hasCollided = true;
 					}
 				}
 			}
@@ -255,7 +259,13 @@ namespace LibGL::Physics
 			getOwner().translate(step);
 		}
 
-		if (getDraggedVelocity().magnitudeSquared() < m_sleepThreshold * m_sleepThreshold)
+		// Falling bodies only slow down at the top of their arc - gravity would wake them up right away
+		if ((hasCollided || !m_useGravity) && getDraggedVelocity().magnitudeSquared() < m_sleepThreshold * m_sleepThreshold)
 			sleep();
 	}
+
+	void Rigidbody::onOwnerTransformChange()
+	{
+		wakeUp();
+	}
 }
@@ -0,0 +1,467 @@
+#include "SpatialHashGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Debug/Assertion.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+	SpatialHashGrid::SpatialHashGrid(const float cellSize) :
+		m_cellSize(cellSize), m_inverseCellSize(1.f / cellSize)
+	{
+		if (!(cellSize > 0.f) || !std::isfinite(cellSize))
+			throw std::invalid_argument("The grid's cell size must be positive");
+	}
+
+	uint32_t SpatialHashGrid::createProxy(const AABB& box, const ComponentHandle collider)
+	{
+		uint32_t proxy = m_freeProxy;
+
+		if (proxy == NULL_PROXY)
+		{
+			if (m_proxies.size() >= NULL_PROXY)
+				throw std::length_error("Too many proxies in the broadphase");
+
+			proxy = static_cast<uint32_t>(m_proxies.size());
+			m_proxies.emplace_back();
+		}
+		else
+		{
+			m_freeProxy = m_proxies[proxy].m_nextFree;
+			m_proxies[proxy] = {};
+		}
+
+		m_proxies[proxy].m_box = fatten(box);
+		m_proxies[proxy].m_collider = collider;
+		m_proxies[proxy].m_cells = getCells(m_proxies[proxy].m_box);
+		m_proxyCount++;
+
+		insertProxy(proxy);
+		updateOverlaps(proxy);
+
+		return proxy;
+	}
+
+	void SpatialHashGrid::destroyProxy(const uint32_t proxy)
+	{
+		ASSERT(proxy < m_proxies.size() && !m_proxies[proxy].m_isFree);
+
+		endOverlaps(proxy);
+		removeProxy(proxy);
+
+		m_proxies[proxy] = {};
+		m_proxies[proxy].m_isFree = true;
+		m_proxies[proxy].m_nextFree = m_freeProxy;
+		m_freeProxy = proxy;
+		m_proxyCount--;
+	}
+
+	bool SpatialHashGrid::moveProxy(const uint32_t proxy, const AABB& box)
+	{
+		ASSERT(proxy < m_proxies.size() && !m_proxies[proxy].m_isFree);
+
+		Proxy& moved = m_proxies[proxy];
+
+		if (fits(moved.m_box, box))
+			return false;
+
+		const AABB fatBox = fatten(box);
+		const CellRange cells = getCells(fatBox);
+		const bool isLarge = cells.getCellCount() > MAX_PROXY_CELLS;
+
+		if (moved.m_isLarge || isLarge)
+		{
+			removeProxy(proxy);
+			moved.m_box = fatBox;
+			moved.m_cells = cells;
+			insertProxy(proxy);
+		}
+		else if (cells.m_min != moved.m_cells.m_min || cells.m_max != moved.m_cells.m_max)
+		{
+			const CellRange oldCells = moved.m_cells;
+			moved.m_cells = cells;
+
+			// Only the cells the proxy left or entered change
+			for (int32_t z = oldCells.m_min[2]; z <= oldCells.m_max[2]; z++)
+			{
+				for (int32_t y = oldCells.m_min[1]; y <= oldCells.m_max[1]; y++)
+				{
+					for (int32_t x = oldCells.m_min[0]; x <= oldCells.m_max[0]; x++)
+					{
+						if (cells.contains({ x, y, z }))
+							continue;
+
+						const auto it = m_cells.find(getKey({ x, y, z }));
+						std::vector<uint32_t>& cellProxies = it->second;
+
+						*std::ranges::find(cellProxies, proxy) = cellProxies.back();
+						cellProxies.pop_back();
+
+						if (cellProxies.empty())
+							m_cells.erase(it);
+					}
+				}
+			}
+
+			for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; z++)
+			{
+				for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; y++)
+				{
+					for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; x++)
+					{
+						if (!oldCells.contains({ x, y, z }))
+							m_cells[getKey({ x, y, z })].push_back(proxy);
+					}
+				}
+			}
+
+			for (size_t axis = 0; axis < 3; axis++)
+			{
+				m_bounds.m_min[axis] = std::min(m_bounds.m_min[axis], cells.m_min[axis]);
+				m_bounds.m_max[axis] = std::max(m_bounds.m_max[axis], cells.m_max[axis]);
+			}
+		}
+
+		moved.m_box = fatBox;
+		updateOverlaps(proxy);
+
+		return true;
+	}
+
+	EBroadphaseType SpatialHashGrid::getType() const
+	{
+		return EBroadphaseType::SPATIAL_HASH_GRID;
+	}
+
+	const AABB& SpatialHashGrid::getFatBox(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].m_box;
+	}
+
+	ComponentHandle SpatialHashGrid::getCollider(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].m_collider;
+	}
+
+	size_t SpatialHashGrid::getProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	float SpatialHashGrid::getCellSize() const
+	{
+		return m_cellSize;
+	}
+
+	size_t SpatialHashGrid::getCellCount() const
+	{
+		return m_cells.size();
+	}
+
+	bool SpatialHashGrid::CellRange::isEmpty() const
+	{
+		return m_min[0] > m_max[0] || m_min[1] > m_max[1] || m_min[2] > m_max[2];
+	}
+
+	bool SpatialHashGrid::CellRange::contains(const Cell& cell) const
+	{
+		return cell[0] >= m_min[0] && cell[0] <= m_max[0] && cell[1] >= m_min[1] && cell[1] <= m_max[1] &&
+			cell[2] >= m_min[2] && cell[2] <= m_max[2];
+	}
+
+	uint64_t SpatialHashGrid::CellRange::getCellCount() const
+	{
+		if (isEmpty())
+			return 0;
+
+		uint64_t count = 1;
+
+		for (size_t axis = 0; axis < 3; axis++)
+			count *= static_cast<uint64_t>(static_cast<int64_t>(m_max[axis]) - m_min[axis] + 1);
+
+		return count;
+	}
+
+	void SpatialHashGrid::queryProxies(const AABB& box, void* callback, const QueryFunction function) const
+	{
+		for (const uint32_t proxy : m_largeProxies)
+		{
+			if (m_proxies[proxy].m_box.intersects(box) && !function(callback, proxy))
+				return;
+		}
+
+		CellRange range = getCells(box);
+
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			range.m_min[axis] = std::max(range.m_min[axis], m_bounds.m_min[axis]);
+			range.m_max[axis] = std::min(range.m_max[axis], m_bounds.m_max[axis]);
+		}
+
+		// A proxy spanning several of the range's cells is only reported by the first of them
+		const auto visitCell = [this, &box, &range, callback, function](const Cell& cell,
+			const std::vector<uint32_t>& cellProxies)
+		{
+			for (const uint32_t proxy : cellProxies)
+			{
+				const Proxy& visited = m_proxies[proxy];
+
+				if (cell[0] != std::max(visited.m_cells.m_min[0], range.m_min[0]) ||
+					cell[1] != std::max(visited.m_cells.m_min[1], range.m_min[1]) ||
+					cell[2] != std::max(visited.m_cells.m_min[2], range.m_min[2]))
+					continue;
+
+				if (visited.m_box.intersects(box) && !function(callback, proxy))
+					return false;
+			}
+
+			return true;
+		};
+
+		// Large volumes read the occupied cells instead of looking every covered cell up
+		if (range.getCellCount() > m_cells.size())
+		{
+			for (const auto& [key, cellProxies] : m_cells)
+			{
+				const Cell cell = getCell(key);
+
+				if (range.contains(cell) && !visitCell(cell, cellProxies))
+					return;
+			}
+
+			return;
+		}
+
+		for (int32_t z = range.m_min[2]; z <= range.m_max[2]; z++)
+		{
+			for (int32_t y = range.m_min[1]; y <= range.m_max[1]; y++)
+			{
+				for (int32_t x = range.m_min[0]; x <= range.m_max[0]; x++)
+				{
+					const auto it = m_cells.find(getKey({ x, y, z }));
+
+					if (it != m_cells.end() && !visitCell({ x, y, z }, it->second))
+						return;
+				}
+			}
+		}
+	}
+
+	void SpatialHashGrid::raycastProxies(const Vector3& origin, const Vector3& direction, float maxDistance,
+		void* callback, const RaycastFunction function) const
+	{
+		const Vector3 inverseDirection = Vector3::one() / direction;
+
+		for (const uint32_t proxy : m_largeProxies)
+		{
+			float distanceIn, distanceOut;
+
+			if (!m_proxies[proxy].m_box.raycast(origin, inverseDirection, distanceIn, distanceOut) || distanceIn > maxDistance)
+				continue;
+
+			maxDistance = function(callback, proxy);
+
+			if (maxDistance < 0.f)
+				return;
+		}
+
+		if (m_bounds.isEmpty())
+			return;
+
+		// Walks the cells crossed by the ray in order, within the occupied part of the grid
+		const AABB gridBox
+		{
+			Vector3(static_cast<float>(m_bounds.m_min[0]), static_cast<float>(m_bounds.m_min[1]),
+				static_cast<float>(m_bounds.m_min[2])) * m_cellSize,
+			Vector3(static_cast<float>(m_bounds.m_max[0] + 1), static_cast<float>(m_bounds.m_max[1] + 1),
+				static_cast<float>(m_bounds.m_max[2] + 1)) * m_cellSize
+		};
+
+		float gridIn, gridOut;
+
+		if (!gridBox.raycast(origin, inverseDirection, gridIn, gridOut))
+			return;
+
+		gridIn = std::max(gridIn, 0.f);
+
+		if (gridIn > maxDistance)
+			return;
+
+		const Vector3 entry = origin + direction * gridIn;
+		Cell cell;
+		Cell step;
+		float nextCrossing[3];
+		float crossingDelta[3];
+
+		for (int axis = 0; axis < 3; axis++)
+		{
+			const float scaled = std::floor(entry[axis] * m_inverseCellSize);
+			cell[axis] = std::clamp(static_cast<int32_t>(std::clamp(scaled, -static_cast<float>(CELL_LIMIT),
+				static_cast<float>(CELL_LIMIT - 1))), m_bounds.m_min[axis], m_bounds.m_max[axis]);
+
+			if (direction[axis] == 0.f)
+			{
+				step[axis] = 0;
+				nextCrossing[axis] = INFINITY;
+				crossingDelta[axis] = INFINITY;
+				continue;
+			}
+
+			step[axis] = direction[axis] > 0.f ? 1 : -1;
+
+			const float boundary = static_cast<float>(cell[axis] + (step[axis] > 0 ? 1 : 0)) * m_cellSize;
+			nextCrossing[axis] = (boundary - origin[axis]) * inverseDirection[axis];
+			crossingDelta[axis] = m_cellSize * std::abs(inverseDirection[axis]);
+		}
+
+		Cell previous {};
+		bool hasPrevious = false;
+
+		while (m_bounds.contains(cell))
+		{
+			if (const auto it = m_cells.find(getKey(cell)); it != m_cells.end())
+			{
+				for (const uint32_t proxy : it->second)
+				{
+					const Proxy& tested = m_proxies[proxy];
+
+					// The ray leaves a proxy's cells for good once out of them, so the proxy was tested on entry
+					if (hasPrevious && tested.m_cells.contains(previous))
+						continue;
+
+					float distanceIn, distanceOut;
+
+					if (!tested.m_box.raycast(origin, inverseDirection, distanceIn, distanceOut) || distanceIn > maxDistance)
+						continue;
+
+					maxDistance = function(callback, proxy);
+
+					if (maxDistance < 0.f)
+						return;
+				}
+			}
+
+			const size_t axis = nextCrossing[0] < nextCrossing[1] ?
+				(nextCrossing[0] < nextCrossing[2] ? 0 : 2) :
+				(nextCrossing[1] < nextCrossing[2] ? 1 : 2);
+
+			if (nextCrossing[axis] > std::min(maxDistance, gridOut))
+				return;
+
+			previous = cell;
+			hasPrevious = true;
+
+			cell[axis] += step[axis];
+			nextCrossing[axis] += crossingDelta[axis];
+		}
+	}
+
+	SpatialHashGrid::CellRange SpatialHashGrid::getCells(const AABB& box) const
+	{
+		const auto toCell = [this](const float value)
+		{
+			const float scaled = std::floor(value * m_inverseCellSize);
+			return static_cast<int32_t>(std::clamp(scaled, -static_cast<float>(CELL_LIMIT), static_cast<float>(CELL_LIMIT - 1)));
+		};
+
+		return
+		{
+			{ toCell(box.m_min.m_x), toCell(box.m_min.m_y), toCell(box.m_min.m_z) },
+			{ toCell(box.m_max.m_x), toCell(box.m_max.m_y), toCell(box.m_max.m_z) }
+		};
+	}
+
+	void SpatialHashGrid::insertProxy(const uint32_t proxy)
+	{
+		Proxy& inserted = m_proxies[proxy];
+		inserted.m_isLarge = inserted.m_cells.getCellCount() > MAX_PROXY_CELLS;
+
+		if (inserted.m_isLarge)
+		{
+			m_largeProxies.push_back(proxy);
+			return;
+		}
+
+		const CellRange& cells = inserted.m_cells;
+
+		for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; z++)
+		{
+			for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; y++)
+			{
+				for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; x++)
+					m_cells[getKey({ x, y, z })].push_back(proxy);
+			}
+		}
+
+		if (m_bounds.isEmpty())
+		{
+			m_bounds = cells;
+			return;
+		}
+
+		for (size_t axis = 0; axis < 3; axis++)
+		{
+			m_bounds.m_min[axis] = std::min(m_bounds.m_min[axis], cells.m_min[axis]);
+			m_bounds.m_max[axis] = std::max(m_bounds.m_max[axis], cells.m_max[axis]);
+		}
+	}
+
+	void SpatialHashGrid::removeProxy(const uint32_t proxy)
+	{
+		const Proxy& removed = m_proxies[proxy];
+
+		if (removed.m_isLarge)
+		{
+			std::erase(m_largeProxies, proxy);
+			return;
+		}
+
+		const CellRange& cells = removed.m_cells;
+
+		for (int32_t z = cells.m_min[2]; z <= cells.m_max[2]; z++)
+		{
+			for (int32_t y = cells.m_min[1]; y <= cells.m_max[1]; y++)
+			{
+				for (int32_t x = cells.m_min[0]; x <= cells.m_max[0]; x++)
+				{
+					const auto it = m_cells.find(getKey({ x, y, z }));
+					std::vector<uint32_t>& cellProxies = it->second;
+
+					*std::ranges::find(cellProxies, proxy) = cellProxies.back();
+					cellProxies.pop_back();
+
+					if (cellProxies.empty())
+						m_cells.erase(it);
+				}
+			}
+		}
+	}
+
+	uint64_t SpatialHashGrid::getKey(const Cell& cell)
+	{
+		constexpr uint64_t mask = (uint64_t(1) << KEY_BITS) - 1;
+
+		const auto offset = [](const int32_t coordinate)
+		{
+			return static_cast<uint64_t>(static_cast<int64_t>(coordinate) + CELL_LIMIT) & mask;
+		};
+
+		return offset(cell[0]) << (2 * KEY_BITS) | offset(cell[1]) << KEY_BITS | offset(cell[2]);
+	}
+
+	SpatialHashGrid::Cell SpatialHashGrid::getCell(const uint64_t key)
+	{
+		constexpr uint64_t mask = (uint64_t(1) << KEY_BITS) - 1;
+
+		const auto coordinate = [](const uint64_t offset)
+		{
+			return static_cast<int32_t>(static_cast<int64_t>(offset) - CELL_LIMIT);
+		};
+
+		return { coordinate(key >> (2 * KEY_BITS) & mask), coordinate(key >> KEY_BITS & mask), coordinate(key & mask) };
+	}
+}
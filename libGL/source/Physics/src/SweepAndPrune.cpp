@@ -0,0 +1,366 @@
+#include "SweepAndPrune.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Debug/Assertion.h"
+
+using namespace LibMath;
+
+namespace LibGL::Physics
+{
+	uint32_t SweepAndPrune::createProxy(const AABB& box, const ComponentHandle collider)
+	{
+		uint32_t proxy = m_freeProxy;
+
+		if (proxy == NULL_PROXY)
+		{
+			// Endpoints keep the proxy's id on 31 bits
+			if (m_proxies.size() >= NULL_PROXY >> 1)
+				throw std::length_error("Too many proxies in the broadphase");
+
+			proxy = static_cast<uint32_t>(m_proxies.size());
+			m_proxies.emplace_back();
+		}
+		else
+		{
+			m_freeProxy = m_proxies[proxy].m_nextFree;
+			m_proxies[proxy] = {};
+		}
+
+		m_proxies[proxy].m_box = fatten(box);
+		m_proxies[proxy].m_collider = collider;
+		m_proxies[proxy].m_isPending = true;
+
+		m_pendingProxies.push_back(proxy);
+		m_proxyCount++;
+
+		return proxy;
+	}
+
+	void SweepAndPrune::destroyProxy(const uint32_t proxy)
+	{
+		ASSERT(proxy < m_proxies.size() && !m_proxies[proxy].m_isFree);
+
+		Proxy& destroyed = m_proxies[proxy];
+
+		if (destroyed.m_isPending)
+		{
+			std::erase(m_pendingProxies, proxy);
+		}
+		else
+		{
+			endOverlaps(proxy);
+
+			for (size_t axis = 0; axis < AXIS_COUNT; axis++)
+			{
+				std::vector<Endpoint>& endpoints = m_axes[axis];
+
+				endpoints.erase(endpoints.begin() + destroyed.m_maxIndices[axis]);
+				endpoints.erase(endpoints.begin() + destroyed.m_minIndices[axis]);
+
+				updateIndices(axis, destroyed.m_minIndices[axis]);
+			}
+		}
+
+		destroyed = {};
+		destroyed.m_isFree = true;
+		destroyed.m_nextFree = m_freeProxy;
+		m_freeProxy = proxy;
+		m_proxyCount--;
+	}
+
+	bool SweepAndPrune::moveProxy(const uint32_t proxy, const AABB& box)
+	{
+		ASSERT(proxy < m_proxies.size() && !m_proxies[proxy].m_isFree);
+
+		Proxy& moved = m_proxies[proxy];
+
+		if (fits(moved.m_box, box))
+			return false;
+
+		const AABB oldBox = moved.m_box;
+		moved.m_box = fatten(box);
+
+		if (moved.m_isPending)
+			return true;
+
+		m_maxWidth = std::max(m_maxWidth, moved.m_box.m_max.m_x - moved.m_box.m_min.m_x);
+
+		for (size_t axis = 0; axis < AXIS_COUNT; axis++)
+		{
+			const int i = static_cast<int>(axis);
+			const float newMin = moved.m_box.m_min[i];
+			const float newMax = moved.m_box.m_max[i];
+
+			m_axes[axis][moved.m_minIndices[axis]].m_value = newMin;
+			m_axes[axis][moved.m_maxIndices[axis]].m_value = newMax;
+
+			// Growing before shrinking keeps the proxy's own bounds from passing each other
+			if (newMax > oldBox.m_max[i])
+				sortUp(axis, moved.m_maxIndices[axis]);
+
+			if (newMin < oldBox.m_min[i])
+				sortDown(axis, moved.m_minIndices[axis]);
+
+			if (newMax < oldBox.m_max[i])
+				sortDown(axis, moved.m_maxIndices[axis]);
+
+			if (newMin > oldBox.m_min[i])
+				sortUp(axis, moved.m_minIndices[axis]);
+		}
+
+		return true;
+	}
+
+	void SweepAndPrune::update()
+	{
+		if (m_pendingProxies.empty())
+			return;
+
+		if (m_pendingProxies.size() >= REBUILD_THRESHOLD)
+		{
+			rebuild();
+		}
+		else
+		{
+			for (const uint32_t proxy : m_pendingProxies)
+				insertProxy(proxy);
+		}
+
+		m_pendingProxies.clear();
+	}
+
+	EBroadphaseType SweepAndPrune::getType() const
+	{
+		return EBroadphaseType::SWEEP_AND_PRUNE;
+	}
+
+	const AABB& SweepAndPrune::getFatBox(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].m_box;
+	}
+
+	ComponentHandle SweepAndPrune::getCollider(const uint32_t proxy) const
+	{
+		return m_proxies[proxy].m_collider;
+	}
+
+	size_t SweepAndPrune::getProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	void SweepAndPrune::queryProxies(const AABB& box, void* callback, const QueryFunction function) const
+	{
+		const std::vector<Endpoint>& endpoints = m_axes[0];
+
+		// The proxies overlapping the box along x start at most the widest box's width before it
+		const Endpoint first { box.m_min.m_x - m_maxWidth, 0 };
+		auto it = std::lower_bound(endpoints.begin(), endpoints.end(), first, isBefore);
+
+		for (; it != endpoints.end() && it->m_value <= box.m_max.m_x; ++it)
+		{
+			if (it->isMax())
+				continue;
+
+			const uint32_t proxy = it->getProxy();
+
+			if (m_proxies[proxy].m_box.intersects(box) && !function(callback, proxy))
+				return;
+		}
+	}
+
+	void SweepAndPrune::raycastProxies(const Vector3& origin, const Vector3& direction, float maxDistance,
+		void* callback, const RaycastFunction function) const
+	{
+		const Vector3 inverseDirection = Vector3::one() / direction;
+
+		for (uint32_t proxy = 0; proxy < m_proxies.size(); proxy++)
+		{
+			const Proxy& tested = m_proxies[proxy];
+
+			if (tested.m_isFree || tested.m_isPending)
+				continue;
+
+			float distanceIn, distanceOut;
+
+			if (!tested.m_box.raycast(origin, inverseDirection, distanceIn, distanceOut) || distanceIn > maxDistance)
+				continue;
+
+			maxDistance = function(callback, proxy);
+
+			if (maxDistance < 0.f)
+				return;
+		}
+	}
+
+	bool SweepAndPrune::isBefore(const Endpoint& endpoint, const Endpoint& other)
+	{
+		return endpoint.m_value < other.m_value || (endpoint.m_value == other.m_value && !endpoint.isMax() && other.isMax());
+	}
+
+	void SweepAndPrune::insertProxy(const uint32_t proxy)
+	{
+		Proxy& inserted = m_proxies[proxy];
+
+		for (size_t axis = 0; axis < AXIS_COUNT; axis++)
+		{
+			const int i = static_cast<int>(axis);
+			std::vector<Endpoint>& endpoints = m_axes[axis];
+
+			const Endpoint min { inserted.m_box.m_min[i], proxy << 1 };
+			const Endpoint max { inserted.m_box.m_max[i], proxy << 1 | 1 };
+
+			const auto minIt = std::upper_bound(endpoints.begin(), endpoints.end(), min, isBefore);
+			const size_t minIndex = static_cast<size_t>(minIt - endpoints.begin());
+			endpoints.insert(minIt, min);
+
+			const auto maxIt = std::upper_bound(endpoints.begin() + static_cast<ptrdiff_t>(minIndex) + 1, endpoints.end(),
+				max, isBefore);
+			endpoints.insert(maxIt, max);
+
+			updateIndices(axis, minIndex);
+		}
+
+		inserted.m_isPending = false;
+		m_maxWidth = std::max(m_maxWidth, inserted.m_box.m_max.m_x - inserted.m_box.m_min.m_x);
+
+		updateOverlaps(proxy);
+	}
+
+	void SweepAndPrune::rebuild()
+	{
+		m_maxWidth = 0.f;
+
+		for (std::vector<Endpoint>& endpoints : m_axes)
+		{
+			endpoints.clear();
+			endpoints.reserve(2 * m_proxyCount);
+		}
+
+		for (uint32_t proxy = 0; proxy < m_proxies.size(); proxy++)
+		{
+			const Proxy& sorted = m_proxies[proxy];
+
+			if (sorted.m_isFree)
+				continue;
+
+			for (size_t axis = 0; axis < AXIS_COUNT; axis++)
+			{
+				const int i = static_cast<int>(axis);
+				m_axes[axis].push_back({ sorted.m_box.m_min[i], proxy << 1 });
+				m_axes[axis].push_back({ sorted.m_box.m_max[i], proxy << 1 | 1 });
+			}
+
+			m_maxWidth = std::max(m_maxWidth, sorted.m_box.m_max.m_x - sorted.m_box.m_min.m_x);
+		}
+
+		for (size_t axis = 0; axis < AXIS_COUNT; axis++)
+		{
+			std::sort(m_axes[axis].begin(), m_axes[axis].end(), isBefore);
+			updateIndices(axis, 0);
+		}
+
+		// Sweeps the x axis, keeping the boxes it is inside of. The pairs between sorted proxies are already cached
+		std::vector<uint32_t> openProxies;
+
+		for (const Endpoint& endpoint : m_axes[0])
+		{
+			const uint32_t proxy = endpoint.getProxy();
+
+			if (endpoint.isMax())
+			{
+				const auto it = std::ranges::find(openProxies, proxy);
+				*it = openProxies.back();
+				openProxies.pop_back();
+				continue;
+			}
+
+			const Proxy& opened = m_proxies[proxy];
+
+			for (const uint32_t other : openProxies)
+			{
+				if ((opened.m_isPending || m_proxies[other].m_isPending) && opened.m_box.intersects(m_proxies[other].m_box))
+					beginOverlap(proxy, other);
+			}
+
+			openProxies.push_back(proxy);
+		}
+
+		for (const uint32_t proxy : m_pendingProxies)
+			m_proxies[proxy].m_isPending = false;
+	}
+
+	void SweepAndPrune::sortDown(const size_t axis, uint32_t index)
+	{
+		std::vector<Endpoint>& endpoints = m_axes[axis];
+		const Endpoint moving = endpoints[index];
+
+		while (index > 0 && isBefore(moving, endpoints[index - 1]))
+		{
+			const Endpoint passed = endpoints[index - 1];
+			onEndpointSwap(moving, passed, true);
+
+			endpoints[index] = passed;
+			Proxy& proxy = m_proxies[passed.getProxy()];
+			(passed.isMax() ? proxy.m_maxIndices : proxy.m_minIndices)[axis] = index;
+			index--;
+		}
+
+		endpoints[index] = moving;
+
+		Proxy& proxy = m_proxies[moving.getProxy()];
+		(moving.isMax() ? proxy.m_maxIndices : proxy.m_minIndices)[axis] = index;
+	}
+
+	void SweepAndPrune::sortUp(const size_t axis, uint32_t index)
+	{
+		std::vector<Endpoint>& endpoints = m_axes[axis];
+		const Endpoint moving = endpoints[index];
+
+		while (index + 1 < endpoints.size() && isBefore(endpoints[index + 1], moving))
+		{
+			const Endpoint passed = endpoints[index + 1];
+			onEndpointSwap(moving, passed, false);
+
+			endpoints[index] = passed;
+			Proxy& proxy = m_proxies[passed.getProxy()];
+			(passed.isMax() ? proxy.m_maxIndices : proxy.m_minIndices)[axis] = index;
+			index++;
+		}
+
+		endpoints[index] = moving;
+
+		Proxy& proxy = m_proxies[moving.getProxy()];
+		(moving.isMax() ? proxy.m_maxIndices : proxy.m_minIndices)[axis] = index;
+	}
+
+	void SweepAndPrune::onEndpointSwap(const Endpoint& moving, const Endpoint& passed, const bool isMovingDown)
+	{
+		if (moving.isMax() == passed.isMax())
+			return;
+
+		const uint32_t proxy = moving.getProxy();
+		const uint32_t other = passed.getProxy();
+
+		// A lower bound passing below an upper bound (or the opposite) makes the boxes overlap on this axis
+		const bool startsOverlapping = moving.isMax() != isMovingDown;
+
+		if (!startsOverlapping)
+			endOverlap(proxy, other);
+		else if (m_proxies[proxy].m_box.intersects(m_proxies[other].m_box))
+			beginOverlap(proxy, other);
+	}
+
+	void SweepAndPrune::updateIndices(const size_t axis, const size_t first)
+	{
+		const std::vector<Endpoint>& endpoints = m_axes[axis];
+
+		for (size_t index = first; index < endpoints.size(); index++)
+		{
+			Proxy& proxy = m_proxies[endpoints[index].getProxy()];
+			(endpoints[index].isMax() ? proxy.m_maxIndices : proxy.m_minIndices)[axis] = static_cast<uint32_t>(index);
+		}
+	}
+}
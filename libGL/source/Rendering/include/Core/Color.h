@@ -33,8 +33,8 @@ namespace LibGL::Rendering
 
 		Color() = default;
 
-		Color(float r, float g, float b);
-		Color(float r, float g, float b, float a);
+		constexpr Color(float r, float g, float b);
+		constexpr Color(float r, float g, float b, float a);
 
 		Color(const Color& other) = default;
 		Color(Color&& other) = default;
@@ -75,6 +75,16 @@ namespace LibGL::Rendering
 		LibMath::Vector4 rgba() const;
 	};
 
+	constexpr Color::Color(const float r, const float g, const float b) :
+		Color(r, g, b, 1)
+	{
+	}
+
+	constexpr Color::Color(const float r, const float g, const float b, const float a) :
+		m_r(r), m_g(g), m_b(b), m_a(a)
+	{
+	}
+
 	inline const Color Color::red		= { 1.f, 0.f, 0.f, 1.f };
 	inline const Color Color::green		= { 0.f, 1.f, 0.f, 1.f };
 	inline const Color Color::blue		= { 0.f, 0.f, 1.f, 1.f };
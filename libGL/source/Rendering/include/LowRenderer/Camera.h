@@ -1,6 +1,7 @@
 #pragma once
 #include "Scene.h"
 #include "Core/Color.h"
+#include "Geometry/Frustum.h"
 #include "Matrix/Matrix4.h"
 #include "Transform.h"
 
@@ -65,6 +66,12 @@ namespace LibGL::Rendering
 		 */
 		LibMath::Matrix4 getViewProjectionMatrix() const;
 
+		/**
+		 * \brief Gets the camera's view frustum, in world space
+		 * \return The camera's view frustum
+		 */
+		const LibMath::Frustum& getFrustum() const;
+
 		/**
 		 * \brief Makes the camera use the given projection matrix
 		 * \param projectionMatrix The camera's new projection matrix
@@ -149,22 +156,24 @@ namespace LibGL::Rendering
 	private:
 		static Camera*		m_current;
 
-		LibMath::Matrix4	m_viewMatrix;
-		LibMath::Matrix4	m_projectionMatrix;
-		LibMath::Matrix4	m_viewProjectionMatrix;
-		Color				m_clearColor = Color::black;
-		bool				m_clearColorBuffer = true;
-		bool				m_clearDepthBuffer = true;
-		bool				m_clearStencilBuffer = true;
+		mutable LibMath::Matrix4	m_viewMatrix;
+		LibMath::Matrix4			m_projectionMatrix;
+		mutable LibMath::Matrix4	m_viewProjectionMatrix;
+		mutable LibMath::Frustum	m_frustum;
+		mutable bool				m_areMatricesDirty = true;
+		Color						m_clearColor = Color::black;
+		bool						m_clearColorBuffer = true;
+		bool						m_clearDepthBuffer = true;
+		bool						m_clearStencilBuffer = true;
 
 		/**
-		 * \brief Updates the camera's matrices and other cached information
+		 * \brief Marks the camera's matrices and other cached information as outdated
 		 */
-		void onChange() override;
+		void onGlobalTransformChange() override;
 
 		/**
-		 * \brief Updates the camera's matrices
+		 * \brief Updates the camera's matrices if they are outdated
 		 */
-		void updateMatrices();
+		void updateMatrices() const;
 	};
 }
@@ -26,10 +26,10 @@ namespace LibGL::Rendering
 		Color	m_color	= Color::white;
 
 		Light() = default;
-		Light(const Color& color);
+		constexpr Light(const Color& color);
 		Light(const Light&) = default;
 		Light(Light&&) = default;
-		virtual ~Light() = default;
+		constexpr virtual ~Light() = default;
 
 		Light& operator=(const Light&) = default;
 		Light& operator=(Light&&) = default;
@@ -48,7 +48,7 @@ namespace LibGL::Rendering
 		 and the light type in the fourth column's fourth row
 		 * \return A matrix containing the light's data
 		 */
-		virtual LibMath::Matrix4 getMatrix() const;
+		constexpr virtual LibMath::Matrix4 getMatrix() const;
 	};
 
 	struct DirectionalLight final : Light
@@ -56,10 +56,11 @@ namespace LibGL::Rendering
 		LibMath::Vector3	m_direction;
 
 		DirectionalLight() = default;
-		DirectionalLight(const Light& light, const LibMath::Vector3& direction);
+		constexpr DirectionalLight(const Light& light, const LibMath::Vector3& direction);
 		DirectionalLight(const DirectionalLight&) = default;
 		DirectionalLight(DirectionalLight&&) = default;
-		~DirectionalLight() override = default;
+		// Not defaulted : gcc fails to define defaulted virtual destructors during constant evaluation
+		constexpr ~DirectionalLight() override {}
 
 		DirectionalLight& operator=(const DirectionalLight&) = default;
 		DirectionalLight& operator=(DirectionalLight&&) = default;
@@ -79,7 +80,7 @@ namespace LibGL::Rendering
 		 and the light type in the fourth column's fourth row
 		 * \return A matrix containing the light's data
 		 */
-		LibMath::Matrix4 getMatrix() const override;
+		constexpr LibMath::Matrix4 getMatrix() const override;
 	};
 
 	struct AttenuationData
@@ -89,8 +90,8 @@ namespace LibGL::Rendering
 		float	m_quadratic = 0;
 
 		AttenuationData() = default;
-		explicit AttenuationData(float range);
-		AttenuationData(float constant, float linear, float quadratic);
+		constexpr explicit AttenuationData(float range);
+		constexpr AttenuationData(float constant, float linear, float quadratic);
 	};
 
 	struct PointLight final : Light
@@ -99,12 +100,12 @@ namespace LibGL::Rendering
 		AttenuationData		m_attenuationData;
 
 		PointLight() = default;
-		PointLight(const Light& light, const LibMath::Vector3& position,
+		constexpr PointLight(const Light& light, const LibMath::Vector3& position,
 			const AttenuationData& attenuationData);
 
 		PointLight(const PointLight&) = default;
 		PointLight(PointLight&&) = default;
-		~PointLight() override = default;
+		constexpr ~PointLight() override {}
 
 		PointLight& operator=(const PointLight&) = default;
 		PointLight& operator=(PointLight&&) = default;
@@ -125,7 +126,7 @@ namespace LibGL::Rendering
 		 and the light type in the fourth column's fourth row
 		 * \return A matrix containing the light's data
 		 */
-		LibMath::Matrix4 getMatrix() const override;
+		constexpr LibMath::Matrix4 getMatrix() const override;
 	};
 
 	struct Cutoff
@@ -143,13 +144,13 @@ namespace LibGL::Rendering
 		Cutoff				m_cutoff { 0, 0 };
 
 		SpotLight() = default;
-		SpotLight(const Light& light, const LibMath::Vector3& position,
+		constexpr SpotLight(const Light& light, const LibMath::Vector3& position,
 			const LibMath::Vector3& direction, const AttenuationData& attenuationData,
 			const Cutoff& cutoff);
 
 		SpotLight(const SpotLight&) = default;
 		SpotLight(SpotLight&&) = default;
-		~SpotLight() override = default;
+		constexpr ~SpotLight() override {}
 
 		SpotLight& operator=(const SpotLight&) = default;
 		SpotLight& operator=(SpotLight&&) = default;
@@ -172,6 +173,8 @@ namespace LibGL::Rendering
 		 and the light type in the fourth column's fourth row
 		 * \return A matrix containing the light's data
 		 */
-		LibMath::Matrix4 getMatrix() const override;
+		constexpr LibMath::Matrix4 getMatrix() const override;
 	};
 }
+
+#include "LowRenderer/Light.inl"
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "LowRenderer/Light.h"
+
+namespace LibGL::Rendering
+{
+	constexpr Light::Light(const Color& color) :
+		m_color(color)
+	{
+	}
+
+	constexpr LibMath::Matrix4 Light::getMatrix() const
+	{
+		LibMath::Matrix4 lightMat;
+
+		lightMat[lightMat.getIndex(0, 0)] = m_color.m_r;
+		lightMat[lightMat.getIndex(1, 0)] = m_color.m_g;
+		lightMat[lightMat.getIndex(2, 0)] = m_color.m_b;
+		lightMat[lightMat.getIndex(3, 0)] = m_color.m_a;
+
+		lightMat[lightMat.getIndex(3, 3)] = static_cast<float>(ELightType::AMBIENT);
+
+		return lightMat;
+	}
+
+	constexpr DirectionalLight::DirectionalLight(const Light& light, const LibMath::Vector3& direction)
+		: Light(light), m_direction(direction)
+	{
+	}
+
+	constexpr LibMath::Matrix4 DirectionalLight::getMatrix() const
+	{
+		LibMath::Matrix4 lightMat(Light::getMatrix());
+
+		lightMat[lightMat.getIndex(0, 1)] = m_direction.m_x;
+		lightMat[lightMat.getIndex(0, 2)] = m_direction.m_y;
+		lightMat[lightMat.getIndex(0, 3)] = m_direction.m_z;
+
+		lightMat[lightMat.getIndex(3, 3)] = static_cast<float>(ELightType::DIRECTIONAL);
+
+		return lightMat;
+	}
+
+	constexpr AttenuationData::AttenuationData(const float range) :
+		AttenuationData(1.f, 4.5f / range, 75.f / (range * range))
+	{
+	}
+
+	constexpr AttenuationData::AttenuationData(const float constant, const float linear, const float quadratic) :
+		m_constant(constant), m_linear(linear), m_quadratic(quadratic)
+	{
+	}
+
+	constexpr PointLight::PointLight(const Light& light, const LibMath::Vector3& position,
+		const AttenuationData& attenuationData)
+		: Light(light), m_position(position), m_attenuationData(attenuationData)
+	{
+	}
+
+	constexpr LibMath::Matrix4 PointLight::getMatrix() const
+	{
+		LibMath::Matrix4 lightMat(Light::getMatrix());
+
+		lightMat[lightMat.getIndex(1, 1)] = m_position.m_x;
+		lightMat[lightMat.getIndex(1, 2)] = m_position.m_y;
+		lightMat[lightMat.getIndex(1, 3)] = m_position.m_z;
+
+		lightMat[lightMat.getIndex(2, 1)] = m_attenuationData.m_constant;
+		lightMat[lightMat.getIndex(2, 2)] = m_attenuationData.m_linear;
+		lightMat[lightMat.getIndex(2, 3)] = m_attenuationData.m_quadratic;
+
+		lightMat[lightMat.getIndex(3, 3)] = static_cast<float>(ELightType::POINT);
+
+		return lightMat;
+	}
+
+	constexpr SpotLight::SpotLight(const Light& light, const LibMath::Vector3& position,
+		const LibMath::Vector3& direction, const AttenuationData& attenuationData,
+		const Cutoff& cutoff)
+		: Light(light), m_position(position),m_direction(direction),
+		m_attenuationData(attenuationData), m_cutoff(cutoff)
+	{
+	}
+
+	constexpr LibMath::Matrix4 SpotLight::getMatrix() const
+	{
+		LibMath::Matrix4 lightMat(Light::getMatrix());
+
+		lightMat[lightMat.getIndex(0, 1)] = m_direction.m_x;
+		lightMat[lightMat.getIndex(0, 2)] = m_direction.m_y;
+		lightMat[lightMat.getIndex(0, 3)] = m_direction.m_z;
+
+		lightMat[lightMat.getIndex(1, 1)] = m_position.m_x;
+		lightMat[lightMat.getIndex(1, 2)] = m_position.m_y;
+		lightMat[lightMat.getIndex(1, 3)] = m_position.m_z;
+
+		lightMat[lightMat.getIndex(2, 1)] = m_attenuationData.m_constant;
+		lightMat[lightMat.getIndex(2, 2)] = m_attenuationData.m_linear;
+		lightMat[lightMat.getIndex(2, 3)] = m_attenuationData.m_quadratic;
+
+		lightMat[lightMat.getIndex(3, 1)] = m_cutoff.m_inner;
+		lightMat[lightMat.getIndex(3, 2)] = m_cutoff.m_outer;
+
+		lightMat[lightMat.getIndex(3, 3)] = static_cast<float>(ELightType::SPOT);
+
+		return lightMat;
+	}
+}
@@ -52,9 +52,9 @@ namespace LibGL::Rendering
 		void draw() const;
 
 		/**
-		 * \brief Updates the mesh
+		 * \brief Draws the mesh, then renders its children
 		 */
-		void update() override;
+		void render() override;
 
 	private:
 		const Resources::Model*	m_model = nullptr;
@@ -5,16 +5,6 @@
 
 namespace LibGL::Rendering
 {
-	Color::Color(const float r, const float g, const float b) :
-		Color(r, g, b, 1)
-	{
-	}
-
-	Color::Color(const float r, const float g, const float b, const float a) :
-		m_r(r), m_g(g), m_b(b), m_a(a)
-	{
-	}
-
 	Color::Color(const LibMath::Vector3& rgb) :
 		Color(rgb.m_x, rgb.m_y, rgb.m_z)
 	{
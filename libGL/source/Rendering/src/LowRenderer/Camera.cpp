@@ -11,26 +11,22 @@ namespace LibGL::Rendering
 		: Entity(),
 		m_projectionMatrix(Matrix4::orthographicProjection(-1, 1, -1, 1, -1, 1))
 	{
-		updateMatrices();
 	}
 
 	Camera::Camera(Node* parent, const Transform& transform, Matrix4 projectionMatrix)
 		: Entity(parent, transform), m_projectionMatrix(std::move(projectionMatrix))
 	{
-		updateMatrices();
 	}
 
 	Camera::Camera(const Camera& other)
 		: Entity(other), m_projectionMatrix(other.m_projectionMatrix)
 	{
-		updateMatrices();
 	}
 
 	Camera::Camera(Camera&& other) noexcept
 		: Entity(std::move(other)),
 		m_projectionMatrix(std::move(other.m_projectionMatrix))
 	{
-		updateMatrices();
 	}
 
 	Camera::~Camera()
@@ -48,7 +44,7 @@ namespace LibGL::Rendering
 
 		m_projectionMatrix = other.m_projectionMatrix;
 
-		updateMatrices();
+		m_areMatricesDirty = true;
 
 		return *this;
 	}
@@ -62,26 +58,34 @@ namespace LibGL::Rendering
 
 		m_projectionMatrix = std::move(other.m_projectionMatrix);
 
-		updateMatrices();
+		m_areMatricesDirty = true;
 
 		return *this;
 	}
 
 	Matrix4 Camera::getViewMatrix() const
 	{
+		updateMatrices();
 		return m_viewMatrix;
 	}
 
 	Matrix4 Camera::getViewProjectionMatrix() const
 	{
+		updateMatrices();
 		return m_viewProjectionMatrix;
 	}
 
+	const Frustum& Camera::getFrustum() const
+	{
+		updateMatrices();
+		return m_frustum;
+	}
+
 	Camera& Camera::setProjectionMatrix(const Matrix4& projectionMatrix)
 	{
 		m_projectionMatrix = projectionMatrix;
 
-		updateMatrices();
+		m_areMatricesDirty = true;
 
 		return *this;
 	}
@@ -148,16 +152,20 @@ namespace LibGL::Rendering
 		m_current = &cam;
 	}
 
-	void Camera::onChange()
+	void Camera::onGlobalTransformChange()
 	{
-		Entity::onChange();
-		updateMatrices();
+		m_areMatricesDirty = true;
 	}
 
-	void Camera::updateMatrices()
+	void Camera::updateMatrices() const
 	{
+		if (!m_areMatricesDirty)
+			return;
+
 		const auto camCenter = getGlobalTransform().getPosition() + getGlobalTransform().forward();
 		m_viewMatrix = Matrix4::lookAt(getGlobalTransform().getPosition(), camCenter, getGlobalTransform().up());
 		m_viewProjectionMatrix = m_projectionMatrix * m_viewMatrix;
+		m_frustum = Frustum(m_viewProjectionMatrix);
+		m_areMatricesDirty = false;
 	}
 }
\ No newline at end of file
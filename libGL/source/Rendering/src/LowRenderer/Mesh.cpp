@@ -45,7 +45,7 @@ namespace LibGL::Rendering
 
 		shader.setUniformMat4("u_mvp", viewProjMat * modelMat);
 		shader.setUniformMat4("u_modelMat", modelMat);
-		shader.setUniformMat4("u_normalMat", modelMat.inverse().transposed());
+		shader.setUniformMat4("u_normalMat", modelMat.normalMatrix());
 
 		m_model->draw();
 
@@ -53,10 +53,10 @@ namespace LibGL::Rendering
 		Texture::unbind();
 	}
 
-	void Mesh::update()
+	void Mesh::render()
 	{
 		draw();
 
-		Entity::update();
+		Entity::render();
 	}
 }
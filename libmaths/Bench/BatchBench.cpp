@@ -0,0 +1,219 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Angle.h"
+#include "Arithmetic.h"
+#include "Batch.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Matrix4Vector4Operation.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+// Compares the batched transform kernels with their per element equivalent
+namespace
+{
+	Matrix4 testMatrix()
+	{
+		return Matrix4::translation(1.f, 2.f, 3.f)
+			* Matrix4::rotation(Degree(30.f), Degree(45.f), Degree(60.f))
+			* Matrix4::scaling(2.f, 3.f, 4.f);
+	}
+
+	std::vector<Vector3> absoluteVectors(const size_t count)
+	{
+		std::vector<Vector3> vectors = randomVectors(count, -100.f, 100.f);
+
+		for (Vector3& vector : vectors)
+			vector = { LibMath::abs(vector.m_x), LibMath::abs(vector.m_y), LibMath::abs(vector.m_z) };
+
+		return vectors;
+	}
+
+	void transformPointsScalar(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> input = randomVectors(size, -100.f, 100.f);
+		std::vector<Vector3> output(size);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < size; i++)
+				output[i] = (matrix * Vector4(input[i], 1.f)).xyz();
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void transformPointsBatched(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> input = randomVectors(size, -100.f, 100.f);
+		std::vector<Vector3> output(size);
+
+		for (auto _ : state)
+		{
+			transformPoints(matrix, input, output);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void transformDirectionsScalar(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> input = randomVectors(size, -100.f, 100.f);
+		std::vector<Vector3> output(size);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < size; i++)
+				output[i] = (matrix * Vector4(input[i], 0.f)).xyz();
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void transformDirectionsBatched(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> input = randomVectors(size, -100.f, 100.f);
+		std::vector<Vector3> output(size);
+
+		for (auto _ : state)
+		{
+			transformDirections(matrix, input, output);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void transformAABBsScalar(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> centers = randomVectors(size, -100.f, 100.f);
+		const std::vector<Vector3> extents = absoluteVectors(size);
+		std::vector<Vector3> outCenters(size);
+		std::vector<Vector3> outExtents(size);
+
+		for (auto _ : state)
+		{
+			Matrix4 absMatrix = matrix;
+
+			for (Matrix4::length_t i = 0; i < 16; i++)
+				absMatrix[i] = LibMath::abs(absMatrix[i]);
+
+			for (size_t i = 0; i < size; i++)
+			{
+				outCenters[i] = (matrix * Vector4(centers[i], 1.f)).xyz();
+				outExtents[i] = (absMatrix * Vector4(extents[i], 0.f)).xyz();
+			}
+
+			benchmark::DoNotOptimize(outCenters.data());
+			benchmark::DoNotOptimize(outExtents.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void transformAABBsBatched(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const Matrix4 matrix = testMatrix();
+		const std::vector<Vector3> centers = randomVectors(size, -100.f, 100.f);
+		const std::vector<Vector3> extents = absoluteVectors(size);
+		std::vector<Vector3> outCenters(size);
+		std::vector<Vector3> outExtents(size);
+
+		for (auto _ : state)
+		{
+			transformAABBs(matrix, centers, extents, outCenters, outExtents);
+
+			benchmark::DoNotOptimize(outCenters.data());
+			benchmark::DoNotOptimize(outExtents.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	std::vector<Matrix4> localMatrices(const size_t count)
+	{
+		const std::vector<Vector3> translations = randomVectors(count, -100.f, 100.f);
+		const std::vector<Vector3> scales = absoluteVectors(count);
+		std::vector<Matrix4> matrices(count);
+
+		for (size_t i = 0; i < count; i++)
+			matrices[i] = Matrix4::translation(translations[i]) * Matrix4::scaling(scales[i]);
+
+		return matrices;
+	}
+
+	void concatenateScalar(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<Matrix4> parents(size, testMatrix());
+		const std::vector<Matrix4> locals = localMatrices(size);
+		std::vector<Matrix4> matrices(size);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < size; i++)
+				matrices[i] = parents[i] * locals[i];
+
+			benchmark::DoNotOptimize(matrices.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void concatenateBatched(benchmark::State& state)
+	{
+		const size_t size = static_cast<size_t>(state.range(0));
+		const std::vector<Matrix4> parents(size, testMatrix());
+		const std::vector<Matrix4> locals = localMatrices(size);
+		std::vector<Matrix4> matrices(size);
+
+		for (auto _ : state)
+		{
+			concatenate(parents, locals, matrices);
+
+			benchmark::DoNotOptimize(matrices.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+}
+
+BENCHMARK(transformPointsScalar)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(transformPointsBatched)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(transformDirectionsScalar)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(transformDirectionsBatched)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(transformAABBsScalar)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(transformAABBsBatched)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(concatenateScalar)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(concatenateBatched)->RangeMultiplier(10)->Range(1000, 100000);
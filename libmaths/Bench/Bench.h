@@ -0,0 +1,57 @@
+#ifndef __LIBMATH__BENCH__BENCH_H__
+#define __LIBMATH__BENCH__BENCH_H__
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "Vector/Vector3.h"
+
+namespace Bench
+{
+	// Every benchmark draws its inputs from the same seed so runs stay comparable with a stored baseline
+	constexpr unsigned g_seed = 42;
+
+	// Number of elements processed by the benchmarks of single operations - small enough to stay in the L1 cache
+	constexpr size_t g_elementCount = 1024;
+
+	/**
+	 * \brief Generates the given number of uniformly distributed random values
+	 * \param count The number of values to generate
+	 * \param min The lowest value which can be generated
+	 * \param max The highest value which can be generated
+	 * \return The generated values
+	 */
+	inline std::vector<float> randomFloats(const size_t count, const float min, const float max)
+	{
+		std::mt19937 generator(g_seed);
+		std::uniform_real_distribution<float> distribution(min, max);
+
+		std::vector<float> values(count);
+
+		for (float& value : values)
+			value = distribution(generator);
+
+		return values;
+	}
+
+	/**
+	 * \brief Generates the given number of vectors whose components are uniformly distributed random values
+	 * \param count The number of vectors to generate
+	 * \param min The lowest component value which can be generated
+	 * \param max The highest component value which can be generated
+	 * \return The generated vectors
+	 */
+	inline std::vector<LibMath::Vector3> randomVectors(const size_t count, const float min, const float max)
+	{
+		const std::vector<float> values = randomFloats(count * 3, min, max);
+		std::vector<LibMath::Vector3> vectors(count);
+
+		for (size_t i = 0; i < count; i++)
+			vectors[i] = { values[i * 3], values[i * 3 + 1], values[i * 3 + 2] };
+
+		return vectors;
+	}
+}
+
+#endif // !__LIBMATH__BENCH__BENCH_H__
@@ -0,0 +1,116 @@
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "FastMath.h"
+#include "Trigonometry.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+namespace
+{
+	// Compares the cost of the exact, fast and batched tiers on the same inputs
+	template <typename Func>
+	void benchmarkTier(benchmark::State& state, Func func)
+	{
+		const std::vector<float> input = randomFloats(g_elementCount, .001f, 100.f);
+		std::vector<float> output(g_elementCount);
+
+		for (auto _ : state)
+		{
+			func(input, output);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	template <typename Func>
+	void benchmarkElementWise(benchmark::State& state, Func func)
+	{
+		benchmarkTier(state, [func](const std::vector<float>& input, std::vector<float>& output)
+		{
+			for (size_t i = 0; i < input.size(); i++)
+				output[i] = func(input[i]);
+		});
+	}
+
+	void sinExact(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return LibMath::sin(Radian(x)); });
+	}
+
+	void sinFast(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return Fast::sin(Radian(x)); });
+	}
+
+	void sinBatched(benchmark::State& state)
+	{
+		benchmarkTier(state, [](const std::vector<float>& input, std::vector<float>& output) { Fast::sin(input, output); });
+	}
+
+	void cosExact(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return LibMath::cos(Radian(x)); });
+	}
+
+	void cosFast(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return Fast::cos(Radian(x)); });
+	}
+
+	void cosBatched(benchmark::State& state)
+	{
+		benchmarkTier(state, [](const std::vector<float>& input, std::vector<float>& output) { Fast::cos(input, output); });
+	}
+
+	void sqrtExact(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return std::sqrt(x); });
+	}
+
+	void sqrtFast(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return Fast::sqrt(x); });
+	}
+
+	void sqrtBatched(benchmark::State& state)
+	{
+		benchmarkTier(state, [](const std::vector<float>& input, std::vector<float>& output) { Fast::sqrt(input, output); });
+	}
+
+	void rsqrtExact(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return 1.f / std::sqrt(x); });
+	}
+
+	void rsqrtFast(benchmark::State& state)
+	{
+		benchmarkElementWise(state, [](const float x) { return Fast::rsqrt(x); });
+	}
+
+	void rsqrtBatched(benchmark::State& state)
+	{
+		benchmarkTier(state, [](const std::vector<float>& input, std::vector<float>& output) { Fast::rsqrt(input, output); });
+	}
+}
+
+BENCHMARK(sinExact);
+BENCHMARK(sinFast);
+BENCHMARK(sinBatched);
+BENCHMARK(cosExact);
+BENCHMARK(cosFast);
+BENCHMARK(cosBatched);
+BENCHMARK(sqrtExact);
+BENCHMARK(sqrtFast);
+BENCHMARK(sqrtBatched);
+BENCHMARK(rsqrtExact);
+BENCHMARK(rsqrtFast);
+BENCHMARK(rsqrtBatched);
@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Angle.h"
+#include "Geometry.h"
+#include "Matrix.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+namespace
+{
+	std::vector<AABB> randomBoxes(const size_t count)
+	{
+		const std::vector<Vector3> centers = randomVectors(count, -20.f, 20.f);
+		std::vector<Vector3> extents = randomVectors(count, 0.f, 4.f);
+
+		// Flat and point boxes, as for the bounds of planes and particles
+		for (size_t i = 0; i < count; i += 8)
+		{
+			extents[i].m_y = 0.f;
+			extents[i + 1] = Vector3::zero();
+		}
+
+		std::vector<AABB> boxes(count);
+
+		for (size_t i = 0; i < count; i++)
+			boxes[i] = AABB::fromCenterExtents(centers[i], extents[i]);
+
+		return boxes;
+	}
+
+	// Compares the SIMD frustum test, checking every plane at once, with the early out plane by plane classification
+	void frustumIntersects(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(g_elementCount);
+		const Frustum frustum(Matrix4::perspectiveProjection(Degree(60.f), 16.f / 9.f, .1f, 30.f)
+			* Matrix4::lookAt(Vector3(0.f, 5.f, 25.f), Vector3::zero(), Vector3::up()));
+
+		for (auto _ : state)
+		{
+			size_t visibleCount = 0;
+
+			for (const AABB& box : boxes)
+				visibleCount += frustum.intersects(box);
+
+			benchmark::DoNotOptimize(visibleCount);
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	void frustumClassify(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(g_elementCount);
+		const Frustum frustum(Matrix4::perspectiveProjection(Degree(60.f), 16.f / 9.f, .1f, 30.f)
+			* Matrix4::lookAt(Vector3(0.f, 5.f, 25.f), Vector3::zero(), Vector3::up()));
+
+		for (auto _ : state)
+		{
+			size_t visibleCount = 0;
+
+			for (const AABB& box : boxes)
+			{
+				uint8_t planeMask = Frustum::ALL_PLANES;
+				uint8_t lastPlane = 0;
+
+				visibleCount += frustum.classify(box, planeMask, lastPlane) != EContainment::OUTSIDE;
+			}
+
+			benchmark::DoNotOptimize(visibleCount);
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	void aabbRaycast(benchmark::State& state)
+	{
+		const std::vector<AABB> boxes = randomBoxes(g_elementCount);
+		const std::vector<Vector3> directions = randomVectors(g_elementCount, -1.f, 1.f);
+
+		for (auto _ : state)
+		{
+			size_t hitCount = 0;
+
+			for (size_t i = 0; i < g_elementCount; i++)
+			{
+				float distanceIn, distanceOut;
+				hitCount += boxes[i].raycast(Vector3::zero(), Vector3::one() / directions[i], distanceIn, distanceOut);
+			}
+
+			benchmark::DoNotOptimize(hitCount);
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+}
+
+BENCHMARK(frustumIntersects);
+BENCHMARK(frustumClassify);
+BENCHMARK(aabbRaycast);
@@ -0,0 +1,16 @@
+#include <benchmark/benchmark.h>
+
+// Run with --benchmark_out=<file> --benchmark_out_format=json to record a run,
+// then compare it with a baseline using compare_baseline.py
+int main(int argc, char** argv)
+{
+	benchmark::Initialize(&argc, argv);
+
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return 0;
+}
@@ -0,0 +1,134 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Angle.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+namespace
+{
+	// Random translation, rotation and scale matrices - always invertible
+	std::vector<Matrix4> randomMatrices(const size_t count)
+	{
+		const std::vector<Vector3> translations = randomVectors(count, -100.f, 100.f);
+		const std::vector<Vector3> angles = randomVectors(count, -180.f, 180.f);
+		const std::vector<float> scales = randomFloats(count, .5f, 2.f);
+
+		std::vector<Matrix4> matrices(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			matrices[i] = Matrix4::translation(translations[i])
+				* Matrix4::rotation(angles[i], false)
+				* Matrix4::scaling(scales[i], scales[i], scales[i]);
+		}
+
+		return matrices;
+	}
+
+	template <typename Func>
+	void benchmarkMatrices(benchmark::State& state, Func func)
+	{
+		const std::vector<Matrix4> matrices = randomMatrices(g_elementCount);
+		std::vector<Matrix4> output(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < g_elementCount; i++)
+				output[i] = func(matrices[i], matrices[g_elementCount - 1 - i]);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	template <typename Func>
+	void benchmarkVectors(benchmark::State& state, Func func)
+	{
+		const std::vector<Vector3> first = randomVectors(g_elementCount, -100.f, 100.f);
+		const std::vector<Vector3> second = randomVectors(g_elementCount * 2, -100.f, 100.f);
+		std::vector<Matrix4> output(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < g_elementCount; i++)
+				output[i] = func(first[i], second[g_elementCount + i]);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	void matrix4Multiply(benchmark::State& state)
+	{
+		benchmarkMatrices(state, [](const Matrix4& a, const Matrix4& b) { return Matrix4(a * b); });
+	}
+
+	void matrix4Inverse(benchmark::State& state)
+	{
+		benchmarkMatrices(state, [](const Matrix4& matrix, const Matrix4&) { return Matrix4(matrix.inverse()); });
+	}
+
+	void matrix4InverseAffine(benchmark::State& state)
+	{
+		benchmarkMatrices(state, [](const Matrix4& matrix, const Matrix4&) { return matrix.inverseAffine(); });
+	}
+
+	void matrix4Transposed(benchmark::State& state)
+	{
+		benchmarkMatrices(state, [](const Matrix4& matrix, const Matrix4&) { return Matrix4(matrix.transposed()); });
+	}
+
+	void matrix4Rotation(benchmark::State& state)
+	{
+		benchmarkVectors(state, [](const Vector3& angles, const Vector3&)
+		{
+			return Matrix4::rotation(Degree(angles.m_y), Degree(angles.m_x), Degree(angles.m_z));
+		});
+	}
+
+	void matrix4RotationAxis(benchmark::State& state)
+	{
+		benchmarkVectors(state, [](const Vector3& angles, const Vector3& axis)
+		{
+			return Matrix4::rotation(Degree(angles.m_x), axis);
+		});
+	}
+
+	void matrix4PerspectiveProjection(benchmark::State& state)
+	{
+		benchmarkVectors(state, [](const Vector3& values, const Vector3&)
+		{
+			// Keep the fov in ]0, 180[ and the planes in a valid order
+			return Matrix4::perspectiveProjection(Degree(LibMath::abs(values.m_x) * 1.5f + 10.f),
+				LibMath::abs(values.m_y) * .02f + 1.f, .1f, LibMath::abs(values.m_z) + 1.f);
+		});
+	}
+
+	void matrix4LookAt(benchmark::State& state)
+	{
+		benchmarkVectors(state, [](const Vector3& eye, const Vector3& center)
+		{
+			return Matrix4::lookAt(eye, center, Vector3::up());
+		});
+	}
+}
+
+BENCHMARK(matrix4Multiply);
+BENCHMARK(matrix4Inverse);
+BENCHMARK(matrix4InverseAffine);
+BENCHMARK(matrix4Transposed);
+BENCHMARK(matrix4Rotation);
+BENCHMARK(matrix4RotationAxis);
+BENCHMARK(matrix4PerspectiveProjection);
+BENCHMARK(matrix4LookAt);
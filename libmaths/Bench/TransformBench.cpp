@@ -0,0 +1,104 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Transform.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+namespace
+{
+	// Exposes the protected change notification so its cost can be measured on its own
+	class ChangeProbe final : public Transform
+	{
+	public:
+		using Transform::Transform;
+		using Transform::onChange;
+	};
+
+	std::vector<ChangeProbe> randomTransforms(const size_t count)
+	{
+		const std::vector<Vector3> positions = randomVectors(count, -100.f, 100.f);
+		const std::vector<Vector3> rotations = randomVectors(count, -180.f, 180.f);
+		const std::vector<float> scales = randomFloats(count, .5f, 2.f);
+
+		std::vector<ChangeProbe> transforms;
+		transforms.reserve(count);
+
+		for (size_t i = 0; i < count; i++)
+			transforms.emplace_back(positions[i], rotations[i], Vector3(scales[i]));
+
+		return transforms;
+	}
+
+	void transformOnChange(benchmark::State& state)
+	{
+		std::vector<ChangeProbe> transforms = randomTransforms(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (ChangeProbe& transform : transforms)
+				transform.onChange();
+
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	// A change followed by the matrix rebuild it causes - the cost paid once per moved object and frame
+	void transformOnChangeRebuild(benchmark::State& state)
+	{
+		std::vector<ChangeProbe> transforms = randomTransforms(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (ChangeProbe& transform : transforms)
+			{
+				transform.onChange();
+				benchmark::DoNotOptimize(transform.getMatrix());
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	// Several edits of the same transform between two reads only rebuild the matrix once
+	void transformSettersRebuild(benchmark::State& state)
+	{
+		std::vector<ChangeProbe> transforms = randomTransforms(g_elementCount);
+		const std::vector<Vector3> offsets = randomVectors(g_elementCount, -1.f, 1.f);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < g_elementCount; i++)
+			{
+				transforms[i].translate(offsets[i]).rotate(offsets[i]).scale(Vector3(1.f));
+				benchmark::DoNotOptimize(transforms[i].getMatrix());
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	void transformGetMatrixClean(benchmark::State& state)
+	{
+		const std::vector<ChangeProbe> transforms = randomTransforms(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (const ChangeProbe& transform : transforms)
+				benchmark::DoNotOptimize(transform.getMatrix());
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+}
+
+BENCHMARK(transformOnChange);
+BENCHMARK(transformOnChangeRebuild);
+BENCHMARK(transformSettersRebuild);
+BENCHMARK(transformGetMatrixClean);
@@ -0,0 +1,89 @@
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Bench.h"
+
+#include "Angle.h"
+#include "Vector.h"
+
+using namespace LibMath;
+using namespace Bench;
+
+namespace
+{
+	// Applies the given operation to every pair of a fixed set of random vectors
+	template <typename Result, typename Func>
+	void benchmarkBinary(benchmark::State& state, Func func)
+	{
+		const std::vector<Vector3> left = randomVectors(g_elementCount, -100.f, 100.f);
+		const std::vector<Vector3> right = randomVectors(g_elementCount * 2, -100.f, 100.f);
+		std::vector<Result> output(g_elementCount);
+
+		for (auto _ : state)
+		{
+			for (size_t i = 0; i < g_elementCount; i++)
+				output[i] = func(left[i], right[g_elementCount + i]);
+
+			benchmark::DoNotOptimize(output.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_elementCount));
+	}
+
+	template <typename Result, typename Func>
+	void benchmarkUnary(benchmark::State& state, Func func)
+	{
+		benchmarkBinary<Result>(state, [func](const Vector3& vector, const Vector3&) { return func(vector); });
+	}
+
+	void vector3Add(benchmark::State& state)
+	{
+		benchmarkBinary<Vector3>(state, [](const Vector3& a, const Vector3& b) { return a + b; });
+	}
+
+	void vector3Multiply(benchmark::State& state)
+	{
+		benchmarkBinary<Vector3>(state, [](const Vector3& a, const Vector3& b) { return a * b; });
+	}
+
+	void vector3Dot(benchmark::State& state)
+	{
+		benchmarkBinary<float>(state, [](const Vector3& a, const Vector3& b) { return a.dot(b); });
+	}
+
+	void vector3Cross(benchmark::State& state)
+	{
+		benchmarkBinary<Vector3>(state, [](const Vector3& a, const Vector3& b) { return a.cross(b); });
+	}
+
+	void vector3DistanceFrom(benchmark::State& state)
+	{
+		benchmarkBinary<float>(state, [](const Vector3& a, const Vector3& b) { return a.distanceFrom(b); });
+	}
+
+	void vector3Magnitude(benchmark::State& state)
+	{
+		benchmarkUnary<float>(state, [](const Vector3& vector) { return vector.magnitude(); });
+	}
+
+	void vector3Normalized(benchmark::State& state)
+	{
+		benchmarkUnary<Vector3>(state, [](const Vector3& vector) { return vector.normalized(); });
+	}
+
+	void vector3AngleFrom(benchmark::State& state)
+	{
+		benchmarkBinary<float>(state, [](const Vector3& a, const Vector3& b) { return a.angleFrom(b).raw(); });
+	}
+}
+
+BENCHMARK(vector3Add);
+BENCHMARK(vector3Multiply);
+BENCHMARK(vector3Dot);
+BENCHMARK(vector3Cross);
+BENCHMARK(vector3DistanceFrom);
+BENCHMARK(vector3Magnitude);
+BENCHMARK(vector3Normalized);
+BENCHMARK(vector3AngleFrom);
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Compares a libmaths_bench run with a baseline and flags the regressions.
+
+Both files are Google Benchmark json reports, as written by
+    libmaths_bench --benchmark_out=<file> --benchmark_out_format=json
+
+When the runs were repeated (--benchmark_repetitions), the median aggregate is
+compared, which is much less sensitive to noise than a single run.
+
+Exits with 1 if any benchmark got slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+from collections import defaultdict
+
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    """Reads a report and returns the time of each benchmark, in nanoseconds."""
+    with open(path, encoding="utf-8") as file:
+        report = json.load(file)
+
+    iterations = defaultdict(list)
+    medians = {}
+
+    for benchmark in report.get("benchmarks", []):
+        if benchmark.get("error_occurred"):
+            continue
+
+        name = benchmark.get("run_name", benchmark["name"])
+        time = benchmark[metric] * TIME_UNITS[benchmark.get("time_unit", "ns")]
+
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[name] = time
+        else:
+            iterations[name].append(time)
+
+    times = {name: sum(values) / len(values) for name, values in iterations.items()}
+    times.update(medians)
+
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="reference report")
+    parser.add_argument("current", help="report to check")
+    parser.add_argument("--threshold", type=float, default=.10,
+                        help="relative slowdown above which a benchmark is a regression (default: 0.10)")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"), default="cpu_time",
+                        help="time compared between the reports (default: cpu_time)")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    current = load_times(args.current, args.metric)
+
+    regressions = []
+    width = max((len(name) for name in baseline.keys() | current.keys()), default=9)
+
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'current':>12} {'change':>9}")
+
+    for name in sorted(baseline.keys() & current.keys()):
+        change = current[name] / baseline[name] - 1.0 if baseline[name] > 0.0 else 0.0
+
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            status = "improved"
+        else:
+            status = ""
+
+        print(f"{name:<{width}} {baseline[name]:>10.1f}ns {current[name]:>10.1f}ns {change:>+8.1%}  {status}".rstrip())
+
+    for name in sorted(baseline.keys() - current.keys()):
+        print(f"{name:<{width}} missing from the current run")
+
+    for name in sorted(current.keys() - baseline.keys()):
+        print(f"{name:<{width}} not in the baseline")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than the baseline by more than {args.threshold:.0%}")
+        return 1
+
+    print(f"\nNo regression above {args.threshold:.0%}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,8 +1,6 @@
 #ifndef __LIBMATH__ANGLE__DEGREE_H__
 #define __LIBMATH__ANGLE__DEGREE_H__
 
-#include "Angle/Radian.h"
-
 namespace LibMath
 {
 	class Radian;
@@ -10,44 +8,47 @@ namespace LibMath
 	class Degree
 	{
 	public:
-		Degree();
-		explicit Degree(float);						// explicit so no ambiguous / implicit conversion from float to angle can happen
-		Degree(Degree const&);
-		~Degree();
+		constexpr			Degree() noexcept;
+		explicit constexpr	Degree(float) noexcept;				// explicit so no ambiguous / implicit conversion from float to angle can happen
+		constexpr			Degree(Degree const&) noexcept = default;
+		constexpr			~Degree() = default;
 
-		operator Radian() const;					// Radian angle = Degree{0.5};		// implicit conversion from Degree to Radian
+		constexpr			operator Radian() const noexcept;	// Radian angle = Degree{0.5};		// implicit conversion from Degree to Radian
 
-		Degree& operator=(Degree const&);
-		Degree& operator+=(const Degree&);					// Degree angle += Degree{45};
-		Degree& operator-=(const Degree&);					// Degree angle -= Degree{45};
-		Degree& operator*=(float);					// Degree angle *= 3;
-		Degree& operator/=(float);					// Degree angle /= 3;
+		constexpr Degree&	operator=(Degree const&) noexcept = default;
+		constexpr Degree&	operator+=(const Degree&) noexcept;	// Degree angle += Degree{45};
+		constexpr Degree&	operator-=(const Degree&) noexcept;	// Degree angle -= Degree{45};
+		constexpr Degree&	operator*=(float) noexcept;			// Degree angle *= 3;
+		constexpr Degree&	operator/=(float) noexcept;			// Degree angle /= 3;
 
-		void	wrap(bool = false);					// true -> limit m_value to range [-180, 180[	// false -> limit m_value to range [0, 360[
+		constexpr void		wrap(bool = false) noexcept;		// true -> limit m_value to range [-180, 180[	// false -> limit m_value to range [0, 360[
 
-		float	degree(bool = false) const;			// return angle in degree	// true -> limit value to range [-180, 180[	// false -> limit value to range [0, 360[
-		float	radian(bool = true) const;			// return angle in radian	// true -> limit value to range [-pi, pi[		// false -> limit value to range [0, 2 pi[
-		float	raw() const;						// return m_angle
+		constexpr float		degree(bool = false) const noexcept;	// return angle in degree	// true -> limit value to range [-180, 180[	// false -> limit value to range [0, 360[
+		constexpr float		radian(bool = true) const noexcept;		// return angle in radian	// true -> limit value to range [-pi, pi[		// false -> limit value to range [0, 2 pi[
+		constexpr float		raw() const noexcept;					// return m_angle
 
 	private:
 		float m_value;
 	};
 
-	bool	operator==(const Degree&, const Degree&);		// bool isEqual = Degree{45} == Degree{45};		// true
-	bool	operator==(const Degree&, Radian const&);		// bool isEqual = Degree{60} == Radian{0.5};	// false
+	constexpr bool		operator==(const Degree&, const Degree&) noexcept;		// bool isEqual = Degree{45} == Degree{45};		// true
+	constexpr bool		operator==(const Degree&, Radian const&) noexcept;		// bool isEqual = Degree{60} == Radian{0.5};	// false
 
-	Degree	operator-(const Degree&);						// Degree angle = - Degree{45};					// Degree{-45}
+	constexpr Degree	operator-(const Degree&) noexcept;						// Degree angle = - Degree{45};					// Degree{-45}
 
-	Degree	operator+(Degree, const Degree&);				// Degree angle = Degree{45} + Degree{45};		// Degree{90}
-	Degree	operator-(Degree, const Degree&);				// Degree angle = Degree{45} - Degree{45};		// Degree{0}
-	Degree	operator*(Degree, float);				// Degree angle = Degree{45} * 3;				// Degree{135}
-	Degree	operator/(Degree, float);				// Degree angle = Degree{45} / 3;				// Degree{15}
+	constexpr Degree	operator+(Degree, const Degree&) noexcept;				// Degree angle = Degree{45} + Degree{45};		// Degree{90}
+	constexpr Degree	operator-(Degree, const Degree&) noexcept;				// Degree angle = Degree{45} - Degree{45};		// Degree{0}
+	constexpr Degree	operator*(Degree, float) noexcept;						// Degree angle = Degree{45} * 3;				// Degree{135}
+	constexpr Degree	operator/(Degree, float) noexcept;						// Degree angle = Degree{45} / 3;				// Degree{15}
 
 	inline namespace Literal
 	{
-		Degree operator""_deg(long double);			// Degree angle = 7.5_deg;
-		Degree operator""_deg(unsigned long long int);	// Degree angle = 45_deg;
+		constexpr Degree operator""_deg(long double) noexcept;				// Degree angle = 7.5_deg;
+		constexpr Degree operator""_deg(unsigned long long int) noexcept;	// Degree angle = 45_deg;
 	}
 }
 
+#include "Angle/Radian.h"
+#include "Angle/Degree.inl"
+
 #endif // !__LIBMATH__ANGLE__DEGREE_H__
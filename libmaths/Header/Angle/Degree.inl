@@ -0,0 +1,126 @@
+#ifndef __LIBMATH__ANGLE__DEGREE_INL__
+#define __LIBMATH__ANGLE__DEGREE_INL__
+
+#include "Arithmetic.h"
+#include "Trigonometry.h"
+#include "Angle/Degree.h"
+#include "Angle/Radian.h"
+
+namespace LibMath
+{
+	constexpr Degree::Degree() noexcept : m_value(0)
+	{
+	}
+
+	constexpr Degree::Degree(const float angle) noexcept : m_value(angle)
+	{
+	}
+
+	constexpr Degree::operator Radian() const noexcept
+	{
+		return Radian(m_value * g_pi / 180);
+	}
+
+	constexpr Degree& Degree::operator+=(const Degree& angle) noexcept
+	{
+		this->m_value += angle.m_value;
+
+		return *this;
+	}
+
+	constexpr Degree& Degree::operator-=(const Degree& angle) noexcept
+	{
+		this->m_value -= angle.m_value;
+
+		return *this;
+	}
+
+	constexpr Degree& Degree::operator*=(const float val) noexcept
+	{
+		this->m_value *= val;
+
+		return *this;
+	}
+
+	constexpr Degree& Degree::operator/=(const float val) noexcept
+	{
+		this->m_value /= val;
+
+		return *this;
+	}
+
+	constexpr void Degree::wrap(const bool useNegative) noexcept
+	{
+		if (useNegative)
+			this->m_value = LibMath::wrap(this->m_value, -180, 180);
+		else
+			this->m_value = LibMath::wrap(this->m_value, 0, 360);
+	}
+
+	constexpr float Degree::degree(const bool useNegative) const noexcept
+	{
+		Degree tmp = Degree(*this);
+		tmp.wrap(useNegative);
+
+		return tmp.raw();
+	}
+
+	constexpr float Degree::radian(const bool useNegative) const noexcept
+	{
+		Radian rad = Radian(*this);
+		rad.wrap(useNegative);
+		return rad.raw();
+	}
+
+	constexpr float Degree::raw() const noexcept
+	{
+		return this->m_value;
+	}
+
+	constexpr bool operator==(const Degree& lhs, const Degree& rhs) noexcept
+	{
+		return floatEquals(lhs.degree(), rhs.degree());
+	}
+
+	constexpr bool operator==(const Degree& deg, Radian const& rad) noexcept
+	{
+		return rad == deg;
+	}
+
+	constexpr Degree operator-(const Degree& angle) noexcept
+	{
+		return Degree(-angle.raw());
+	}
+
+	constexpr Degree operator+(Degree lhs, const Degree& rhs) noexcept
+	{
+		return lhs += rhs;
+	}
+
+	constexpr Degree operator-(Degree lhs, const Degree& rhs) noexcept
+	{
+		return lhs -= rhs;
+	}
+
+	constexpr Degree operator*(Degree degree, const float x) noexcept
+	{
+		return degree *= x;
+	}
+
+	constexpr Degree operator/(Degree degree, const float x) noexcept
+	{
+		return degree /= x;
+	}
+
+	constexpr Degree Literal::operator ""_deg(const long double angle) noexcept
+	{
+		return Degree(static_cast<float>(angle));
+	}
+
+	constexpr Degree Literal::operator ""_deg(const unsigned long long int angle) noexcept
+	{
+		return Degree(static_cast<float>(angle));
+	}
+}
+
+#endif // !__LIBMATH__ANGLE__DEGREE_INL__
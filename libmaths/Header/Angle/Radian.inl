@@ -0,0 +1,127 @@
+#ifndef __LIBMATH__ANGLE__RADIAN_INL__
+#define __LIBMATH__ANGLE__RADIAN_INL__
+
+#include "Arithmetic.h"
+#include "Trigonometry.h"
+#include "Angle/Radian.h"
+#include "Angle/Degree.h"
+
+namespace LibMath
+{
+	constexpr Radian::Radian() noexcept : Radian(0)
+	{
+	}
+
+	constexpr Radian::Radian(const float angle) noexcept : m_value(angle)
+	{
+	}
+
+	constexpr Radian::operator Degree() const noexcept
+	{
+		return Degree(m_value * 180 / g_pi);
+	}
+
+	constexpr Radian& Radian::operator+=(const Radian& angle) noexcept
+	{
+		this->m_value += angle.m_value;
+
+		return *this;
+	}
+
+	constexpr Radian& Radian::operator-=(const Radian& angle) noexcept
+	{
+		this->m_value -= angle.m_value;
+
+		return *this;
+	}
+
+	constexpr Radian& Radian::operator*=(const float val) noexcept
+	{
+		this->m_value *= val;
+
+		return *this;
+	}
+
+	constexpr Radian& Radian::operator/=(const float val) noexcept
+	{
+		this->m_value /= val;
+
+		return *this;
+	}
+
+	constexpr void Radian::wrap(const bool useNegative) noexcept
+	{
+		if (useNegative)
+			this->m_value = LibMath::wrap(this->m_value, -g_pi, g_pi);
+		else
+			this->m_value = LibMath::wrap(this->m_value, 0, 2 * g_pi);
+	}
+
+	constexpr float Radian::degree(const bool useNegative) const noexcept
+	{
+		Degree deg = Degree(*this);
+		deg.wrap(useNegative);
+
+		return deg.raw();
+	}
+
+	constexpr float Radian::radian(const bool useNegative) const noexcept
+	{
+		Radian tmp = Radian(*this);
+		tmp.wrap(useNegative);
+
+		return tmp.raw();
+	}
+
+	constexpr float Radian::raw() const noexcept
+	{
+		return this->m_value;
+	}
+
+	constexpr bool operator==(const Radian& lhs, const Radian& rhs) noexcept
+	{
+		return floatEquals(lhs.radian(), rhs.radian());
+	}
+
+	constexpr bool operator==(const Radian& rad, Degree const& deg) noexcept
+	{
+		return floatEquals(rad.radian(), deg.radian());
+	}
+
+	constexpr Radian operator-(const Radian& angle) noexcept
+	{
+		return Radian(-angle.raw());
+	}
+
+	constexpr Radian operator+(Radian lhs, const Radian& rhs) noexcept
+	{
+		return lhs += rhs;
+	}
+
+	constexpr Radian operator-(Radian lhs, const Radian& rhs) noexcept
+	{
+		return lhs -= rhs;
+	}
+
+	constexpr Radian operator*(Radian radian, const float x) noexcept
+	{
+		return radian *= x;
+	}
+
+	constexpr Radian operator/(Radian radian, const float x) noexcept
+	{
+		return radian /= x;
+	}
+
+	constexpr Radian Literal::operator ""_rad(const long double angle) noexcept
+	{
+		return Radian(static_cast<float>(angle));
+	}
+
+	constexpr Radian Literal::operator ""_rad(const unsigned long long int angle) noexcept
+	{
+		return Radian(static_cast<float>(angle));
+	}
+}
+
+#endif // !__LIBMATH__ANGLE__RADIAN_INL__
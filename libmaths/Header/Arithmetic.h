@@ -1,5 +1,6 @@
 #ifndef __LIBMATH__ARITHMETIC_H__
 #define __LIBMATH__ARITHMETIC_H__
+#include <cstddef>
 #include <limits>
 
 namespace LibMath
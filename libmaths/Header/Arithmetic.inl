@@ -1,6 +1,8 @@
 #ifndef __LIBMATH__ARITHMETIC_INL__
 #define __LIBMATH__ARITHMETIC_INL__
 
+#include <cmath>
+
 #include "Arithmetic.h"
 
 namespace LibMath
@@ -0,0 +1,55 @@
+#ifndef __LIBMATH__BATCH_H__
+#define __LIBMATH__BATCH_H__
+
+#include <span>
+
+#include "Matrix/Matrix4.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+	/**
+	 * \brief Transforms every point of the given array by the given matrix (w = 1).
+	 * The source and destination arrays can be the same.
+	 * \param matrix The transformation matrix
+	 * \param points The points to transform
+	 * \param out The array in which the transformed points should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void transformPoints(const Matrix4& matrix, std::span<const Vector3> points, std::span<Vector3> out);
+
+	/**
+	 * \brief Transforms every direction of the given array by the given matrix (w = 0).
+	 * The source and destination arrays can be the same.
+	 * \param matrix The transformation matrix
+	 * \param directions The directions to transform
+	 * \param out The array in which the transformed directions should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void transformDirections(const Matrix4& matrix, std::span<const Vector3> directions, std::span<Vector3> out);
+
+	/**
+	 * \brief Computes the axis aligned bounding boxes enclosing the given boxes once transformed by the given matrix.
+	 * The source and destination arrays can be the same.
+	 * \param matrix The transformation matrix
+	 * \param centers The boxes' centers
+	 * \param extents The boxes' half sizes
+	 * \param outCenters The array in which the transformed boxes' centers should be written
+	 * \param outExtents The array in which the transformed boxes' half sizes should be written
+	 * \throw std::invalid_argument if the arrays' sizes don't match
+	 */
+	void transformAABBs(const Matrix4& matrix, std::span<const Vector3> centers, std::span<const Vector3> extents,
+		std::span<Vector3> outCenters, std::span<Vector3> outExtents);
+
+	/**
+	 * \brief Multiplies every parent matrix by the local matrix at the same index (out[i] = parents[i] * locals[i]).
+	 * The output array must not overlap with the operands
+	 * \param parents The left operands
+	 * \param locals The right operands
+	 * \param out The array in which the products should be written
+	 * \throw std::invalid_argument if the arrays' sizes don't match
+	 */
+	void concatenate(std::span<const Matrix4> parents, std::span<const Matrix4> locals, std::span<Matrix4> out);
+}
+
+#endif // !__LIBMATH__BATCH_H__
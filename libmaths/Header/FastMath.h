@@ -0,0 +1,164 @@
+#ifndef __LIBMATH__FAST_MATH_H__
+#define __LIBMATH__FAST_MATH_H__
+
+#include <span>
+
+#include "Simd.h"
+#include "Trigonometry.h"
+
+// Accuracy tiers:
+// - exact: LibMath::sin, cos, tan, atan... (Trigonometry.h) forward to the C runtime, within 1 ulp on the mainstream ones.
+// - fast: LibMath::Fast::* below are branch-light polynomial approximations usable in constant expressions.
+// - vectorised: the register and span overloads below evaluate the fast kernels on 4 (SSE) or 8 (AVX2) lanes at once.
+//
+// The fast tier is opt-in: callers switch explicitly by replacing LibMath::sin with LibMath::Fast::sin.
+// The documented error bounds are checked by the libmaths_bench target (see Bench/FastMathBench.cpp).
+namespace LibMath::Fast
+{
+	/**
+	 * \brief Approximates the sine of the given angle.
+	 * Max error: 2 ulp for |angle| <= 2 pi, 1e-7 absolute for |angle| <= 8192. The precision degrades past that range
+	 * \param angle The angle whose sine should be computed
+	 * \return An approximation of the angle's sine
+	 */
+	constexpr float	sin(const Radian& angle) noexcept;
+
+	/**
+	 * \brief Approximates the cosine of the given angle.
+	 * Max error: 2 ulp for |angle| <= 2 pi, 1e-7 absolute for |angle| <= 8192. The precision degrades past that range
+	 * \param angle The angle whose cosine should be computed
+	 * \return An approximation of the angle's cosine
+	 */
+	constexpr float	cos(const Radian& angle) noexcept;
+
+	/**
+	 * \brief Approximates both the sine and the cosine of the given angle, sharing the range reduction.
+	 * Same error bounds as sin and cos
+	 * \param angle The angle whose sine and cosine should be computed
+	 * \param outSin The variable in which the sine should be written
+	 * \param outCos The variable in which the cosine should be written
+	 */
+	constexpr void	sinCos(const Radian& angle, float& outSin, float& outCos) noexcept;
+
+	/**
+	 * \brief Approximates the arc tangent of the given value.
+	 * Max error: 4 ulp
+	 * \param value The value whose arc tangent should be computed
+	 * \return An approximation of the value's arc tangent in the range [-pi / 2, pi / 2]
+	 */
+	constexpr Radian	atan(float value) noexcept;
+
+	/**
+	 * \brief Approximates the arc tangent of y / x, using the operands' signs to find the quadrant.
+	 * Max error: 4 ulp
+	 * \param y The y coordinate
+	 * \param x The x coordinate
+	 * \return An approximation of the angle between the x axis and (x, y) in the range [-pi, pi]
+	 */
+	constexpr Radian	atan(float y, float x) noexcept;
+
+	/**
+	 * \brief Approximates the reciprocal square root (1 / sqrt(value)) of the given value.
+	 * Max error: 2 ulp
+	 * \param value The value whose reciprocal square root should be computed. Must be positive and normal
+	 * \return An approximation of 1 / sqrt(value)
+	 */
+	constexpr float	rsqrt(float value) noexcept;
+
+	/**
+	 * \brief Computes the square root of the given value.
+	 * At runtime this is the hardware square root (0.5 ulp), which is cheaper than any scalar approximation.
+	 * Max error in constant expressions: 3 ulp
+	 * \param value The value whose square root should be computed
+	 * \return An approximation of the square root of the given value. 0 if the value isn't positive
+	 */
+	constexpr float	sqrt(float value) noexcept;
+
+	/**
+	 * \brief Approximates the sine of every angle, in radians, of the given array.
+	 * Same error bounds as the scalar version. The source and destination arrays can be the same.
+	 * \param radians The angles whose sine should be computed
+	 * \param out The array in which the sines should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void			sin(std::span<const float> radians, std::span<float> out);
+
+	/**
+	 * \brief Approximates the cosine of every angle, in radians, of the given array.
+	 * Same error bounds as the scalar version. The source and destination arrays can be the same.
+	 * \param radians The angles whose cosine should be computed
+	 * \param out The array in which the cosines should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void			cos(std::span<const float> radians, std::span<float> out);
+
+	/**
+	 * \brief Approximates the square root of every value of the given array.
+	 * Max error: 3 ulp. The source and destination arrays can be the same.
+	 * \param values The values whose square root should be computed
+	 * \param out The array in which the square roots should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void			sqrt(std::span<const float> values, std::span<float> out);
+
+	/**
+	 * \brief Approximates the reciprocal square root of every value of the given array.
+	 * Same error bounds as the scalar version. The source and destination arrays can be the same.
+	 * \param values The values whose reciprocal square root should be computed. Must be positive and normal
+	 * \param out The array in which the reciprocal square roots should be written
+	 * \throw std::invalid_argument if the output array is smaller than the input
+	 */
+	void			rsqrt(std::span<const float> values, std::span<float> out);
+
+#ifdef LIBMATH_USE_SIMD
+	/**
+	 * \brief Approximates the sine and cosine of the 4 angles, in radians, of the given register
+	 * \param radians The angles whose sine and cosine should be computed
+	 * \param outSin The register in which the sines should be written
+	 * \param outCos The register in which the cosines should be written
+	 */
+	void			sinCos(__m128 radians, __m128& outSin, __m128& outCos);
+
+	/**
+	 * \brief Approximates the reciprocal square root of the 4 lanes of the given register
+	 * \param values The values whose reciprocal square root should be computed
+	 * \return An approximation of 1 / sqrt(values), within 2 ulp
+	 */
+	__m128			rsqrt(__m128 values);
+
+	/**
+	 * \brief Approximates the square root of the 4 lanes of the given register
+	 * \param values The values whose square root should be computed. Must be finite
+	 * \return An approximation of sqrt(values), within 3 ulp. 0 in the lanes whose value isn't positive
+	 */
+	__m128			sqrt(__m128 values);
+
+#ifdef LIBMATH_SIMD_AVX2
+	/**
+	 * \brief Approximates the sine and cosine of the 8 angles, in radians, of the given register
+	 * \param radians The angles whose sine and cosine should be computed
+	 * \param outSin The register in which the sines should be written
+	 * \param outCos The register in which the cosines should be written
+	 */
+	void			sinCos(__m256 radians, __m256& outSin, __m256& outCos);
+
+	/**
+	 * \brief Approximates the reciprocal square root of the 8 lanes of the given register
+	 * \param values The values whose reciprocal square root should be computed
+	 * \return An approximation of 1 / sqrt(values), within 2 ulp
+	 */
+	__m256			rsqrt(__m256 values);
+
+	/**
+	 * \brief Approximates the square root of the 8 lanes of the given register
+	 * \param values The values whose square root should be computed. Must be finite
+	 * \return An approximation of sqrt(values), within 3 ulp. 0 in the lanes whose value isn't positive
+	 */
+	__m256			sqrt(__m256 values);
+#endif // LIBMATH_SIMD_AVX2
+#endif // LIBMATH_USE_SIMD
+}
+
+#include "FastMath.inl"
+
+#endif // !__LIBMATH__FAST_MATH_H__
@@ -0,0 +1,177 @@
+#ifndef __LIBMATH__FAST_MATH_INL__
+#define __LIBMATH__FAST_MATH_INL__
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "FastMath.h"
+#include "Angle/Radian.h"
+
+namespace LibMath::Fast
+{
+	namespace Detail
+	{
+		// Sine and cosine follow the cephes single precision implementation: the angle is reduced to [-pi / 4, pi / 4]
+		// with an extended precision (Cody-Waite) subtraction of the closest multiple of pi / 2, then evaluated with
+		// minimax polynomials. The constants are shared with the SSE and AVX2 kernels so every tier agrees.
+		constexpr float g_fourOverPi = 1.27323954473516f;
+		constexpr float g_piOver4Part1 = .78515625f;
+		constexpr float g_piOver4Part2 = 2.4187564849853515625e-4f;
+		constexpr float g_piOver4Part3 = 3.77489497744594108e-8f;
+
+		constexpr float g_sin1 = -1.6666654611e-1f;
+		constexpr float g_sin2 = 8.3321608736e-3f;
+		constexpr float g_sin3 = -1.9515295891e-4f;
+
+		constexpr float g_cos1 = 4.166664568298827e-2f;
+		constexpr float g_cos2 = -1.388731625493765e-3f;
+		constexpr float g_cos3 = 2.443315711809948e-5f;
+
+		constexpr float g_tan3PiOver8 = 2.414213562373095f;
+		constexpr float g_tanPiOver8 = .4142135623730950f;
+
+		constexpr float g_atan1 = -3.33329491539e-1f;
+		constexpr float g_atan2 = 1.99777106478e-1f;
+		constexpr float g_atan3 = -1.38776856032e-1f;
+		constexpr float g_atan4 = 8.05374449538e-2f;
+
+		// Initial guess of the reciprocal square root from the float's bit pattern, followed by a Newton-Raphson step
+		// whose constants are tuned to minimize the relative error (Kadlec's variant of the fast inverse square root)
+		constexpr uint32_t g_rsqrtMagic = 0x5F1FFFF9;
+		constexpr float g_rsqrtScale = .703952253f;
+		constexpr float g_rsqrtOffset = 2.38924456f;
+
+		constexpr float sinPolynomial(const float x, const float xSquared) noexcept
+		{
+			return ((g_sin3 * xSquared + g_sin2) * xSquared + g_sin1) * xSquared * x + x;
+		}
+
+		constexpr float cosPolynomial(const float xSquared) noexcept
+		{
+			return ((g_cos3 * xSquared + g_cos2) * xSquared + g_cos1) * xSquared * xSquared - .5f * xSquared + 1.f;
+		}
+	}
+
+	constexpr float sin(const Radian& angle) noexcept
+	{
+		float sin = 0.f, cos = 0.f;
+		sinCos(angle, sin, cos);
+		return sin;
+	}
+
+	constexpr float cos(const Radian& angle) noexcept
+	{
+		float sin = 0.f, cos = 0.f;
+		sinCos(angle, sin, cos);
+		return cos;
+	}
+
+	constexpr void sinCos(const Radian& angle, float& outSin, float& outCos) noexcept
+	{
+		using namespace Detail;
+
+		const float radians = angle.raw();
+		float x = radians < 0.f ? -radians : radians;
+
+		// Index of the closest multiple of pi / 4 rounded to an even value - i.e. the closest multiple of pi / 2
+		const int octant = (static_cast<int>(x * g_fourOverPi) + 1) & ~1;
+		const float y = static_cast<float>(octant);
+
+		x = ((x - y * g_piOver4Part1) - y * g_piOver4Part2) - y * g_piOver4Part3;
+
+		const float xSquared = x * x;
+		const float sinX = sinPolynomial(x, xSquared);
+		const float cosX = cosPolynomial(xSquared);
+
+		// sin(k * pi / 2 + x) and cos(k * pi / 2 + x) are +-sin(x) or +-cos(x) depending on the quadrant.
+		// The selection is done on the bit patterns since the quadrants of arbitrary angles can't be predicted
+		const uint32_t swapMask = 0u - static_cast<uint32_t>((octant >> 1) & 1);
+		const uint32_t sinSign = (std::bit_cast<uint32_t>(radians) ^ static_cast<uint32_t>(octant) << 29) & 0x80000000u;
+		const uint32_t cosSign = static_cast<uint32_t>(octant + 2) << 29 & 0x80000000u;
+
+		const uint32_t sinBits = std::bit_cast<uint32_t>(sinX);
+		const uint32_t cosBits = std::bit_cast<uint32_t>(cosX);
+
+		outSin = std::bit_cast<float>(((sinBits & ~swapMask) | (cosBits & swapMask)) ^ sinSign);
+		outCos = std::bit_cast<float>(((cosBits & ~swapMask) | (sinBits & swapMask)) ^ cosSign);
+	}
+
+	constexpr Radian atan(const float value) noexcept
+	{
+		using namespace Detail;
+
+		float x = value < 0.f ? -value : value;
+		float offset = 0.f;
+
+		// Reduce the argument to [0, tan(pi / 8)] with the tangent's addition formulas
+		if (x > g_tan3PiOver8)
+		{
+			offset = g_pi * .5f;
+			x = -1.f / x;
+		}
+		else if (x > g_tanPiOver8)
+		{
+			offset = g_pi * .25f;
+			x = (x - 1.f) / (x + 1.f);
+		}
+
+		const float xSquared = x * x;
+		const float result = offset + (((g_atan4 * xSquared + g_atan3) * xSquared + g_atan2) * xSquared + g_atan1) * xSquared * x + x;
+
+		return Radian(value < 0.f ? -result : result);
+	}
+
+	constexpr Radian atan(const float y, const float x) noexcept
+	{
+		if (x == 0.f)
+		{
+			if (y == 0.f)
+				return Radian(0.f);
+
+			return Radian(y > 0.f ? g_pi * .5f : -g_pi * .5f);
+		}
+
+		const float result = atan(y / x).raw();
+
+		if (x > 0.f)
+			return Radian(result);
+
+		return Radian(y < 0.f ? result - g_pi : result + g_pi);
+	}
+
+	constexpr float rsqrt(const float value) noexcept
+	{
+		using namespace Detail;
+
+		// Initial guess from the bit pattern, the tuned Newton-Raphson step brings the 12% error down to 6.5e-4.
+		// Unlike the rsqrtss instruction, this sequence lets the compiler vectorize loops calling it
+		float result = std::bit_cast<float>(g_rsqrtMagic - (std::bit_cast<uint32_t>(value) >> 1));
+		result *= g_rsqrtScale * (g_rsqrtOffset - value * result * result);
+
+		// Second order Householder step - cubic convergence, from 6.5e-4 to float precision
+		const float error = 1.f - value * result * result;
+		return result + result * error * (.5f + .375f * error);
+	}
+
+	constexpr float sqrt(const float value) noexcept
+	{
+		if (!std::is_constant_evaluated())
+		{
+			// The hardware square root is cheaper than any scalar approximation
+			return std::sqrt(value > 0.f ? value : 0.f);
+		}
+
+		if (!(value > 0.f))
+			return 0.f;
+
+		if (value == std::numeric_limits<float>::infinity())
+			return value;
+
+		return value * rsqrt(value);
+	}
+}
+
+#endif // !__LIBMATH__FAST_MATH_INL__
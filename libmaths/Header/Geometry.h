@@ -0,0 +1,10 @@
+#ifndef __LIBMATH__GEOMETRY_H__
+#define __LIBMATH__GEOMETRY_H__
+
+#include "Geometry/AABB.h"
+#include "Geometry/Frustum.h"
+#include "Geometry/OBB.h"
+#include "Geometry/Plane.h"
+#include "Geometry/Sphere.h"
+
+#endif // !__LIBMATH__GEOMETRY_H__
@@ -0,0 +1,109 @@
+#ifndef __LIBMATH__GEOMETRY__AABB_H__
+#define __LIBMATH__GEOMETRY__AABB_H__
+
+#include "Vector/Vector3.h"
+#include "Matrix/Matrix4.h"
+
+namespace LibMath
+{
+	class AABB
+	{
+	public:
+		constexpr AABB() noexcept = default;
+
+		/**
+		 * \brief Creates an axis aligned bounding box from its corners
+		 * \param min The box's lowest corner
+		 * \param max The box's highest corner
+		 */
+		constexpr AABB(const Vector3& min, const Vector3& max) noexcept;
+
+		/**
+		 * \brief Creates an axis aligned bounding box from its center and half size
+		 * \param center The box's center
+		 * \param extents The box's half size
+		 * \return The created box
+		 */
+		static constexpr AABB	fromCenterExtents(const Vector3& center, const Vector3& extents) noexcept;
+
+		/**
+		 * \brief Creates an inverted box which encapsulating anything turns into that thing's bounds
+		 * \return An empty box
+		 */
+		static constexpr AABB	empty() noexcept;
+
+		constexpr Vector3		center() const noexcept;		// return the box's center
+		constexpr Vector3		extents() const noexcept;		// return the box's half size
+		constexpr Vector3		size() const noexcept;			// return the box's full size
+		constexpr float			surfaceArea() const noexcept;	// return the total area of the box's faces
+		constexpr bool			isEmpty() const noexcept;		// return whether the box's min is above its max on any axis
+
+		/**
+		 * \brief Checks whether the given point is inside the box (boundaries included)
+		 * \param point The point to check
+		 * \return True if the point is inside the box. False otherwise
+		 */
+		constexpr bool			contains(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Checks whether the given box is entirely inside the current one
+		 * \param other The box to check
+		 * \return True if the given box is inside the current one. False otherwise
+		 */
+		constexpr bool			contains(const AABB& other) const noexcept;
+
+		/**
+		 * \brief Checks whether the given box overlaps with the current one (touching boxes overlap)
+		 * \param other The box to check
+		 * \return True if the boxes overlap. False otherwise
+		 */
+		constexpr bool			intersects(const AABB& other) const noexcept;
+
+		/**
+		 * \brief Computes the distances at which a ray enters and leaves the box (slab test).
+		 * The inverse direction is taken instead of the direction so it can be computed once per ray.
+		 * \param origin The ray's origin
+		 * \param inverseDirection The component wise inverse of the ray's direction (1 / direction)
+		 * \param outNear The distance, in direction lengths, at which the ray enters the box. Negative if the origin is inside the box
+		 * \param outFar The distance, in direction lengths, at which the ray leaves the box
+		 * \return True if the ray (not the line) hits or touches the box, e.g. when lying in a face's plane. False otherwise
+		 */
+		constexpr bool			raycast(const Vector3& origin, const Vector3& inverseDirection, float& outNear, float& outFar) const noexcept;
+
+		/**
+		 * \brief Computes the point of the box (surface or inside) closest to the given point
+		 * \param point The point to project on the box
+		 * \return The closest point of the box
+		 */
+		constexpr Vector3		closestPoint(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Computes the squared distance between the given point and the box. 0 if the point is inside
+		 * \param point The point whose distance to the box should be computed
+		 * \return The squared distance between the point and the box
+		 */
+		constexpr float			distanceSquaredFrom(const Vector3& point) const noexcept;
+
+		constexpr void			encapsulate(const Vector3& point) noexcept;		// grow the box to include the given point
+		constexpr void			encapsulate(const AABB& other) noexcept;		// grow the box to include the given box
+		constexpr AABB			merged(const AABB& other) const noexcept;		// return the smallest box containing both boxes
+		constexpr AABB			expanded(const Vector3& margin) const noexcept;	// return a copy of the box grown by the given margin on every side
+
+		/**
+		 * \brief Computes the axis aligned box enclosing the current one once transformed by the given matrix
+		 * \param matrix The transformation matrix
+		 * \return The transformed box's bounds
+		 */
+		AABB					transformed(const Matrix4& matrix) const noexcept;
+
+		Vector3 m_min;
+		Vector3 m_max;
+	};
+
+	constexpr bool operator==(const AABB&, const AABB&) noexcept;
+	constexpr bool operator!=(const AABB&, const AABB&) noexcept;
+}
+
+#include "AABB.inl"
+
+#endif // !__LIBMATH__GEOMETRY__AABB_H__
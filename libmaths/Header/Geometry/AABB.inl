@@ -0,0 +1,188 @@
+#ifndef __LIBMATH__GEOMETRY__AABB_INL__
+#define __LIBMATH__GEOMETRY__AABB_INL__
+
+#include <limits>
+#include <type_traits>
+
+#include "AABB.h"
+#include "Arithmetic.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+	constexpr AABB::AABB(const Vector3& min, const Vector3& max) noexcept : m_min(min), m_max(max)
+	{
+	}
+
+	constexpr AABB AABB::fromCenterExtents(const Vector3& center, const Vector3& extents) noexcept
+	{
+		return { center - extents, center + extents };
+	}
+
+	constexpr AABB AABB::empty() noexcept
+	{
+		constexpr float infinity = std::numeric_limits<float>::infinity();
+		return { Vector3(infinity), Vector3(-infinity) };
+	}
+
+	constexpr Vector3 AABB::center() const noexcept
+	{
+		return (m_min + m_max) * .5f;
+	}
+
+	constexpr Vector3 AABB::extents() const noexcept
+	{
+		return (m_max - m_min) * .5f;
+	}
+
+	constexpr Vector3 AABB::size() const noexcept
+	{
+		return m_max - m_min;
+	}
+
+	constexpr float AABB::surfaceArea() const noexcept
+	{
+		const Vector3 size = this->size();
+		return 2.f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+	}
+
+	constexpr bool AABB::isEmpty() const noexcept
+	{
+		return m_min.m_x > m_max.m_x || m_min.m_y > m_max.m_y || m_min.m_z > m_max.m_z;
+	}
+
+	constexpr bool AABB::contains(const Vector3& point) const noexcept
+	{
+		// Non short-circuiting operators keep the test branchless
+		return (m_min.m_x <= point.m_x) & (point.m_x <= m_max.m_x)
+			& (m_min.m_y <= point.m_y) & (point.m_y <= m_max.m_y)
+			& (m_min.m_z <= point.m_z) & (point.m_z <= m_max.m_z);
+	}
+
+	constexpr bool AABB::contains(const AABB& other) const noexcept
+	{
+		return (m_min.m_x <= other.m_min.m_x) & (other.m_max.m_x <= m_max.m_x)
+			& (m_min.m_y <= other.m_min.m_y) & (other.m_max.m_y <= m_max.m_y)
+			& (m_min.m_z <= other.m_min.m_z) & (other.m_max.m_z <= m_max.m_z);
+	}
+
+	constexpr bool AABB::intersects(const AABB& other) const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			// Overlap on every axis <=> !(other.max < min || max < other.min) for the 3 axes at once
+			const __m128 separated = _mm_or_ps(
+				_mm_cmplt_ps(Simd::load3(&other.m_max.m_x), Simd::load3(&m_min.m_x)),
+				_mm_cmplt_ps(Simd::load3(&m_max.m_x), Simd::load3(&other.m_min.m_x)));
+
+			return (_mm_movemask_ps(separated) & 0x7) == 0;
+		}
+#endif
+
+		return (m_min.m_x <= other.m_max.m_x) & (other.m_min.m_x <= m_max.m_x)
+			& (m_min.m_y <= other.m_max.m_y) & (other.m_min.m_y <= m_max.m_y)
+			& (m_min.m_z <= other.m_max.m_z) & (other.m_min.m_z <= m_max.m_z);
+	}
+
+	constexpr bool AABB::raycast(const Vector3& origin, const Vector3& inverseDirection, float& outNear, float& outFar) const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			const __m128 rayOrigin = Simd::load3(&origin.m_x);
+			const __m128 inverse = Simd::load3(&inverseDirection.m_x);
+
+			const __m128 toMin = _mm_mul_ps(_mm_sub_ps(Simd::load3(&m_min.m_x), rayOrigin), inverse);
+			const __m128 toMax = _mm_mul_ps(_mm_sub_ps(Simd::load3(&m_max.m_x), rayOrigin), inverse);
+
+			// A ray lying in a face's plane gives 0 * inf = NaN on that axis. It touches the box, so that axis doesn't constrain it
+			const __m128 isInFacePlane = _mm_cmpunord_ps(toMin, toMax);
+			__m128 nearLanes = _mm_blendv_ps(_mm_min_ps(toMin, toMax), _mm_set1_ps(-std::numeric_limits<float>::infinity()), isInFacePlane);
+			__m128 farLanes = _mm_blendv_ps(_mm_max_ps(toMin, toMax), _mm_set1_ps(std::numeric_limits<float>::infinity()), isInFacePlane);
+
+			// Copy the x lane into the unused w lane so it doesn't take part in the horizontal min/max
+			nearLanes = _mm_shuffle_ps(nearLanes, nearLanes, _MM_SHUFFLE(0, 2, 1, 0));
+			farLanes = _mm_shuffle_ps(farLanes, farLanes, _MM_SHUFFLE(0, 2, 1, 0));
+
+			nearLanes = _mm_max_ps(nearLanes, _mm_movehl_ps(nearLanes, nearLanes));
+			farLanes = _mm_min_ps(farLanes, _mm_movehl_ps(farLanes, farLanes));
+
+			outNear = _mm_cvtss_f32(_mm_max_ss(nearLanes, _mm_shuffle_ps(nearLanes, nearLanes, _MM_SHUFFLE(1, 1, 1, 1))));
+			outFar = _mm_cvtss_f32(_mm_min_ss(farLanes, _mm_shuffle_ps(farLanes, farLanes, _MM_SHUFFLE(1, 1, 1, 1))));
+
+			return outFar >= 0.f && outNear <= outFar;
+		}
+#endif
+
+		// point = origin + t * direction <=> t = (point - origin) / direction
+		const Vector3 toMin = (m_min - origin) * inverseDirection;
+		const Vector3 toMax = (m_max - origin) * inverseDirection;
+
+		outNear = -std::numeric_limits<float>::infinity();
+		outFar = std::numeric_limits<float>::infinity();
+
+		for (int axis = 0; axis < 3; axis++)
+		{
+			// A ray lying in a face's plane gives 0 * inf = NaN on that axis. It touches the box, so that axis doesn't constrain it
+			if (toMin[axis] != toMin[axis] || toMax[axis] != toMax[axis])
+				continue;
+
+			outNear = max(outNear, min(toMin[axis], toMax[axis]));
+			outFar = min(outFar, max(toMin[axis], toMax[axis]));
+		}
+
+		return outFar >= 0.f && outNear <= outFar;
+	}
+
+	constexpr Vector3 AABB::closestPoint(const Vector3& point) const noexcept
+	{
+		return
+		{
+			max(m_min.m_x, min(point.m_x, m_max.m_x)),
+			max(m_min.m_y, min(point.m_y, m_max.m_y)),
+			max(m_min.m_z, min(point.m_z, m_max.m_z))
+		};
+	}
+
+	constexpr float AABB::distanceSquaredFrom(const Vector3& point) const noexcept
+	{
+		return point.distanceSquaredFrom(closestPoint(point));
+	}
+
+	constexpr void AABB::encapsulate(const Vector3& point) noexcept
+	{
+		m_min = { min(m_min.m_x, point.m_x), min(m_min.m_y, point.m_y), min(m_min.m_z, point.m_z) };
+		m_max = { max(m_max.m_x, point.m_x), max(m_max.m_y, point.m_y), max(m_max.m_z, point.m_z) };
+	}
+
+	constexpr void AABB::encapsulate(const AABB& other) noexcept
+	{
+		m_min = { min(m_min.m_x, other.m_min.m_x), min(m_min.m_y, other.m_min.m_y), min(m_min.m_z, other.m_min.m_z) };
+		m_max = { max(m_max.m_x, other.m_max.m_x), max(m_max.m_y, other.m_max.m_y), max(m_max.m_z, other.m_max.m_z) };
+	}
+
+	constexpr AABB AABB::merged(const AABB& other) const noexcept
+	{
+		AABB result = *this;
+		result.encapsulate(other);
+		return result;
+	}
+
+	constexpr AABB AABB::expanded(const Vector3& margin) const noexcept
+	{
+		return { m_min - margin, m_max + margin };
+	}
+
+	constexpr bool operator==(const AABB& lhs, const AABB& rhs) noexcept
+	{
+		return lhs.m_min == rhs.m_min && lhs.m_max == rhs.m_max;
+	}
+
+	constexpr bool operator!=(const AABB& lhs, const AABB& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+}
+
+#endif // !__LIBMATH__GEOMETRY__AABB_INL__
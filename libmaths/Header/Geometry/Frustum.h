@@ -0,0 +1,105 @@
+#ifndef __LIBMATH__GEOMETRY__FRUSTUM_H__
+#define __LIBMATH__GEOMETRY__FRUSTUM_H__
+
+#include <cstdint>
+
+#include "AABB.h"
+#include "Plane.h"
+#include "Sphere.h"
+#include "Matrix/Matrix4.h"
+
+namespace LibMath
+{
+	enum class EContainment
+	{
+		OUTSIDE,
+		INTERSECTS,
+		INSIDE
+	};
+
+	class Frustum
+	{
+	public:
+		static constexpr uint8_t PLANE_COUNT = 6;
+		static constexpr uint8_t ALL_PLANES = (1 << PLANE_COUNT) - 1;
+
+		/**
+		 * \brief Creates a frustum which contains everything
+		 */
+		Frustum() noexcept;
+
+		/**
+		 * \brief Extracts the frustum's planes from the given view projection matrix (Gribb & Hartmann).
+		 * The planes are stored in the left, right, bottom, top, near, far order and point inwards
+		 * \param viewProjection The view projection matrix, with an OpenGL style [-1, 1] clip depth
+		 */
+		explicit Frustum(const Matrix4& viewProjection) noexcept;
+
+		/**
+		 * \brief Gets the plane at the given index (left, right, bottom, top, near, far)
+		 * \param index The plane's index
+		 * \return The plane at the given index
+		 * \throw std::out_of_range if the index is greater than or equal to PLANE_COUNT
+		 */
+		const Plane&	getPlane(uint8_t index) const;
+
+		/**
+		 * \brief Checks whether the given point is inside the frustum
+		 * \param point The point to check
+		 * \return True if the point is inside the frustum. False otherwise
+		 */
+		bool			contains(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Checks whether the given sphere is at least partially inside the frustum. Conservative near the frustum's corners
+		 * \param sphere The sphere to check
+		 * \return True if the sphere might be visible. False if it is entirely outside
+		 */
+		bool			intersects(const Sphere& sphere) const noexcept;
+
+		/**
+		 * \brief Checks whether the given box is at least partially inside the frustum. Conservative near the frustum's corners
+		 * \param box The box to check
+		 * \return True if the box might be visible. False if it is entirely outside
+		 */
+		bool			intersects(const AABB& box) const noexcept;
+
+		/**
+		 * \brief Classifies the given box against the frustum, only testing the planes that can still reject it.
+		 * \param box The box to classify
+		 * \param planeMask The planes to test, one bit per plane (ALL_PLANES for a root).
+		 * Receives the planes the box straddles - the only ones its children need to test
+		 * \param lastPlane The plane that rejected the box last time, tested first since it most likely still does.
+		 * Receives the plane that rejected the box if it is outside
+		 * \return OUTSIDE if the box is entirely outside a plane, INSIDE if it is inside every tested plane, INTERSECTS otherwise
+		 */
+		EContainment	classify(const AABB& box, uint8_t& planeMask, uint8_t& lastPlane) const noexcept;
+
+	private:
+		// The planes are also stored as structure of arrays, padded to 8 lanes with planes accepting everything,
+		// so the intersection tests can check every plane at once
+		static constexpr uint8_t LANE_COUNT = 8;
+
+		Plane				m_planes[PLANE_COUNT];
+		alignas(32) float	m_normalsX[LANE_COUNT];
+		alignas(32) float	m_normalsY[LANE_COUNT];
+		alignas(32) float	m_normalsZ[LANE_COUNT];
+		alignas(32) float	m_distances[LANE_COUNT];
+
+		/**
+		 * \brief Copies the planes into the structure of arrays used by the intersection tests
+		 */
+		void updateLanes() noexcept;
+
+		/**
+		 * \brief Checks whether a box, grown by the given radius, is entirely behind any of the planes
+		 * \param center The box's center
+		 * \param extents The box's half size
+		 * \param radius The margin added around the box
+		 * \return True if the grown box is outside the frustum. False otherwise
+		 */
+		bool isOutside(const Vector3& center, const Vector3& extents, float radius) const noexcept;
+	};
+}
+
+#endif // !__LIBMATH__GEOMETRY__FRUSTUM_H__
@@ -0,0 +1,70 @@
+#ifndef __LIBMATH__GEOMETRY__OBB_H__
+#define __LIBMATH__GEOMETRY__OBB_H__
+
+#include "AABB.h"
+#include "Vector/Vector3.h"
+#include "Matrix/Matrix4.h"
+
+namespace LibMath
+{
+	class OBB
+	{
+	public:
+		constexpr OBB() noexcept = default;
+
+		/**
+		 * \brief Creates an oriented bounding box from its center, half size and local axes
+		 * \param center The box's center
+		 * \param extents The box's half size along each of its axes
+		 * \param axisX The box's local x axis. Must be a unit vector
+		 * \param axisY The box's local y axis. Must be a unit vector orthogonal to axisX
+		 * \param axisZ The box's local z axis. Must be a unit vector orthogonal to axisX and axisY
+		 */
+		constexpr OBB(const Vector3& center, const Vector3& extents, const Vector3& axisX, const Vector3& axisY, const Vector3& axisZ) noexcept;
+
+		/**
+		 * \brief Creates the oriented box matching the given axis aligned box once transformed by the given matrix.
+		 * The matrix must be affine, without shear nor null scale
+		 * \param box The box to transform
+		 * \param matrix The transformation matrix
+		 * \return The transformed box
+		 */
+		static constexpr OBB	fromTransformedAABB(const AABB& box, const Matrix4& matrix);
+
+		/**
+		 * \brief Checks whether the given point is inside the box (boundaries included)
+		 * \param point The point to check
+		 * \return True if the point is inside the box. False otherwise
+		 */
+		constexpr bool			contains(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Checks whether the given box overlaps with the current one with the separating axis theorem
+		 * (the 3 axes of each box and the 9 cross products of their axes)
+		 * \param other The box to check
+		 * \return True if the boxes overlap. False otherwise
+		 */
+		constexpr bool			intersects(const OBB& other) const noexcept;
+
+		/**
+		 * \brief Computes the point of the box (surface or inside) closest to the given point
+		 * \param point The point to project on the box
+		 * \return The closest point of the box
+		 */
+		constexpr Vector3		closestPoint(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Computes the axis aligned box enclosing the oriented box
+		 * \return The oriented box's bounds
+		 */
+		constexpr AABB			bounds() const noexcept;
+
+		Vector3 m_center;
+		Vector3 m_extents;
+		Vector3 m_axes[3] = { Vector3::right(), Vector3::up(), Vector3::front() };
+	};
+}
+
+#include "OBB.inl"
+
+#endif // !__LIBMATH__GEOMETRY__OBB_H__
@@ -0,0 +1,144 @@
+#ifndef __LIBMATH__GEOMETRY__OBB_INL__
+#define __LIBMATH__GEOMETRY__OBB_INL__
+
+#include <limits>
+
+#include "Arithmetic.h"
+#include "OBB.h"
+
+namespace LibMath
+{
+	constexpr OBB::OBB(const Vector3& center, const Vector3& extents, const Vector3& axisX, const Vector3& axisY,
+		const Vector3& axisZ) noexcept : m_center(center), m_extents(extents), m_axes{ axisX, axisY, axisZ }
+	{
+	}
+
+	constexpr OBB OBB::fromTransformedAABB(const AABB& box, const Matrix4& matrix)
+	{
+		const Vector3 center = box.center();
+		const Vector3 extents = box.extents();
+
+		// The upper 3x3 block's columns are the scaled local axes
+		const Vector3 columns[3] =
+		{
+			{ matrix(0, 0), matrix(1, 0), matrix(2, 0) },
+			{ matrix(0, 1), matrix(1, 1), matrix(2, 1) },
+			{ matrix(0, 2), matrix(1, 2), matrix(2, 2) }
+		};
+
+		const Vector3 scale(columns[0].magnitude(), columns[1].magnitude(), columns[2].magnitude());
+
+		const Vector3 worldCenter
+		{
+			matrix(0, 0) * center.m_x + matrix(0, 1) * center.m_y + matrix(0, 2) * center.m_z + matrix(0, 3),
+			matrix(1, 0) * center.m_x + matrix(1, 1) * center.m_y + matrix(1, 2) * center.m_z + matrix(1, 3),
+			matrix(2, 0) * center.m_x + matrix(2, 1) * center.m_y + matrix(2, 2) * center.m_z + matrix(2, 3)
+		};
+
+		return
+		{
+			worldCenter, extents * scale,
+			columns[0] / scale.m_x, columns[1] / scale.m_y, columns[2] / scale.m_z
+		};
+	}
+
+	constexpr bool OBB::contains(const Vector3& point) const noexcept
+	{
+		const Vector3 offset = point - m_center;
+
+		return (abs(offset.dot(m_axes[0])) <= m_extents.m_x)
+			& (abs(offset.dot(m_axes[1])) <= m_extents.m_y)
+			& (abs(offset.dot(m_axes[2])) <= m_extents.m_z);
+	}
+
+	constexpr bool OBB::intersects(const OBB& other) const noexcept
+	{
+		// Separating axis test from Ericson's Real-Time Collision Detection (4.4.1), done in the current box's space
+		const float extents[3] = { m_extents.m_x, m_extents.m_y, m_extents.m_z };
+		const float otherExtents[3] = { other.m_extents.m_x, other.m_extents.m_y, other.m_extents.m_z };
+
+		// The epsilon prevents near parallel edges from producing a null cross product that separates everything
+		constexpr float epsilon = std::numeric_limits<float>::epsilon() * 16.f;
+
+		float rotation[3][3] = {};
+		float absRotation[3][3] = {};
+
+		for (int i = 0; i < 3; i++)
+		{
+			for (int j = 0; j < 3; j++)
+			{
+				rotation[i][j] = m_axes[i].dot(other.m_axes[j]);
+				absRotation[i][j] = abs(rotation[i][j]) + epsilon;
+			}
+		}
+
+		const Vector3 offset = other.m_center - m_center;
+		const float translation[3] = { offset.dot(m_axes[0]), offset.dot(m_axes[1]), offset.dot(m_axes[2]) };
+
+		// Current box's axes
+		for (int i = 0; i < 3; i++)
+		{
+			const float otherRadius = otherExtents[0] * absRotation[i][0] + otherExtents[1] * absRotation[i][1]
+				+ otherExtents[2] * absRotation[i][2];
+
+			if (abs(translation[i]) > extents[i] + otherRadius)
+				return false;
+		}
+
+		// Other box's axes
+		for (int j = 0; j < 3; j++)
+		{
+			const float radius = extents[0] * absRotation[0][j] + extents[1] * absRotation[1][j] + extents[2] * absRotation[2][j];
+			const float distance = translation[0] * rotation[0][j] + translation[1] * rotation[1][j] + translation[2] * rotation[2][j];
+
+			if (abs(distance) > radius + otherExtents[j])
+				return false;
+		}
+
+		// Cross products of an axis of each box
+		for (int i = 0; i < 3; i++)
+		{
+			const int i1 = (i + 1) % 3;
+			const int i2 = (i + 2) % 3;
+
+			for (int j = 0; j < 3; j++)
+			{
+				const int j1 = (j + 1) % 3;
+				const int j2 = (j + 2) % 3;
+
+				const float radius = extents[i1] * absRotation[i2][j] + extents[i2] * absRotation[i1][j];
+				const float otherRadius = otherExtents[j1] * absRotation[i][j2] + otherExtents[j2] * absRotation[i][j1];
+				const float distance = translation[i2] * rotation[i1][j] - translation[i1] * rotation[i2][j];
+
+				if (abs(distance) > radius + otherRadius)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	constexpr Vector3 OBB::closestPoint(const Vector3& point) const noexcept
+	{
+		const Vector3 offset = point - m_center;
+
+		return m_center
+			+ m_axes[0] * clamp(offset.dot(m_axes[0]), -m_extents.m_x, m_extents.m_x)
+			+ m_axes[1] * clamp(offset.dot(m_axes[1]), -m_extents.m_y, m_extents.m_y)
+			+ m_axes[2] * clamp(offset.dot(m_axes[2]), -m_extents.m_z, m_extents.m_z);
+	}
+
+	constexpr AABB OBB::bounds() const noexcept
+	{
+		const Vector3 worldExtents
+		{
+			abs(m_axes[0].m_x) * m_extents.m_x + abs(m_axes[1].m_x) * m_extents.m_y + abs(m_axes[2].m_x) * m_extents.m_z,
+			abs(m_axes[0].m_y) * m_extents.m_x + abs(m_axes[1].m_y) * m_extents.m_y + abs(m_axes[2].m_y) * m_extents.m_z,
+			abs(m_axes[0].m_z) * m_extents.m_x + abs(m_axes[1].m_z) * m_extents.m_y + abs(m_axes[2].m_z) * m_extents.m_z
+		};
+
+		return AABB::fromCenterExtents(m_center, worldExtents);
+	}
+}
+
+#endif // !__LIBMATH__GEOMETRY__OBB_INL__
@@ -0,0 +1,57 @@
+#ifndef __LIBMATH__GEOMETRY__PLANE_H__
+#define __LIBMATH__GEOMETRY__PLANE_H__
+
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+	// A plane is the set of points p for which m_normal.dot(p) + m_distance == 0.
+	// The normal points towards the positive half-space
+	class Plane
+	{
+	public:
+		constexpr Plane() noexcept = default;
+
+		/**
+		 * \brief Creates a plane from its normal and its signed distance to the origin
+		 * \param normal The plane's normal
+		 * \param distance The plane's offset (-normal.dot(pointOnPlane))
+		 */
+		constexpr Plane(const Vector3& normal, float distance) noexcept;
+
+		/**
+		 * \brief Creates the plane going through the given point with the given normal
+		 * \param point A point on the plane
+		 * \param normal The plane's normal
+		 * \return The created plane
+		 */
+		static constexpr Plane	fromPointNormal(const Vector3& point, const Vector3& normal) noexcept;
+
+		/**
+		 * \brief Creates the plane going through the 3 given points. Its normal follows the counter-clockwise winding
+		 * \return The created plane, with a unit normal
+		 */
+		static constexpr Plane	fromPoints(const Vector3& a, const Vector3& b, const Vector3& c) noexcept;
+
+		/**
+		 * \brief Computes the signed distance between the plane and the given point.
+		 * Only a true distance if the plane's normal is a unit vector
+		 * \param point The point whose distance to the plane should be computed
+		 * \return The signed distance between the point and the plane. Positive on the normal's side
+		 */
+		constexpr float			signedDistance(const Vector3& point) const noexcept;
+
+		constexpr void			normalize() noexcept;					// scale the plane so its normal is a unit vector
+		constexpr Plane			normalized() const noexcept;			// return a copy of the plane with a unit normal
+
+		Vector3	m_normal;
+		float	m_distance = 0.f;
+	};
+
+	constexpr bool operator==(const Plane&, const Plane&) noexcept;
+	constexpr bool operator!=(const Plane&, const Plane&) noexcept;
+}
+
+#include "Plane.inl"
+
+#endif // !__LIBMATH__GEOMETRY__PLANE_H__
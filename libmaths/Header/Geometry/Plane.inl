@@ -0,0 +1,54 @@
+#ifndef __LIBMATH__GEOMETRY__PLANE_INL__
+#define __LIBMATH__GEOMETRY__PLANE_INL__
+
+#include "Arithmetic.h"
+#include "Plane.h"
+
+namespace LibMath
+{
+	constexpr Plane::Plane(const Vector3& normal, const float distance) noexcept : m_normal(normal), m_distance(distance)
+	{
+	}
+
+	constexpr Plane Plane::fromPointNormal(const Vector3& point, const Vector3& normal) noexcept
+	{
+		return { normal, -normal.dot(point) };
+	}
+
+	constexpr Plane Plane::fromPoints(const Vector3& a, const Vector3& b, const Vector3& c) noexcept
+	{
+		return fromPointNormal(a, (b - a).cross(c - a).normalized());
+	}
+
+	constexpr float Plane::signedDistance(const Vector3& point) const noexcept
+	{
+		return m_normal.dot(point) + m_distance;
+	}
+
+	constexpr void Plane::normalize() noexcept
+	{
+		const float invLength = 1.f / m_normal.magnitude();
+
+		m_normal *= invLength;
+		m_distance *= invLength;
+	}
+
+	constexpr Plane Plane::normalized() const noexcept
+	{
+		Plane plane = *this;
+		plane.normalize();
+		return plane;
+	}
+
+	constexpr bool operator==(const Plane& lhs, const Plane& rhs) noexcept
+	{
+		return lhs.m_normal == rhs.m_normal && floatEquals(lhs.m_distance, rhs.m_distance);
+	}
+
+	constexpr bool operator!=(const Plane& lhs, const Plane& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+}
+
+#endif // !__LIBMATH__GEOMETRY__PLANE_INL__
@@ -0,0 +1,55 @@
+#ifndef __LIBMATH__GEOMETRY__SPHERE_H__
+#define __LIBMATH__GEOMETRY__SPHERE_H__
+
+#include "AABB.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+	class Sphere
+	{
+	public:
+		constexpr Sphere() noexcept = default;
+
+		/**
+		 * \brief Creates a sphere from its center and radius
+		 * \param center The sphere's center
+		 * \param radius The sphere's radius
+		 */
+		constexpr Sphere(const Vector3& center, float radius) noexcept;
+
+		/**
+		 * \brief Checks whether the given point is inside the sphere (boundary included)
+		 * \param point The point to check
+		 * \return True if the point is inside the sphere. False otherwise
+		 */
+		constexpr bool	contains(const Vector3& point) const noexcept;
+
+		/**
+		 * \brief Checks whether the given sphere overlaps with the current one
+		 * \param other The sphere to check
+		 * \return True if the spheres overlap. False otherwise
+		 */
+		constexpr bool	intersects(const Sphere& other) const noexcept;
+
+		/**
+		 * \brief Checks whether the given box overlaps with the sphere
+		 * \param box The box to check
+		 * \return True if the box and the sphere overlap. False otherwise
+		 */
+		constexpr bool	intersects(const AABB& box) const noexcept;
+
+		/**
+		 * \brief Computes the axis aligned box enclosing the sphere
+		 * \return The sphere's bounds
+		 */
+		constexpr AABB	bounds() const noexcept;
+
+		Vector3	m_center;
+		float	m_radius = 0.f;
+	};
+}
+
+#include "Sphere.inl"
+
+#endif // !__LIBMATH__GEOMETRY__SPHERE_H__
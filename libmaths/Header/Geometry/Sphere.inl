@@ -0,0 +1,34 @@
+#ifndef __LIBMATH__GEOMETRY__SPHERE_INL__
+#define __LIBMATH__GEOMETRY__SPHERE_INL__
+
+#include "Sphere.h"
+
+namespace LibMath
+{
+	constexpr Sphere::Sphere(const Vector3& center, const float radius) noexcept : m_center(center), m_radius(radius)
+	{
+	}
+
+	constexpr bool Sphere::contains(const Vector3& point) const noexcept
+	{
+		return m_center.distanceSquaredFrom(point) <= m_radius * m_radius;
+	}
+
+	constexpr bool Sphere::intersects(const Sphere& other) const noexcept
+	{
+		const float totalRadius = m_radius + other.m_radius;
+		return m_center.distanceSquaredFrom(other.m_center) <= totalRadius * totalRadius;
+	}
+
+	constexpr bool Sphere::intersects(const AABB& box) const noexcept
+	{
+		return box.distanceSquaredFrom(m_center) <= m_radius * m_radius;
+	}
+
+	constexpr AABB Sphere::bounds() const noexcept
+	{
+		return AABB::fromCenterExtents(m_center, Vector3(m_radius));
+	}
+}
+
+#endif // !__LIBMATH__GEOMETRY__SPHERE_INL__
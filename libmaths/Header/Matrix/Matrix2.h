@@ -5,37 +5,28 @@
 
 namespace LibMath
 {
-	class Matrix2x2 : public Matrix
+	class Matrix2x2 : public Matrix<2, 2>
 	{
 	public:
-					Matrix2x2(length_t, length_t) = delete;
-					Matrix2x2(length_t, length_t, float) = delete;
-					Matrix2x2();
-		explicit	Matrix2x2(float scalar);
-					Matrix2x2(const Matrix& other);
-					Matrix2x2(Matrix&& other);
+		constexpr			Matrix2x2() noexcept = default;
+		explicit constexpr	Matrix2x2(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix2x2(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix2x3 : public Matrix
+	class Matrix2x3 : public Matrix<2, 3>
 	{
 	public:
-					Matrix2x3(length_t, length_t) = delete;
-					Matrix2x3(length_t, length_t, float) = delete;
-					Matrix2x3();
-		explicit	Matrix2x3(float scalar);
-					Matrix2x3(const Matrix& other);
-					Matrix2x3(Matrix&& other);
+		constexpr			Matrix2x3() noexcept = default;
+		explicit constexpr	Matrix2x3(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix2x3(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix2x4 : public Matrix
+	class Matrix2x4 : public Matrix<2, 4>
 	{
 	public:
-					Matrix2x4(length_t, length_t) = delete;
-					Matrix2x4(length_t, length_t, float) = delete;
-					Matrix2x4();
-		explicit	Matrix2x4(float scalar);
-					Matrix2x4(const Matrix& other);
-					Matrix2x4(Matrix&& other);
+		constexpr			Matrix2x4() noexcept = default;
+		explicit constexpr	Matrix2x4(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix2x4(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
 	typedef Matrix2x2 Matrix2;
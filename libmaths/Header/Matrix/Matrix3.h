@@ -5,37 +5,28 @@
 
 namespace LibMath
 {
-	class Matrix3x2 : public Matrix
+	class Matrix3x2 : public Matrix<3, 2>
 	{
 	public:
-					Matrix3x2(length_t, length_t) = delete;
-					Matrix3x2(length_t, length_t, float) = delete;
-					Matrix3x2();
-		explicit	Matrix3x2(float scalar);
-					Matrix3x2(const Matrix& other);
-					Matrix3x2(Matrix&& other);
+		constexpr			Matrix3x2() noexcept = default;
+		explicit constexpr	Matrix3x2(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix3x2(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix3x3 : public Matrix
+	class Matrix3x3 : public Matrix<3, 3>
 	{
 	public:
-					Matrix3x3(length_t, length_t) = delete;
-					Matrix3x3(length_t, length_t, float) = delete;
-					Matrix3x3();
-		explicit	Matrix3x3(float scalar);
-					Matrix3x3(const Matrix& other);
-					Matrix3x3(Matrix&& other);
+		constexpr			Matrix3x3() noexcept = default;
+		explicit constexpr	Matrix3x3(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix3x3(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix3x4 : public Matrix
+	class Matrix3x4 : public Matrix<3, 4>
 	{
 	public:
-					Matrix3x4(length_t, length_t) = delete;
-					Matrix3x4(length_t, length_t, float) = delete;
-					Matrix3x4();
-		explicit	Matrix3x4(float scalar);
-					Matrix3x4(const Matrix& other);
-					Matrix3x4(Matrix&& other);
+		constexpr			Matrix3x4() noexcept = default;
+		explicit constexpr	Matrix3x4(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix3x4(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
 	typedef Matrix3x3 Matrix3;
@@ -8,56 +8,62 @@ namespace LibMath
 	class Radian;
 	class Vector3;
 
-	class Matrix4x2 : public Matrix
+	class Matrix4x2 : public Matrix<4, 2>
 	{
 	public:
-							Matrix4x2(length_t, length_t) = delete;
-							Matrix4x2(length_t, length_t, float) = delete;
-							Matrix4x2();
-		explicit			Matrix4x2(float scalar);
-							Matrix4x2(const Matrix& other);
-							Matrix4x2(Matrix&& other);
+		constexpr			Matrix4x2() noexcept = default;
+		explicit constexpr	Matrix4x2(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix4x2(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix4x3 : public Matrix
+	class Matrix4x3 : public Matrix<4, 3>
 	{
 	public:
-							Matrix4x3(length_t, length_t) = delete;
-							Matrix4x3(length_t, length_t, float) = delete;
-							Matrix4x3();
-		explicit			Matrix4x3(float scalar);
-							Matrix4x3(const Matrix& other);
-							Matrix4x3(Matrix&& other);
+		constexpr			Matrix4x3() noexcept = default;
+		explicit constexpr	Matrix4x3(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix4x3(const Matrix& other) noexcept : Matrix(other) {}
 	};
 
-	class Matrix4x4 : public Matrix
+	class Matrix4x4 : public Matrix<4, 4>
 	{
 	public:
-							Matrix4x4(length_t, length_t) = delete;
-							Matrix4x4(length_t, length_t, float) = delete;
-							Matrix4x4();
-		explicit			Matrix4x4(float scalar);
-							Matrix4x4(const Matrix& other);
-							Matrix4x4(Matrix&& other);
+		constexpr			Matrix4x4() noexcept = default;
+		explicit constexpr	Matrix4x4(const float scalar) noexcept : Matrix(scalar) {}
+		constexpr			Matrix4x4(const Matrix& other) noexcept : Matrix(other) {}
 
-		static Matrix4x4	translation(float x, float y, float z);
-		static Matrix4x4	translation(const Vector3& translation);
-		static Matrix4x4	scaling(float x, float y, float z);
-		static Matrix4x4	scaling(const Vector3& scale);
-		static Matrix4x4	rotation(const Radian& angle, const Vector3& axis);
-		static Matrix4x4	rotation(const Radian& yaw, const Radian& pitch, const Radian& roll);
-		static Matrix4x4	rotation(const Vector3& angles, bool isRadian);
-		static Matrix4x4	rotationEuler(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle);
-		static Matrix4x4	rotationEuler(const Vector3& angles, bool isRadian);
-		static Matrix4x4	rotationFromTo(const Vector3& from, const Vector3& to);
-		static Matrix4x4	orthographicProjection(float left, float right, float bottom, float top, float near, float far);
-		static Matrix4x4	perspectiveProjection(const Radian& fovY, float aspect, float near, float far);
-		static Matrix4x4	lookAt(const Vector3& eye, const Vector3& center, const Vector3& up);
+		/**
+		 * \brief Computes the inverse of an affine (translation, rotation, scale) matrix.
+		 * Only the upper 3x3 block is inverted, the translation is then transformed back.
+		 * \return The inverse of the current matrix, assuming its last row is (0, 0, 0, 1)
+		 */
+		constexpr Matrix4x4				inverseAffine() const;
+
+		/**
+		 * \brief Computes the matrix to use to transform normals for an affine matrix
+		 * \return The transposed inverse of the current matrix's upper 3x3 block
+		 */
+		constexpr Matrix4x4				normalMatrix() const;
+
+		static constexpr Matrix4x4		translation(float x, float y, float z) noexcept;
+		static constexpr Matrix4x4		translation(const Vector3& translation) noexcept;
+		static constexpr Matrix4x4		scaling(float x, float y, float z) noexcept;
+		static constexpr Matrix4x4		scaling(const Vector3& scale) noexcept;
+		static Matrix4x4				rotation(const Radian& angle, const Vector3& axis);
+		static Matrix4x4				rotation(const Radian& yaw, const Radian& pitch, const Radian& roll);
+		static Matrix4x4				rotation(const Vector3& angles, bool isRadian);
+		static Matrix4x4				rotationEuler(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle);
+		static Matrix4x4				rotationEuler(const Vector3& angles, bool isRadian);
+		static Matrix4x4				rotationFromTo(const Vector3& from, const Vector3& to);
+		static constexpr Matrix4x4		orthographicProjection(float left, float right, float bottom, float top, float near, float far) noexcept;
+		static Matrix4x4				perspectiveProjection(const Radian& fovY, float aspect, float near, float far);
+		static constexpr Matrix4x4		lookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept;
 	};
 
 	typedef Matrix4x4 Matrix4;
 }
 
+#include "Matrix4.inl"
+
 #ifdef __LIBMATH__VECTOR__VECTOR4_H__
 #include "Matrix4Vector4Operation.h"
 #endif // __LIBMATH__MATRIX_H__
@@ -0,0 +1,148 @@
+#ifndef __LIBMATH__MATRIX__MATRIX4_INL__
+#define __LIBMATH__MATRIX__MATRIX4_INL__
+
+#include <utility>
+
+#include "Matrix4.h"
+#include "Vector/Vector3.h"
+
+namespace LibMath
+{
+	constexpr Matrix4x4 Matrix4x4::inverseAffine() const
+	{
+		const float* m = m_values;
+
+		// Cofactors of the upper 3x3 block
+		const float c00 = m[5] * m[10] - m[6] * m[9];
+		const float c01 = m[6] * m[8] - m[4] * m[10];
+		const float c02 = m[4] * m[9] - m[5] * m[8];
+
+		const float det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+
+		if (det == 0.f)
+			throw Exceptions::NonInvertibleMatrix();
+
+		const float invDet = 1.f / det;
+
+		Matrix4x4 inverse;
+		float* out = inverse.m_values;
+
+		out[0] = c00 * invDet;
+		out[1] = (m[2] * m[9] - m[1] * m[10]) * invDet;
+		out[2] = (m[1] * m[6] - m[2] * m[5]) * invDet;
+
+		out[4] = c01 * invDet;
+		out[5] = (m[0] * m[10] - m[2] * m[8]) * invDet;
+		out[6] = (m[2] * m[4] - m[0] * m[6]) * invDet;
+
+		out[8] = c02 * invDet;
+		out[9] = (m[1] * m[8] - m[0] * m[9]) * invDet;
+		out[10] = (m[0] * m[5] - m[1] * m[4]) * invDet;
+
+		// The inverse translation is the original one transformed by the inverted 3x3 block
+		out[3] = -(out[0] * m[3] + out[1] * m[7] + out[2] * m[11]);
+		out[7] = -(out[4] * m[3] + out[5] * m[7] + out[6] * m[11]);
+		out[11] = -(out[8] * m[3] + out[9] * m[7] + out[10] * m[11]);
+
+		out[15] = 1.f;
+
+		return inverse;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::normalMatrix() const
+	{
+		Matrix4x4 normalMat = inverseAffine();
+		float* out = normalMat.m_values;
+
+		// Transpose the upper 3x3 block and drop the translation
+		std::swap(out[1], out[4]);
+		std::swap(out[2], out[8]);
+		std::swap(out[6], out[9]);
+
+		out[3] = out[7] = out[11] = 0.f;
+
+		return normalMat;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::translation(const float x, const float y, const float z) noexcept
+	{
+		Matrix4x4 translationMatrix(1.f);
+
+		translationMatrix(0, 3) = x;
+		translationMatrix(1, 3) = y;
+		translationMatrix(2, 3) = z;
+
+		return translationMatrix;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::translation(const Vector3& translation) noexcept
+	{
+		return Matrix4x4::translation(translation.m_x, translation.m_y, translation.m_z);
+	}
+
+	constexpr Matrix4x4 Matrix4x4::scaling(const float x, const float y, const float z) noexcept
+	{
+		Matrix4x4 scalingMatrix;
+
+		scalingMatrix(0, 0) = x;
+		scalingMatrix(1, 1) = y;
+		scalingMatrix(2, 2) = z;
+		scalingMatrix(3, 3) = 1.f;
+
+		return scalingMatrix;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::scaling(const Vector3& scale) noexcept
+	{
+		return scaling(scale.m_x, scale.m_y, scale.m_z);
+	}
+
+	constexpr Matrix4x4 Matrix4x4::orthographicProjection(const float left, const float right,
+		const float bottom, const float top, const float near, const float far) noexcept
+	{
+		Matrix4x4 mat;
+
+		mat(0, 0) = 2.f / (right - left);
+		mat(0, 3) = (right + left) / (left - right);
+
+		mat(1, 1) = 2.f / (top - bottom);
+		mat(1, 3) = (top + bottom) / (bottom - top);
+
+		mat(2, 2) = 2.f / (near - far);
+		mat(2, 3) = (far + near) / (near - far);
+
+		mat(3, 3) = 1.f;
+
+		return mat;
+	}
+
+	constexpr Matrix4x4 Matrix4x4::lookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept
+	{
+		const Vector3 f = (center - eye).normalized();
+		const Vector3 s = f.cross(up).normalized();
+		const Vector3 u = s.cross(f);
+
+		Matrix4x4 mat;
+
+		mat(0, 0) = s.m_x;
+		mat(0, 1) = s.m_y;
+		mat(0, 2) = s.m_z;
+		mat(0, 3) = -s.dot(eye);
+
+		mat(1, 0) = u.m_x;
+		mat(1, 1) = u.m_y;
+		mat(1, 2) = u.m_z;
+		mat(1, 3) = -u.dot(eye);
+
+		mat(2, 0) = -f.m_x;
+		mat(2, 1) = -f.m_y;
+		mat(2, 2) = -f.m_z;
+		mat(2, 3) = f.dot(eye);
+
+		mat(3, 3) = 1.f;
+
+		return mat;
+	}
+}
+
+#endif // !__LIBMATH__MATRIX__MATRIX4_INL__
@@ -1,5 +1,6 @@
 #ifndef __LIBMATH__MATRIX_MATRIXINTERNAL_H__
 #define __LIBMATH__MATRIX_MATRIXINTERNAL_H__
+#include <cstddef>
 #include <exception>
 
 namespace LibMath
@@ -9,100 +10,115 @@ namespace LibMath
 		class IncompatibleMatrix : public std::exception
 		{
 		public:
-			IncompatibleMatrix() noexcept
-				: exception("Incompatible matrix")
+			const char* what() const noexcept override
 			{
+				return "Incompatible matrix";
 			}
 		};
 
 		class NonSquareMatrix : public std::exception
 		{
 		public:
-			NonSquareMatrix() noexcept
-				: exception("Non-square matrix")
+			const char* what() const noexcept override
 			{
+				return "Non-square matrix";
 			}
 		};
 
 		class NonInvertibleMatrix : public std::exception
 		{
 		public:
-			NonInvertibleMatrix() noexcept
-				: exception("Non-invertible matrix")
+			const char* what() const noexcept override
 			{
+				return "Non-invertible matrix";
 			}
 		};
 	}
 
+	/**
+	 * \brief A fixed-size, row-major matrix whose values are stored inline
+	 * \tparam Rows The matrix's number of rows
+	 * \tparam Columns The matrix's number of columns
+	 */
+	template <int Rows, int Columns>
 	class Matrix
 	{
+		static_assert(Rows > 0 && Columns > 0, "Invalid matrix size");
+
+		template <int OtherRows, int OtherColumns>
+		friend class Matrix;
+
 	public:
-		using			length_t = int;
+		using							length_t = int;
 
-						Matrix(length_t rows, length_t columns);
-						Matrix(length_t rows, length_t columns, float scalar);
-						Matrix(Matrix const& other);
-						Matrix(Matrix&& other) noexcept;
-		virtual			~Matrix();
+		constexpr						Matrix() noexcept = default;
+		explicit constexpr				Matrix(float scalar) noexcept;
+		constexpr						Matrix(Matrix const& other) = default;
+		constexpr						Matrix(Matrix&& other) noexcept = default;
+		constexpr						~Matrix() = default;
 
-		Matrix&			operator=(Matrix const& other);
-		Matrix&			operator=(Matrix&& other) noexcept;
+		constexpr Matrix&				operator=(Matrix const& other) = default;
+		constexpr Matrix&				operator=(Matrix&& other) noexcept = default;
 
-		float			operator[](size_t index) const;
-		float&			operator[](size_t index);
+		constexpr float					operator[](size_t index) const;
+		constexpr float&				operator[](size_t index);
 
-		float			operator()(length_t row, length_t column) const;
-		float&			operator()(length_t row, length_t column);
+		constexpr float					operator()(length_t row, length_t column) const;
+		constexpr float&				operator()(length_t row, length_t column);
 
-		Matrix&			operator+=(Matrix const& other);
-		Matrix&			operator-=(Matrix const& other);
-		Matrix&			operator*=(Matrix const& other);
-		Matrix&			operator/=(Matrix const& other);
+		constexpr Matrix&				operator+=(Matrix const& other) noexcept;
+		constexpr Matrix&				operator-=(Matrix const& other) noexcept;
+		constexpr Matrix&				operator*=(Matrix<Columns, Columns> const& other) noexcept;
+		constexpr Matrix&				operator/=(Matrix<Columns, Columns> const& other);
 
-		Matrix&			operator+=(float scalar);
-		Matrix&			operator-=(float scalar);
-		Matrix&			operator*=(float scalar);
-		Matrix&			operator/=(float scalar);
+		constexpr Matrix&				operator+=(float scalar) noexcept;
+		constexpr Matrix&				operator-=(float scalar) noexcept;
+		constexpr Matrix&				operator*=(float scalar) noexcept;
+		constexpr Matrix&				operator/=(float scalar) noexcept;
 
-		Matrix			operator+(Matrix const& other) const;
-		Matrix			operator-(Matrix const& other) const;
-		Matrix			operator*(Matrix const& other) const;
-		Matrix			operator/(Matrix const& other) const;
+		constexpr Matrix				operator+(Matrix const& other) const noexcept;
+		constexpr Matrix				operator-(Matrix const& other) const noexcept;
 
-		Matrix			operator+(float scalar) const;
-		Matrix			operator-(float scalar) const;
-		Matrix			operator*(float scalar) const;
-		Matrix			operator/(float scalar) const;
+		template <int OtherColumns>
+		constexpr Matrix<Rows, OtherColumns>	operator*(Matrix<Columns, OtherColumns> const& other) const noexcept;
 
-		Matrix			operator-() const;
+		constexpr Matrix				operator/(Matrix<Columns, Columns> const& other) const;
 
-		bool			operator==(const Matrix& other) const;
-		bool			operator!=(const Matrix& other) const;
-		bool			isIdentity() const;
+		constexpr Matrix				operator+(float scalar) const noexcept;
+		constexpr Matrix				operator-(float scalar) const noexcept;
+		constexpr Matrix				operator*(float scalar) const noexcept;
+		constexpr Matrix				operator/(float scalar) const noexcept;
 
-		length_t		getRowCount() const;
-		length_t		getColumnCount() const;
-		length_t		getIndex(length_t row, length_t column) const;
-		float*			getArray();
-		const float*	getArray() const;
+		constexpr Matrix				operator-() const noexcept;
 
-		float			determinant() const;
-		float			cofactor(length_t row, length_t column) const;
+		constexpr bool					operator==(const Matrix& other) const noexcept;
+		constexpr bool					operator!=(const Matrix& other) const noexcept;
+		constexpr bool					isIdentity() const noexcept;
 
-		Matrix			minor(length_t row, length_t column) const;
-		Matrix			transposed() const;
-		Matrix			coMatrix() const;
-		Matrix			adjugate() const;
-		Matrix			inverse() const;
+		constexpr length_t				getRowCount() const noexcept;
+		constexpr length_t				getColumnCount() const noexcept;
+		constexpr length_t				getIndex(length_t row, length_t column) const;
+		constexpr float*				getArray() noexcept;
+		constexpr const float*			getArray() const noexcept;
 
-	protected:
-		float			determinant2x2() const;
-		float			determinant3x3() const;
+		constexpr float					determinant() const noexcept requires (Rows == Columns);
+		constexpr float					cofactor(length_t row, length_t column) const noexcept requires (Rows == Columns);
+
+		constexpr Matrix<Rows - 1, Columns - 1>	minor(length_t row, length_t column) const noexcept requires (Rows > 1 && Columns > 1);
 
-		length_t		m_rows;
-		length_t		m_columns;
-		float*			m_values;
+		constexpr Matrix<Columns, Rows>			transposed() const noexcept;
+
+		constexpr Matrix				coMatrix() const noexcept requires (Rows == Columns);
+		constexpr Matrix				adjugate() const noexcept requires (Rows == Columns);
+		constexpr Matrix				inverse() const requires (Rows == Columns);
+
+	protected:
+		// Matrices with 4 columns keep their rows 16 bytes aligned for the SIMD backend
+		alignas((Columns % 4 == 0) ? 16 : alignof(float))
+		float			m_values[Rows * Columns]{};
 	};
 }
 
-#endif // !__LIBMATH__MATRIX_MATRIXINTERNAL_H__
\ No newline at end of file
+#include "MatrixInternal.inl"
+
+#endif // !__LIBMATH__MATRIX_MATRIXINTERNAL_H__
@@ -0,0 +1,459 @@
+#ifndef __LIBMATH__MATRIX_MATRIXINTERNAL_INL__
+#define __LIBMATH__MATRIX_MATRIXINTERNAL_INL__
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "MatrixInternal.h"
+#include "Arithmetic.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>::Matrix(const float scalar) noexcept
+	{
+		// Builds a diagonal matrix with the given scalar
+		for (length_t i = 0; i < Rows && i < Columns; i++)
+			m_values[i * Columns + i] = scalar;
+	}
+
+	template <int Rows, int Columns>
+	constexpr float Matrix<Rows, Columns>::operator[](const size_t index) const
+	{
+		if (index >= static_cast<size_t>(Rows * Columns))
+			throw std::out_of_range("Index out of range");
+
+		return m_values[index];
+	}
+
+	template <int Rows, int Columns>
+	constexpr float& Matrix<Rows, Columns>::operator[](const size_t index)
+	{
+		if (index >= static_cast<size_t>(Rows * Columns))
+			throw std::out_of_range("Index out of range");
+
+		return m_values[index];
+	}
+
+	template <int Rows, int Columns>
+	constexpr float Matrix<Rows, Columns>::operator()(const length_t row, const length_t column) const
+	{
+		return m_values[getIndex(row, column)];
+	}
+
+	template <int Rows, int Columns>
+	constexpr float& Matrix<Rows, Columns>::operator()(const length_t row, const length_t column)
+	{
+		return m_values[getIndex(row, column)];
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator+=(const Matrix& other) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] += other.m_values[i];
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator-=(const Matrix& other) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] -= other.m_values[i];
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator*=(const Matrix<Columns, Columns>& other) noexcept
+	{
+		return (*this = *this * other);
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator/=(const Matrix<Columns, Columns>& other)
+	{
+		return (*this = *this / other);
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator+=(const float scalar) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] += scalar;
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator-=(const float scalar) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] -= scalar;
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator*=(const float scalar) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] *= scalar;
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns>& Matrix<Rows, Columns>::operator/=(const float scalar) noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			m_values[i] /= scalar;
+
+		return *this;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator+(const Matrix& other) const noexcept
+	{
+		Matrix mat = *this;
+		return mat += other;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator-(const Matrix& other) const noexcept
+	{
+		Matrix mat = *this;
+		return mat -= other;
+	}
+
+	template <int Rows, int Columns>
+	template <int OtherColumns>
+	constexpr Matrix<Rows, OtherColumns> Matrix<Rows, Columns>::operator*(const Matrix<Columns, OtherColumns>& other) const noexcept
+	{
+		Matrix<Rows, OtherColumns> result;
+
+#ifdef LIBMATH_USE_SIMD
+		if constexpr (Rows == 4 && Columns == 4 && OtherColumns == 4)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				Simd::multiplyMatrix4(m_values, other.m_values, result.m_values);
+				return result;
+			}
+		}
+#endif
+
+		for (length_t row = 0; row < Rows; row++)
+		{
+			for (length_t otherCol = 0; otherCol < OtherColumns; otherCol++)
+			{
+				float scalar = 0;
+
+				for (length_t col = 0; col < Columns; col++)
+					scalar += m_values[row * Columns + col] * other.m_values[col * OtherColumns + otherCol];
+
+				result.m_values[row * OtherColumns + otherCol] = scalar;
+			}
+		}
+
+		return result;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator/(const Matrix<Columns, Columns>& other) const
+	{
+		return *this * other.inverse();
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator+(const float scalar) const noexcept
+	{
+		Matrix mat = *this;
+		return mat += scalar;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator-(const float scalar) const noexcept
+	{
+		Matrix mat = *this;
+		return mat -= scalar;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator*(const float scalar) const noexcept
+	{
+		Matrix mat = *this;
+		return mat *= scalar;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator/(const float scalar) const noexcept
+	{
+		Matrix mat = *this;
+		return mat /= scalar;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::operator-() const noexcept
+	{
+		return *this * -1.f;
+	}
+
+	template <int Rows, int Columns>
+	constexpr bool Matrix<Rows, Columns>::operator==(const Matrix& other) const noexcept
+	{
+		for (length_t i = 0; i < Rows * Columns; i++)
+			if (!floatEquals(m_values[i], other.m_values[i]))
+				return false;
+
+		return true;
+	}
+
+	template <int Rows, int Columns>
+	constexpr bool Matrix<Rows, Columns>::operator!=(const Matrix& other) const noexcept
+	{
+		return !(*this == other);
+	}
+
+	template <int Rows, int Columns>
+	constexpr bool Matrix<Rows, Columns>::isIdentity() const noexcept
+	{
+		if constexpr (Rows != Columns)
+			return false;
+		else
+			return *this == Matrix(1.f);
+	}
+
+	template <int Rows, int Columns>
+	constexpr typename Matrix<Rows, Columns>::length_t Matrix<Rows, Columns>::getRowCount() const noexcept
+	{
+		return Rows;
+	}
+
+	template <int Rows, int Columns>
+	constexpr typename Matrix<Rows, Columns>::length_t Matrix<Rows, Columns>::getColumnCount() const noexcept
+	{
+		return Columns;
+	}
+
+	template <int Rows, int Columns>
+	constexpr typename Matrix<Rows, Columns>::length_t Matrix<Rows, Columns>::getIndex(const length_t row, const length_t column) const
+	{
+		if (row < 0 || row >= Rows || column < 0 || column >= Columns)
+			throw std::out_of_range("Index out of range");
+
+		return row * Columns + column;
+	}
+
+	template <int Rows, int Columns>
+	constexpr float* Matrix<Rows, Columns>::getArray() noexcept
+	{
+		return m_values;
+	}
+
+	template <int Rows, int Columns>
+	constexpr const float* Matrix<Rows, Columns>::getArray() const noexcept
+	{
+		return m_values;
+	}
+
+	template <int Rows, int Columns>
+	constexpr float Matrix<Rows, Columns>::determinant() const noexcept requires (Rows == Columns)
+	{
+		if constexpr (Rows == 1)
+		{
+			return m_values[0];
+		}
+		else if constexpr (Rows == 2)
+		{
+			// 0 1
+			// 2 3
+			return m_values[0] * m_values[3] - m_values[1] * m_values[2];
+		}
+		else if constexpr (Rows == 3)
+		{
+			// 0 1 2
+			// 3 4 5
+			// 6 7 8
+			const float positive = m_values[0] * m_values[4] * m_values[8] +
+				m_values[1] * m_values[5] * m_values[6] +
+				m_values[2] * m_values[3] * m_values[7];
+
+			const float negative = m_values[2] * m_values[4] * m_values[6] +
+				m_values[1] * m_values[3] * m_values[8] +
+				m_values[0] * m_values[5] * m_values[7];
+
+			return positive - negative;
+		}
+		else if constexpr (Rows == 4)
+		{
+			const float* m = m_values;
+
+			// Expand along the first two rows using their 2x2 sub-determinants
+			const float s0 = m[0] * m[5] - m[4] * m[1];
+			const float s1 = m[0] * m[6] - m[4] * m[2];
+			const float s2 = m[0] * m[7] - m[4] * m[3];
+			const float s3 = m[1] * m[6] - m[5] * m[2];
+			const float s4 = m[1] * m[7] - m[5] * m[3];
+			const float s5 = m[2] * m[7] - m[6] * m[3];
+
+			const float c5 = m[10] * m[15] - m[14] * m[11];
+			const float c4 = m[9] * m[15] - m[13] * m[11];
+			const float c3 = m[9] * m[14] - m[13] * m[10];
+			const float c2 = m[8] * m[15] - m[12] * m[11];
+			const float c1 = m[8] * m[14] - m[12] * m[10];
+			const float c0 = m[8] * m[13] - m[12] * m[9];
+
+			return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		}
+		else
+		{
+			float determinant = 0;
+
+			for (length_t col = 0; col < Columns; col++)
+				determinant += m_values[col] * cofactor(0, col);
+
+			return determinant;
+		}
+	}
+
+	template <int Rows, int Columns>
+	constexpr float Matrix<Rows, Columns>::cofactor(const length_t row, const length_t column) const noexcept requires (Rows == Columns)
+	{
+		if constexpr (Rows == 1)
+		{
+			return m_values[0];
+		}
+		else
+		{
+			// The multiplier is (-1)^(i+j) so 1 when i + j is pair and -1 otherwise
+			const float multiplier = (row + column) % 2 == 0 ? 1.f : -1.f;
+
+			return multiplier * minor(row, column).determinant();
+		}
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows - 1, Columns - 1> Matrix<Rows, Columns>::minor(const length_t row, const length_t column) const noexcept
+		requires (Rows > 1 && Columns > 1)
+	{
+		Matrix<Rows - 1, Columns - 1> minor;
+		length_t minorIndex = 0;
+
+		for (length_t i = 0; i < Rows; i++)
+		{
+			if (i == row)
+				continue;
+
+			for (length_t j = 0; j < Columns; j++)
+			{
+				if (j == column)
+					continue;
+
+				minor.m_values[minorIndex++] = m_values[i * Columns + j];
+			}
+		}
+
+		return minor;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Columns, Rows> Matrix<Rows, Columns>::transposed() const noexcept
+	{
+		Matrix<Columns, Rows> transposed;
+
+		for (length_t i = 0; i < Rows; i++)
+			for (length_t j = 0; j < Columns; j++)
+				transposed.m_values[j * Rows + i] = m_values[i * Columns + j];
+
+		return transposed;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::coMatrix() const noexcept requires (Rows == Columns)
+	{
+		Matrix coMatrix;
+
+		for (length_t row = 0; row < Rows; row++)
+			for (length_t col = 0; col < Columns; col++)
+				coMatrix.m_values[row * Columns + col] = cofactor(row, col);
+
+		return coMatrix;
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::adjugate() const noexcept requires (Rows == Columns)
+	{
+		return coMatrix().transposed();
+	}
+
+	template <int Rows, int Columns>
+	constexpr Matrix<Rows, Columns> Matrix<Rows, Columns>::inverse() const requires (Rows == Columns)
+	{
+		if constexpr (Rows == 4)
+		{
+			// Closed form of the adjugate built from the 2x2 sub-determinants
+			// of the top and bottom row pairs - cf. https://www.geometrictools.com/Documentation/LaplaceExpansionTheorem.pdf
+			const float* m = m_values;
+
+			const float s0 = m[0] * m[5] - m[4] * m[1];
+			const float s1 = m[0] * m[6] - m[4] * m[2];
+			const float s2 = m[0] * m[7] - m[4] * m[3];
+			const float s3 = m[1] * m[6] - m[5] * m[2];
+			const float s4 = m[1] * m[7] - m[5] * m[3];
+			const float s5 = m[2] * m[7] - m[6] * m[3];
+
+			const float c5 = m[10] * m[15] - m[14] * m[11];
+			const float c4 = m[9] * m[15] - m[13] * m[11];
+			const float c3 = m[9] * m[14] - m[13] * m[10];
+			const float c2 = m[8] * m[15] - m[12] * m[11];
+			const float c1 = m[8] * m[14] - m[12] * m[10];
+			const float c0 = m[8] * m[13] - m[12] * m[9];
+
+			const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+			if (det == 0.f)
+				throw Exceptions::NonInvertibleMatrix();
+
+			const float invDet = 1.f / det;
+
+			Matrix inverse;
+			float* out = inverse.m_values;
+
+			out[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+			out[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+			out[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+			out[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+			out[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+			out[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+			out[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+			out[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+			out[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+			out[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+			out[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+			out[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+			out[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+			out[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+			out[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+			out[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+
+			return inverse;
+		}
+		else
+		{
+			const float det = determinant();
+
+			if (det == 0.f)
+				throw Exceptions::NonInvertibleMatrix();
+
+			return adjugate() / det;
+		}
+	}
+}
+
+#endif // !__LIBMATH__MATRIX_MATRIXINTERNAL_INL__
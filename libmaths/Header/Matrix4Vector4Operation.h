@@ -1,21 +1,34 @@
 #ifndef __LIBMATH__MATRIX4VECTOR4OPERATION_H_
 #define __LIBMATH__MATRIX4VECTOR4OPERATION_H_
 
+#include <type_traits>
+
 #include "Vector/Vector4.h"
 #include "Matrix/Matrix4.h"
+#include "Simd.h"
 
 namespace LibMath
 {
-	inline Vector4 operator*(Matrix4 const& operation, Vector4 const& operand)
+	constexpr Vector4 operator*(Matrix<4, 4> const& operation, Vector4 const& operand) noexcept
 	{
-		Matrix vec4Mat(4, 1);
-		vec4Mat[0] = operand.m_x;
-		vec4Mat[1] = operand.m_y;
-		vec4Mat[2] = operand.m_z;
-		vec4Mat[3] = operand.m_w;
+		const float* values = operation.getArray();
+
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			Vector4 result;
+			Simd::store4(&result.m_x, Simd::multiplyMatrix4Vector4(values, Simd::load4(&operand.m_x)));
+			return result;
+		}
+#endif
 
-		vec4Mat = operation * vec4Mat;
-		return { vec4Mat[0], vec4Mat[1], vec4Mat[2], vec4Mat[3] };
+		return
+		{
+			values[0] * operand.m_x + values[1] * operand.m_y + values[2] * operand.m_z + values[3] * operand.m_w,
+			values[4] * operand.m_x + values[5] * operand.m_y + values[6] * operand.m_z + values[7] * operand.m_w,
+			values[8] * operand.m_x + values[9] * operand.m_y + values[10] * operand.m_z + values[11] * operand.m_w,
+			values[12] * operand.m_x + values[13] * operand.m_y + values[14] * operand.m_z + values[15] * operand.m_w
+		};
 	}
 }
 
@@ -0,0 +1,73 @@
+#ifndef __LIBMATH__QUATERNION_H__
+#define __LIBMATH__QUATERNION_H__
+
+#include <string>
+
+#include "Vector/Vector3.h"
+#include "Matrix/Matrix4.h"
+
+namespace LibMath
+{
+	class Radian;
+
+	// Rotations follow the same conventions as Matrix4::rotation : euler angles are stored as (pitch, yaw, roll)
+	// in a Vector3 and applied in the yaw * pitch * roll order (Y, then X, then Z in world space)
+	class alignas(16) Quaternion
+	{
+	public:
+							Quaternion();											// creates an identity quaternion
+							Quaternion(float x, float y, float z, float w);			// set all components individually
+							Quaternion(Quaternion const& other) = default;
+							Quaternion(Quaternion&& other) = default;
+							~Quaternion() = default;
+
+		static Quaternion	identity();												// return a quaternion representing no rotation
+		static Quaternion	fromAxisAngle(const Radian& angle, const Vector3& axis);	// return a rotation of the given angle around the given axis
+		static Quaternion	fromEuler(const Radian& xAngle, const Radian& yAngle,
+								const Radian& zAngle);								// return the rotation matching the given euler angles
+		static Quaternion	fromEuler(const Vector3& angles, bool isRadian);		// return the rotation matching the given euler angles
+		static Quaternion	fromEulerFast(const Radian& xAngle, const Radian& yAngle,
+								const Radian& zAngle);								// fromEuler through Fast::sinCos, for hot paths (see FastMath.h)
+
+		static Quaternion	nlerp(const Quaternion& from, const Quaternion& to, float t);	// normalized linear interpolation, takes the shortest path
+		static Quaternion	slerp(const Quaternion& from, const Quaternion& to, float t);	// spherical linear interpolation, takes the shortest path
+
+		Quaternion&			operator=(Quaternion const& other) = default;
+		Quaternion&			operator=(Quaternion&& other) = default;
+
+		Quaternion&			operator*=(Quaternion const& other);					// combine rotations : applies other, then this
+		Quaternion			operator*(Quaternion const& other) const;				// combine rotations : applies other, then this
+		Vector3				operator*(Vector3 const& vector) const;					// return the given vector rotated by this quaternion
+
+		bool				operator==(Quaternion const& other) const;				// component wise comparison
+		bool				operator!=(Quaternion const& other) const;				// component wise comparison
+
+		float				dot(Quaternion const& other) const;						// return dot product result
+		float				magnitude() const;										// return the quaternion's norm
+		float				magnitudeSquared() const;								// return the square value of the quaternion's norm
+
+		void				normalize();											// scale the quaternion to have a norm of 1
+		Quaternion			normalized() const;										// return a copy of this quaternion with a norm of 1
+		void				normalizeFast();										// normalize through Fast::rsqrt, for hot paths (see FastMath.h)
+		Quaternion			normalizedFast() const;									// normalized through Fast::rsqrt, for hot paths (see FastMath.h)
+		Quaternion			conjugate() const;										// return the quaternion with its vector part negated
+		Quaternion			inverse() const;										// return the inverse rotation
+
+		Vector3				rotate(Vector3 const& vector) const;					// return the given vector rotated by this quaternion
+		Vector3				toEuler(bool isRadian) const;							// return the (pitch, yaw, roll) euler angles of this rotation
+		Matrix4x4			toMatrix() const;										// return the rotation matrix of this unit quaternion
+
+		std::string			string() const;											// return a string representation of this quaternion
+
+		float m_x = 0;
+		float m_y = 0;
+		float m_z = 0;
+		float m_w = 1;
+
+	private:
+		static Quaternion	fromHalfAngles(float sinX, float cosX, float sinY, float cosY,
+								float sinZ, float cosZ);							// return the rotation matching the sines and cosines of the half euler angles
+	};
+}
+
+#endif // !__LIBMATH__QUATERNION_H__
@@ -0,0 +1,249 @@
+#ifndef __LIBMATH__SIMD_H__
+#define __LIBMATH__SIMD_H__
+
+// The SIMD backend is selected at configure time through the LIBMATH_SIMD cmake option.
+// When neither LIBMATH_SIMD_SSE41 nor LIBMATH_SIMD_AVX2 is defined, the scalar code paths are used.
+#if defined(LIBMATH_SIMD_AVX2) || defined(LIBMATH_SIMD_SSE41)
+#define LIBMATH_USE_SIMD
+#include <immintrin.h>
+#endif
+
+#ifdef LIBMATH_USE_SIMD
+namespace LibMath::Simd
+{
+	/**
+	 * \brief Loads 3 floats into the x, y and z lanes of a register and sets the w lane to 0
+	 * \param values The values to load
+	 * \return The loaded register
+	 */
+	inline __m128 load3(const float* values)
+	{
+		return _mm_setr_ps(values[0], values[1], values[2], 0.f);
+	}
+
+	/**
+	 * \brief Loads 4 floats into a register
+	 * \param values The values to load
+	 * \return The loaded register
+	 */
+	inline __m128 load4(const float* values)
+	{
+		return _mm_loadu_ps(values);
+	}
+
+	/**
+	 * \brief Stores the x, y and z lanes of a register
+	 * \param out The array in which the values should be written
+	 * \param values The register to store
+	 */
+	inline void store3(float* out, const __m128 values)
+	{
+		_mm_storel_pi(reinterpret_cast<__m64*>(out), values);
+		_mm_store_ss(out + 2, _mm_movehl_ps(values, values));
+	}
+
+	/**
+	 * \brief Stores the 4 lanes of a register
+	 * \param out The array in which the values should be written
+	 * \param values The register to store
+	 */
+	inline void store4(float* out, const __m128 values)
+	{
+		_mm_storeu_ps(out, values);
+	}
+
+	/**
+	 * \brief Computes (a * b) + c, using a fused multiply-add when available
+	 * \return The result of (a * b) + c
+	 */
+	inline __m128 multiplyAdd(const __m128 a, const __m128 b, const __m128 c)
+	{
+#ifdef LIBMATH_SIMD_AVX2
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+	/**
+	 * \brief Computes the dot product of the x, y and z lanes of the given registers
+	 * \return The dot product broadcast to every lane
+	 */
+	inline __m128 dot3(const __m128 a, const __m128 b)
+	{
+		return _mm_dp_ps(a, b, 0x7F);
+	}
+
+	/**
+	 * \brief Computes the dot product of the 4 lanes of the given registers
+	 * \return The dot product broadcast to every lane
+	 */
+	inline __m128 dot4(const __m128 a, const __m128 b)
+	{
+		return _mm_dp_ps(a, b, 0xFF);
+	}
+
+	/**
+	 * \brief Computes the cross product of the x, y and z lanes of the given registers
+	 * \return The cross product with the w lane set to 0
+	 */
+	inline __m128 cross3(const __m128 a, const __m128 b)
+	{
+		const __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 zxy = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+
+		return _mm_shuffle_ps(zxy, zxy, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	/**
+	 * \brief Multiplies two row-major 4x4 matrices
+	 * \param lhs The left operand's values
+	 * \param rhs The right operand's values
+	 * \param out The array in which the result should be written. Must not alias with the operands
+	 */
+	inline void multiplyMatrix4(const float* lhs, const float* rhs, float* out)
+	{
+		const __m128 row0 = load4(rhs);
+		const __m128 row1 = load4(rhs + 4);
+		const __m128 row2 = load4(rhs + 8);
+		const __m128 row3 = load4(rhs + 12);
+
+		for (int i = 0; i < 16; i += 4)
+		{
+			__m128 result = _mm_mul_ps(_mm_set1_ps(lhs[i]), row0);
+			result = multiplyAdd(_mm_set1_ps(lhs[i + 1]), row1, result);
+			result = multiplyAdd(_mm_set1_ps(lhs[i + 2]), row2, result);
+			result = multiplyAdd(_mm_set1_ps(lhs[i + 3]), row3, result);
+
+			store4(out + i, result);
+		}
+	}
+
+	/**
+	 * \brief Loads the columns of a row-major 4x4 matrix
+	 * \param matrix The matrix's values
+	 * \param columns The registers in which the matrix's columns should be written
+	 */
+	inline void loadColumns(const float* matrix, __m128 (&columns)[4])
+	{
+		columns[0] = load4(matrix);
+		columns[1] = load4(matrix + 4);
+		columns[2] = load4(matrix + 8);
+		columns[3] = load4(matrix + 12);
+
+		_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+	}
+
+	/**
+	 * \brief Computes the absolute value of every lane of a register
+	 * \return The register's absolute value
+	 */
+	inline __m128 abs(const __m128 values)
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.f), values);
+	}
+
+	/**
+	 * \brief Multiplies a matrix, given as columns, by a 4 components column vector
+	 * \param columns The matrix's columns
+	 * \param vector The vector's components
+	 * \return The transformed vector
+	 */
+	inline __m128 multiplyColumnsVector4(const __m128 (&columns)[4], const __m128 vector)
+	{
+		__m128 result = _mm_mul_ps(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)), columns[0]);
+		result = multiplyAdd(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1)), columns[1], result);
+		result = multiplyAdd(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2)), columns[2], result);
+		return multiplyAdd(_mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3)), columns[3], result);
+	}
+
+	/**
+	 * \brief Multiplies a row-major 4x4 matrix by a 4 components column vector
+	 * \param matrix The matrix's values
+	 * \param vector The vector's components
+	 * \return The transformed vector
+	 */
+	inline __m128 multiplyMatrix4Vector4(const float* matrix, const __m128 vector)
+	{
+		__m128 columns[4];
+		loadColumns(matrix, columns);
+
+		return multiplyColumnsVector4(columns, vector);
+	}
+
+	/**
+	 * \brief Thin wrappers over the 4 lanes (SSE) intrinsics, used to share kernels between register widths
+	 */
+	struct Lanes4
+	{
+		using Float = __m128;
+		using Int = __m128i;
+
+		static Float	set(const float value) { return _mm_set1_ps(value); }
+		static Int		setInt(const int value) { return _mm_set1_epi32(value); }
+		static Float	load(const float* values) { return _mm_loadu_ps(values); }
+		static void		store(float* out, const Float values) { _mm_storeu_ps(out, values); }
+
+		static Float	add(const Float a, const Float b) { return _mm_add_ps(a, b); }
+		static Float	sub(const Float a, const Float b) { return _mm_sub_ps(a, b); }
+		static Float	mul(const Float a, const Float b) { return _mm_mul_ps(a, b); }
+		static Float	multiplyAdd(const Float a, const Float b, const Float c) { return Simd::multiplyAdd(a, b, c); }
+		static Float	rsqrtEstimate(const Float values) { return _mm_rsqrt_ps(values); }
+
+		static Float	bitAnd(const Float a, const Float b) { return _mm_and_ps(a, b); }
+		static Float	bitAndNot(const Float a, const Float b) { return _mm_andnot_ps(a, b); }
+		static Float	bitXor(const Float a, const Float b) { return _mm_xor_ps(a, b); }
+		static Float	select(const Float ifFalse, const Float ifTrue, const Float mask) { return _mm_blendv_ps(ifFalse, ifTrue, mask); }
+		static Float	greaterThan(const Float a, const Float b) { return _mm_cmpgt_ps(a, b); }
+		static int		moveMask(const Float values) { return _mm_movemask_ps(values); }
+
+		static Int		truncate(const Float values) { return _mm_cvttps_epi32(values); }
+		static Float	toFloat(const Int values) { return _mm_cvtepi32_ps(values); }
+		static Float	asFloat(const Int values) { return _mm_castsi128_ps(values); }
+		static Int		addInt(const Int a, const Int b) { return _mm_add_epi32(a, b); }
+		static Int		andInt(const Int a, const Int b) { return _mm_and_si128(a, b); }
+		static Int		equalInt(const Int a, const Int b) { return _mm_cmpeq_epi32(a, b); }
+		static Int		shiftLeft(const Int values, const int count) { return _mm_slli_epi32(values, count); }
+	};
+
+#ifdef LIBMATH_SIMD_AVX2
+	/**
+	 * \brief Thin wrappers over the 8 lanes (AVX2) intrinsics, used to share kernels between register widths
+	 */
+	struct Lanes8
+	{
+		using Float = __m256;
+		using Int = __m256i;
+
+		static Float	set(const float value) { return _mm256_set1_ps(value); }
+		static Int		setInt(const int value) { return _mm256_set1_epi32(value); }
+		static Float	load(const float* values) { return _mm256_loadu_ps(values); }
+		static void		store(float* out, const Float values) { _mm256_storeu_ps(out, values); }
+
+		static Float	add(const Float a, const Float b) { return _mm256_add_ps(a, b); }
+		static Float	sub(const Float a, const Float b) { return _mm256_sub_ps(a, b); }
+		static Float	mul(const Float a, const Float b) { return _mm256_mul_ps(a, b); }
+		static Float	multiplyAdd(const Float a, const Float b, const Float c) { return _mm256_fmadd_ps(a, b, c); }
+		static Float	rsqrtEstimate(const Float values) { return _mm256_rsqrt_ps(values); }
+
+		static Float	bitAnd(const Float a, const Float b) { return _mm256_and_ps(a, b); }
+		static Float	bitAndNot(const Float a, const Float b) { return _mm256_andnot_ps(a, b); }
+		static Float	bitXor(const Float a, const Float b) { return _mm256_xor_ps(a, b); }
+		static Float	select(const Float ifFalse, const Float ifTrue, const Float mask) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+		static Float	greaterThan(const Float a, const Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		static int		moveMask(const Float values) { return _mm256_movemask_ps(values); }
+
+		static Int		truncate(const Float values) { return _mm256_cvttps_epi32(values); }
+		static Float	toFloat(const Int values) { return _mm256_cvtepi32_ps(values); }
+		static Float	asFloat(const Int values) { return _mm256_castsi256_ps(values); }
+		static Int		addInt(const Int a, const Int b) { return _mm256_add_epi32(a, b); }
+		static Int		andInt(const Int a, const Int b) { return _mm256_and_si256(a, b); }
+		static Int		equalInt(const Int a, const Int b) { return _mm256_cmpeq_epi32(a, b); }
+		static Int		shiftLeft(const Int values, const int count) { return _mm256_slli_epi32(values, count); }
+	};
+#endif
+}
+#endif // LIBMATH_USE_SIMD
+
+#endif // !__LIBMATH__SIMD_H__
@@ -1,4 +1,8 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
+
+#include "Quaternion.h"
 #include "Matrix/Matrix4.h"
 #include "Vector/Vector3.h"
 
@@ -7,6 +11,22 @@ namespace LibMath
 	class Transform
 	{
 	public:
+		/**
+		 * \brief Matrix rebuild counters shared by every transform.
+		 * Only counted when libmaths is built with LIBMATH_TRANSFORM_STATS (the default for debug builds)
+		 */
+		struct MatrixStats
+		{
+			uint64_t	m_changeCount;	// Number of changes which invalidated a transform's matrix
+			uint64_t	m_rebuildCount;	// Number of matrices actually rebuilt
+
+			/**
+			 * \brief Gets the number of matrix rebuilds skipped thanks to the lazy evaluation
+			 * \return The number of changes which didn't lead to a matrix rebuild
+			 */
+			uint64_t	getAvoidedCount() const;
+		};
+
 		/**
 		 * \brief Creates a transform with no translation, no rotation
 		 * and a scale of 1
@@ -17,11 +37,20 @@ namespace LibMath
 		 * \brief Creates a transform with the given position, rotation
 		 * and scale
 		 * \param position The transform's initial position
-		 * \param rotation The transform's initial rotation
+		 * \param rotation The transform's initial rotation (euler angles in degrees)
 		 * \param scale The transform's initial scale
 		 */
 		Transform(const Vector3& position, const Vector3& rotation, const Vector3& scale);
 
+		/**
+		 * \brief Creates a transform with the given position, rotation
+		 * and scale
+		 * \param position The transform's initial position
+		 * \param rotation The transform's initial rotation
+		 * \param scale The transform's initial scale
+		 */
+		Transform(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
 		/**
 		 * \brief Creates a copy of the given transform
 		 * \param other The transform to copy
@@ -110,11 +139,17 @@ namespace LibMath
 		Vector3 getPosition() const;
 
 		/**
-		 * \brief Gets the transform's current rotation
-		 * \return The transform's rotation
+		 * \brief Gets the transform's current rotation as euler angles
+		 * \return The transform's rotation (euler angles in degrees)
 		 */
 		Vector3 getRotation() const;
 
+		/**
+		 * \brief Gets the transform's current rotation
+		 * \return The transform's rotation quaternion
+		 */
+		Quaternion getOrientation() const;
+
 		/**
 		 * \brief Gets the transform's current scale
 		 * \return The transform's scale
@@ -122,11 +157,30 @@ namespace LibMath
 		Vector3 getScale() const;
 
 		/**
-		 * \brief Gets the transform's current transformation matrix
+		 * \brief Gets the transform's current transformation matrix.
+		 * The matrix is only rebuilt on the first call following a change
 		 * \return The transform's transformation matrix
 		 */
 		Matrix4x4 getMatrix() const;
 
+		/**
+		 * \brief Sets the transform's position, rotation and scale at once
+		 * \param position The transform's new position
+		 * \param rotation The transform's new rotation
+		 * \param scale The transform's new scale
+		 * \return A reference to the current transform
+		 */
+		Transform& setTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale);
+
+		/**
+		 * \brief Sets the transform's position, rotation and scale at once
+		 * \param position The transform's new position
+		 * \param rotation The transform's new rotation (euler angles in degrees)
+		 * \param scale The transform's new scale
+		 * \return A reference to the current transform
+		 */
+		Transform& setTRS(const Vector3& position, const Vector3& rotation, const Vector3& scale);
+
 		/**
 		 * \brief Sets the transform's current position
 		 * \param position The transform's new position
@@ -136,11 +190,18 @@ namespace LibMath
 
 		/**
 		 * \brief Sets the transform's current rotation
-		 * \param rotation The transform's new rotation
+		 * \param rotation The transform's new rotation (euler angles in degrees)
 		 * \return A reference to the current transform
 		 */
 		Transform& setRotation(const Vector3& rotation);
 
+		/**
+		 * \brief Sets the transform's current rotation
+		 * \param orientation The transform's new rotation quaternion
+		 * \return A reference to the current transform
+		 */
+		Transform& setOrientation(const Quaternion& orientation);
+
 		/**
 		 * \brief Sets the transform's current rotation
 		 * \param scale The transform's new scale
@@ -156,12 +217,19 @@ namespace LibMath
 		Transform& translate(const Vector3& translation);
 
 		/**
-		 * \brief Adds the given vector to the transform's current rotation
-		 * \param rotation The rotation vector to apply
+		 * \brief Adds the given vector to the transform's current euler angles
+		 * \param rotation The rotation vector to apply (euler angles in degrees)
 		 * \return A reference to the current transform
 		 */
 		Transform& rotate(const Vector3& rotation);
 
+		/**
+		 * \brief Rotates the transform by the given rotation, expressed in its local space
+		 * \param rotation The rotation to apply
+		 * \return A reference to the current transform
+		 */
+		Transform& rotate(const Quaternion& rotation);
+
 		/**
 		 * \brief Multiplies the transform's current scale by the given vector
 		 * \param scale The scaling vector to apply
@@ -169,16 +237,38 @@ namespace LibMath
 		 */
 		Transform& scale(const Vector3& scale);
 
+		/**
+		 * \brief Gets the matrix rebuild counters accumulated since the last reset
+		 * \return The current matrix rebuild counters. Always zero without LIBMATH_TRANSFORM_STATS
+		 */
+		static MatrixStats getMatrixStats();
+
+		/**
+		 * \brief Resets the matrix rebuild counters
+		 */
+		static void resetMatrixStats();
+
 	protected:
 		/**
-		 * \brief Updates the transform's matrix
+		 * \brief Marks the transform's matrix as outdated
 		 */
 		virtual void onChange();
 
 	private:
-		Vector3	m_position;
-		Vector3	m_rotation;
-		Vector3	m_scale;
-		Matrix4	m_matrix;
-	};;
+#ifdef LIBMATH_TRANSFORM_STATS
+		static std::atomic<uint64_t>	s_changeCount;
+		static std::atomic<uint64_t>	s_rebuildCount;
+#endif
+
+		Vector3			m_position;
+		Quaternion		m_rotation;
+		Vector3			m_scale;
+		mutable Matrix4	m_matrix;
+		mutable bool	m_isDirty = true;
+
+		/**
+		 * \brief Rebuilds the transform's matrix from its position, rotation and scale
+		 */
+		void updateMatrix() const;
+	};
 }
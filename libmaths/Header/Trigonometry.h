@@ -1,10 +1,10 @@
 #ifndef __LIBMATH__TRIGONOMETRY_H__
 #define __LIBMATH__TRIGONOMETRY_H__
 
-#include "Angle/Radian.h"
-
 namespace LibMath
 {
+	class Radian;
+
 	constexpr float g_pi = 3.14159265358979323846264338327950288f;				// useful constant pi -> 3.141592...
 
 	float	sin(const Radian& angle);	// float result = sin(Radian{0.5});		// 0.479426
@@ -16,4 +16,6 @@ namespace LibMath
 	Radian	atan(float y, float x);		// Radian angle = atan(1, -2);			// Radian{2.677945}
 }
 
+#include "Angle/Radian.h"
+
 #endif // !__LIBMATH__TRIGONOMETRY_H__
@@ -0,0 +1,336 @@
+#ifndef __LIBMATH__VECTOR__VECTOR2_INL__
+#define __LIBMATH__VECTOR__VECTOR2_INL__
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Arithmetic.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+namespace LibMath
+{
+	constexpr Vector2::Vector2(const float value) noexcept : Vector2(value, value)
+	{
+	}
+
+	constexpr Vector2::Vector2(const float x, const float y) noexcept : m_x(x), m_y(y)
+	{
+	}
+
+	constexpr Vector2 Vector2::zero() noexcept
+	{
+		return Vector2(0.f);
+	}
+
+	constexpr Vector2 Vector2::one() noexcept
+	{
+		return Vector2(1.f);
+	}
+
+	constexpr Vector2 Vector2::up() noexcept
+	{
+		return { 0.f, 1.f };
+	}
+
+	constexpr Vector2 Vector2::down() noexcept
+	{
+		return { 0.f, -1.f };
+	}
+
+	constexpr Vector2 Vector2::left() noexcept
+	{
+		return { -1.f, 0.f };
+	}
+
+	constexpr Vector2 Vector2::right() noexcept
+	{
+		return { 1.f, 0.f };
+	}
+
+	constexpr Vector2::operator Vector3() const noexcept
+	{
+		return { m_x, m_y, 0 };
+	}
+
+	constexpr float& Vector2::operator[](const int index)
+	{
+		switch (index)
+		{
+		case 0:
+		case 'x':
+		case 'X':
+			return this->m_x;
+		case 1:
+		case 'y':
+		case 'Y':
+			return this->m_y;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr float Vector2::operator[](const int index) const
+	{
+		switch (index)
+		{
+		case 0:
+		case 'x':
+		case 'X':
+			return this->m_x;
+		case 1:
+		case 'y':
+		case 'Y':
+			return this->m_y;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr Vector2& Vector2::operator+=(Vector2 const& other) noexcept
+	{
+		this->m_x += other.m_x;
+		this->m_y += other.m_y;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator-=(Vector2 const& other) noexcept
+	{
+		this->m_x -= other.m_x;
+		this->m_y -= other.m_y;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator*=(Vector2 const& other) noexcept
+	{
+		this->m_x *= other.m_x;
+		this->m_y *= other.m_y;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator/=(Vector2 const& other) noexcept
+	{
+		this->m_x /= other.m_x;
+		this->m_y /= other.m_y;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator+=(float const& value) noexcept
+	{
+		this->m_x += value;
+		this->m_y += value;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator-=(float const& value) noexcept
+	{
+		this->m_x -= value;
+		this->m_y -= value;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator*=(float const& value) noexcept
+	{
+		this->m_x *= value;
+		this->m_y *= value;
+
+		return *this;
+	}
+
+	constexpr Vector2& Vector2::operator/=(float const& value) noexcept
+	{
+		this->m_x /= value;
+		this->m_y /= value;
+
+		return *this;
+	}
+
+	constexpr float* Vector2::getArray() noexcept
+	{
+		return &m_x;
+	}
+
+	constexpr const float* Vector2::getArray() const noexcept
+	{
+		return &m_x;
+	}
+
+	constexpr float Vector2::cross(Vector2 const& other) const noexcept
+	{
+		return this->m_x * other.m_y - this->m_y * other.m_x;
+	}
+
+	constexpr float Vector2::distanceFrom(Vector2 const& other) const noexcept
+	{
+		// squareRoot is only meant for constant expressions, the hardware square root is both exact and faster
+		if (!std::is_constant_evaluated())
+			return std::sqrt(this->distanceSquaredFrom(other));
+
+		return squareRoot(this->distanceSquaredFrom(other));
+	}
+
+	constexpr float Vector2::distanceSquaredFrom(Vector2 const& other) const noexcept
+	{
+		const float xDist = other.m_x - this->m_x;
+		const float yDist = other.m_y - this->m_y;
+
+		return xDist * xDist + yDist * yDist;
+	}
+
+	constexpr float Vector2::dot(Vector2 const& other) const noexcept
+	{
+		return this->m_x * other.m_x + this->m_y * other.m_y;
+	}
+
+	constexpr bool Vector2::isLongerThan(Vector2 const& other) const noexcept
+	{
+		return this->magnitudeSquared() > other.magnitudeSquared();
+	}
+
+	constexpr bool Vector2::isShorterThan(Vector2 const& other) const noexcept
+	{
+		return this->magnitudeSquared() < other.magnitudeSquared();
+	}
+
+	constexpr bool Vector2::isUnitVector() const noexcept
+	{
+		return 1.f == this->magnitudeSquared();
+	}
+
+	constexpr float Vector2::magnitude() const noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return std::sqrt(this->magnitudeSquared());
+
+		return squareRoot(this->magnitudeSquared());
+	}
+
+	constexpr float Vector2::magnitudeSquared() const noexcept
+	{
+		return this->m_x * this->m_x + this->m_y * this->m_y;
+	}
+
+	constexpr void Vector2::normalize() noexcept
+	{
+		*this /= this->magnitude();
+	}
+
+	constexpr Vector2 Vector2::normalized() const noexcept
+	{
+		Vector2 vec = *this;
+		vec.normalize();
+		return vec;
+	}
+
+	constexpr void Vector2::projectOnto(Vector2 const& normal) noexcept
+	{
+		*this = this->dot(normal) / normal.magnitudeSquared() * normal;
+	}
+
+	// Adapted from https://math.stackexchange.com/a/4325839
+	constexpr void Vector2::reflectOnto(Vector2 const& other) noexcept
+	{
+		*this -= 2 * this->dot(other) / other.magnitudeSquared() * other;
+	}
+
+	constexpr void Vector2::scale(Vector2 const& other) noexcept
+	{
+		*this *= other;
+	}
+
+	constexpr void Vector2::translate(Vector2 const& vect) noexcept
+	{
+		*this += vect;
+	}
+
+	constexpr bool operator==(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return floatEquals(lhs.m_x, rhs.m_x)
+			&& floatEquals(lhs.m_y, rhs.m_y);
+	}
+
+	constexpr bool operator!=(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	constexpr bool operator>(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return lhs.isLongerThan(rhs);
+	}
+
+	constexpr bool operator<(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return rhs > lhs;
+	}
+
+	constexpr bool operator>=(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return !(lhs < rhs);
+	}
+
+	constexpr bool operator<=(Vector2 const& lhs, Vector2 const& rhs) noexcept
+	{
+		return !(lhs > rhs);
+	}
+
+	constexpr Vector2 operator-(const Vector2& vect) noexcept
+	{
+		return vect * -1;
+	}
+
+	constexpr Vector2 operator+(Vector2 left, Vector2 const& right) noexcept
+	{
+		return left += right;
+	}
+
+	constexpr Vector2 operator-(Vector2 left, Vector2 const& right) noexcept
+	{
+		return left -= right;
+	}
+
+	constexpr Vector2 operator*(Vector2 left, Vector2 const& right) noexcept
+	{
+		return left *= right;
+	}
+
+	constexpr Vector2 operator/(Vector2 left, Vector2 const& right) noexcept
+	{
+		return left /= right;
+	}
+
+	constexpr Vector2 operator+(Vector2 vect, float const& val) noexcept
+	{
+		return vect += val;
+	}
+
+	constexpr Vector2 operator-(Vector2 vect, float const& val) noexcept
+	{
+		return vect -= val;
+	}
+
+	constexpr Vector2 operator*(Vector2 vect, float const& val) noexcept
+	{
+		return vect *= val;
+	}
+
+	constexpr Vector2 operator*(float const& val, Vector2 vect) noexcept
+	{
+		return vect *= val;
+	}
+
+	constexpr Vector2 operator/(Vector2 vect, float const& val) noexcept
+	{
+		return vect /= val;
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR2_INL__
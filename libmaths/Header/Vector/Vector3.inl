@@ -0,0 +1,420 @@
+#ifndef __LIBMATH__VECTOR__VECTOR3_INL__
+#define __LIBMATH__VECTOR__VECTOR3_INL__
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Arithmetic.h"
+#include "Simd.h"
+#include "Vector3.h"
+
+namespace LibMath
+{
+	constexpr Vector3::Vector3(const float value) noexcept : Vector3(value, value, value)
+	{
+	}
+
+	constexpr Vector3::Vector3(const float x, const float y, const float z) noexcept : m_x(x), m_y(y), m_z(z)
+	{
+	}
+
+	constexpr Vector3 Vector3::zero() noexcept
+	{
+		return Vector3(0.f);
+	}
+
+	constexpr Vector3 Vector3::one() noexcept
+	{
+		return Vector3(1.f);
+	}
+
+	constexpr Vector3 Vector3::up() noexcept
+	{
+		return {0.f, 1.f, 0.f};
+	}
+
+	constexpr Vector3 Vector3::down() noexcept
+	{
+		return {0.f, -1.f, 0.f};
+	}
+
+	constexpr Vector3 Vector3::left() noexcept
+	{
+		return {-1.f, 0.f, 0.f};
+	}
+
+	constexpr Vector3 Vector3::right() noexcept
+	{
+		return {1.f, 0.f, 0.f};
+	}
+
+	constexpr Vector3 Vector3::front() noexcept
+	{
+		return {0.f, 0.f, 1.f};
+	}
+
+	constexpr Vector3 Vector3::back() noexcept
+	{
+		return {0.f, 0.f, -1.f};
+	}
+
+	constexpr float& Vector3::operator[](const int index)
+	{
+		switch (index)
+		{
+		case 0:
+		case 'x':
+		case 'X':
+			return this->m_x;
+		case 1:
+		case 'y':
+		case 'Y':
+			return this->m_y;
+		case 2:
+		case 'z':
+		case 'Z':
+			return this->m_z;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr float Vector3::operator[](const int index) const
+	{
+		switch (index)
+		{
+		case 0:
+		case 'x':
+		case 'X':
+			return this->m_x;
+		case 1:
+		case 'y':
+		case 'Y':
+			return this->m_y;
+		case 2:
+		case 'z':
+		case 'Z':
+			return this->m_z;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr Vector3& Vector3::operator+=(Vector3 const& other) noexcept
+	{
+		this->m_x += other.m_x;
+		this->m_y += other.m_y;
+		this->m_z += other.m_z;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator-=(Vector3 const& other) noexcept
+	{
+		this->m_x -= other.m_x;
+		this->m_y -= other.m_y;
+		this->m_z -= other.m_z;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator*=(Vector3 const& other) noexcept
+	{
+		this->m_x *= other.m_x;
+		this->m_y *= other.m_y;
+		this->m_z *= other.m_z;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator/=(Vector3 const& other) noexcept
+	{
+		this->m_x /= other.m_x;
+		this->m_y /= other.m_y;
+		this->m_z /= other.m_z;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator+=(float const& value) noexcept
+	{
+		this->m_x += value;
+		this->m_y += value;
+		this->m_z += value;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator-=(float const& value) noexcept
+	{
+		this->m_x -= value;
+		this->m_y -= value;
+		this->m_z -= value;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator*=(float const& value) noexcept
+	{
+		this->m_x *= value;
+		this->m_y *= value;
+		this->m_z *= value;
+
+		return *this;
+	}
+
+	constexpr Vector3& Vector3::operator/=(float const& value) noexcept
+	{
+		this->m_x /= value;
+		this->m_y /= value;
+		this->m_z /= value;
+
+		return *this;
+	}
+
+	constexpr float* Vector3::getArray() noexcept
+	{
+		return &m_x;
+	}
+
+	constexpr const float* Vector3::getArray() const noexcept
+	{
+		return &m_x;
+	}
+
+	constexpr Vector3 Vector3::cross(Vector3 const& other) const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			Vector3 result;
+			Simd::store3(&result.m_x, Simd::cross3(Simd::load3(&m_x), Simd::load3(&other.m_x)));
+			return result;
+		}
+#endif
+
+		return {
+			this->m_y * other.m_z - this->m_z * other.m_y,
+			this->m_z * other.m_x - this->m_x * other.m_z,
+			this->m_x * other.m_y - this->m_y * other.m_x
+		};
+	}
+
+	constexpr float Vector3::distanceFrom(Vector3 const& other) const noexcept
+	{
+		// squareRoot is only meant for constant expressions, the hardware square root is both exact and faster
+		if (!std::is_constant_evaluated())
+			return std::sqrt(this->distanceSquaredFrom(other));
+
+		return squareRoot(this->distanceSquaredFrom(other));
+	}
+
+	constexpr float Vector3::distanceSquaredFrom(Vector3 const& other) const noexcept
+	{
+		const float xDist = other.m_x - this->m_x;
+		const float yDist = other.m_y - this->m_y;
+		const float zDist = other.m_z - this->m_z;
+
+		return xDist * xDist + yDist * yDist + zDist * zDist;
+	}
+
+	constexpr float Vector3::distance2DFrom(Vector3 const& other) const noexcept
+	{
+		if (!std::is_constant_evaluated())
+			return std::sqrt(this->distance2DSquaredFrom(other));
+
+		return squareRoot(this->distance2DSquaredFrom(other));
+	}
+
+	constexpr float Vector3::distance2DSquaredFrom(Vector3 const& other) const noexcept
+	{
+		const float xDist = other.m_x - this->m_x;
+		const float yDist = other.m_y - this->m_y;
+
+		return xDist * xDist + yDist * yDist;
+	}
+
+	constexpr float Vector3::dot(Vector3 const& other) const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			return _mm_cvtss_f32(Simd::dot3(Simd::load3(&m_x), Simd::load3(&other.m_x)));
+		}
+#endif
+
+		return this->m_x * other.m_x + this->m_y * other.m_y + this->m_z * other.m_z;
+	}
+
+	constexpr bool Vector3::isLongerThan(Vector3 const& other) const noexcept
+	{
+		return this->magnitudeSquared() > other.magnitudeSquared();
+	}
+
+	constexpr bool Vector3::isShorterThan(Vector3 const& other) const noexcept
+	{
+		return this->magnitudeSquared() < other.magnitudeSquared();
+	}
+
+	constexpr bool Vector3::isUnitVector() const noexcept
+	{
+		return 1.f == this->magnitudeSquared();
+	}
+
+	constexpr float Vector3::magnitude() const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			const __m128 vec = Simd::load3(&m_x);
+			return _mm_cvtss_f32(_mm_sqrt_ss(Simd::dot3(vec, vec)));
+		}
+#endif
+
+		if (!std::is_constant_evaluated())
+			return std::sqrt(this->magnitudeSquared());
+
+		return squareRoot(this->magnitudeSquared());
+	}
+
+	constexpr float Vector3::magnitudeSquared() const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			const __m128 vec = Simd::load3(&m_x);
+			return _mm_cvtss_f32(Simd::dot3(vec, vec));
+		}
+#endif
+
+		return this->m_x * this->m_x + this->m_y * this->m_y + this->m_z * this->m_z;
+	}
+
+	constexpr void Vector3::normalize() noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			const __m128 vec = Simd::load3(&m_x);
+			Simd::store3(&m_x, _mm_div_ps(vec, _mm_sqrt_ps(Simd::dot3(vec, vec))));
+			return;
+		}
+#endif
+
+		*this /= this->magnitude();
+	}
+
+	constexpr Vector3 Vector3::normalized() const noexcept
+	{
+		Vector3 vec = *this;
+		vec.normalize();
+		return vec;
+	}
+
+	constexpr void Vector3::projectOnto(Vector3 const& normal) noexcept
+	{
+		*this = this->dot(normal) / normal.magnitudeSquared() * normal;
+	}
+
+	// Adapted from https://math.stackexchange.com/a/4325839
+	constexpr void Vector3::reflectOnto(Vector3 const& other) noexcept
+	{
+		*this -= 2 * this->dot(other) / other.magnitudeSquared() * other;
+	}
+
+	constexpr void Vector3::scale(Vector3 const& other) noexcept
+	{
+		*this *= other;
+	}
+
+	constexpr void Vector3::translate(Vector3 const& vect) noexcept
+	{
+		*this += vect;
+	}
+
+	constexpr bool operator==(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return floatEquals(lhs.m_x, rhs.m_x)
+			&& floatEquals(lhs.m_y, rhs.m_y)
+			&& floatEquals(lhs.m_z, rhs.m_z);
+	}
+
+	constexpr bool operator!=(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	}
+
+	constexpr bool operator>(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return lhs.isLongerThan(rhs);
+	}
+
+	constexpr bool operator<(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return rhs > lhs;
+	}
+
+	constexpr bool operator>=(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return !(lhs < rhs);
+	}
+
+	constexpr bool operator<=(Vector3 const& lhs, Vector3 const& rhs) noexcept
+	{
+		return !(lhs > rhs);
+	}
+
+	constexpr Vector3 operator-(const Vector3& vect) noexcept
+	{
+		return { -vect.m_x, -vect.m_y, -vect.m_z };
+	}
+
+	constexpr Vector3 operator+(Vector3 left, Vector3 const& right) noexcept
+	{
+		return left += right;
+	}
+
+	constexpr Vector3 operator-(Vector3 left, Vector3 const& right) noexcept
+	{
+		return left -= right;
+	}
+
+	constexpr Vector3 operator*(Vector3 left, Vector3 const& right) noexcept
+	{
+		return left *= right;
+	}
+
+	constexpr Vector3 operator/(Vector3 left, Vector3 const& right) noexcept
+	{
+		return left /= right;
+	}
+
+	constexpr Vector3 operator+(Vector3 vect, float const& val) noexcept
+	{
+		return vect += val;
+	}
+
+	constexpr Vector3 operator-(Vector3 vect, float const& val) noexcept
+	{
+		return vect -= val;
+	}
+
+	constexpr Vector3 operator*(Vector3 vect, float const& val) noexcept
+	{
+		return vect *= val;
+	}
+
+	constexpr Vector3 operator*(float const& val, Vector3 vect) noexcept
+	{
+		return vect *= val;
+	}
+
+	constexpr Vector3 operator/(Vector3 vect, float const& val) noexcept
+	{
+		return vect /= val;
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR3_INL__
@@ -0,0 +1,316 @@
+#ifndef __LIBMATH__VECTOR__VECTOR4_INL__
+#define __LIBMATH__VECTOR__VECTOR4_INL__
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Arithmetic.h"
+#include "Simd.h"
+#include "Vector4.h"
+
+namespace LibMath
+{
+	constexpr Vector4::Vector4(const float value) noexcept :
+		Vector4(value, value, value, value)
+	{
+	}
+
+	constexpr Vector4::Vector4(const float x, const float y, const float z, const float w) noexcept :
+		Vector3(x, y, z), m_w(w)
+	{
+	}
+
+	constexpr Vector4::Vector4(Vector3 const& other, float w) noexcept :
+		Vector3(other), m_w(w)
+	{
+	}
+
+	constexpr Vector4 Vector4::zero() noexcept
+	{
+		return { 0.f, 0.f, 0.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::one() noexcept
+	{
+		return { 1.f, 1.f, 1.f, 1.f };
+	}
+
+	constexpr Vector4 Vector4::up() noexcept
+	{
+		return { 0.f, 1.f, 0.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::down() noexcept
+	{
+		return { 0.f, -1.f, 0.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::left() noexcept
+	{
+		return { -1.f, 0.f, 0.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::right() noexcept
+	{
+		return { 1.f, 0.f, 0.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::front() noexcept
+	{
+		return { 0.f, 0.f, 1.f, 0.f };
+	}
+
+	constexpr Vector4 Vector4::back() noexcept
+	{
+		return { 0.f, 0.f, -1.f, 0.f };
+	}
+
+	constexpr float& Vector4::operator[](const int index)
+	{
+		switch (index)
+		{
+		case 0:
+		case 'x':
+		case 'X':
+			return this->m_x;
+		case 1:
+		case 'y':
+		case 'Y':
+			return this->m_y;
+		case 2:
+		case 'z':
+		case 'Z':
+			return this->m_z;
+		case 3:
+		case 'w':
+		case 'W':
+			return this->m_w;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr float Vector4::operator[](const int index) const
+	{
+		switch (index)
+		{
+		case 0:
+			return this->m_x;
+		case 1:
+			return this->m_y;
+		case 2:
+			return this->m_z;
+		case 3:
+			return this->m_w;
+		default:
+			throw std::out_of_range("Invalid index \"" + std::to_string(index) + "\" received");
+		}
+	}
+
+	constexpr Vector4& Vector4::operator+=(Vector4 const& other) noexcept
+	{
+		m_x += other.m_x;
+		m_y += other.m_y;
+		m_z += other.m_z;
+		m_w += other.m_w;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator-=(Vector4 const& other) noexcept
+	{
+		m_x -= other.m_x;
+		m_y -= other.m_y;
+		m_z -= other.m_z;
+		m_w -= other.m_w;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator*=(Vector4 const& other) noexcept
+	{
+		m_x *= other.m_x;
+		m_y *= other.m_y;
+		m_z *= other.m_z;
+		m_w *= other.m_w;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator/=(Vector4 const& other) noexcept
+	{
+		m_x /= other.m_x;
+		m_y /= other.m_y;
+		m_z /= other.m_z;
+		m_w /= other.m_w;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator+=(float const& value) noexcept
+	{
+		m_x += value;
+		m_y += value;
+		m_z += value;
+		m_w += value;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator-=(float const& value) noexcept
+	{
+		m_x -= value;
+		m_y -= value;
+		m_z -= value;
+		m_w -= value;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator*=(float const& value) noexcept
+	{
+		m_x *= value;
+		m_y *= value;
+		m_z *= value;
+		m_w *= value;
+
+		return *this;
+	}
+
+	constexpr Vector4& Vector4::operator/=(float const& value) noexcept
+	{
+		m_x /= value;
+		m_y /= value;
+		m_z /= value;
+		m_w /= value;
+
+		return *this;
+	}
+
+	constexpr Vector3 Vector4::xyz() const noexcept
+	{
+		return { m_x, m_y, m_z };
+	}
+
+	constexpr float Vector4::dot(Vector4 const& other) const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			return _mm_cvtss_f32(Simd::dot4(Simd::load4(&m_x), Simd::load4(&other.m_x)));
+		}
+#endif
+
+		return this->m_x * other.m_x +
+			this->m_y * other.m_y +
+			this->m_z * other.m_z +
+			this->m_w * other.m_w;
+	}
+
+	constexpr float Vector4::magnitudeSquared() const noexcept
+	{
+#ifdef LIBMATH_USE_SIMD
+		if (!std::is_constant_evaluated())
+		{
+			const __m128 vec = Simd::load4(&m_x);
+			return _mm_cvtss_f32(Simd::dot4(vec, vec));
+		}
+#endif
+
+		return this->m_x * this->m_x +
+			this->m_y * this->m_y +
+			this->m_z * this->m_z +
+			this->m_w * this->m_w;
+	}
+
+	constexpr Vector4 Vector4::normalized() const noexcept
+	{
+		return *this / magnitude();
+	}
+
+	constexpr bool operator==(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return floatEquals(left.m_x, right.m_x) &&
+			floatEquals(left.m_y, right.m_y) &&
+			floatEquals(left.m_z, right.m_z) &&
+			floatEquals(left.m_w, right.m_w);
+	}
+
+	constexpr bool operator!=(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return !(left == right);
+	}
+
+	constexpr bool operator>(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return left.isLongerThan(right);
+	}
+
+	constexpr bool operator<(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return right > left;
+	}
+
+	constexpr bool operator>=(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return !(left < right);
+	}
+
+	constexpr bool operator<=(Vector4 const& left, Vector4 const& right) noexcept
+	{
+		return !(left > right);
+	}
+
+	constexpr Vector4 operator-(const Vector4& vector) noexcept
+	{
+		return { -vector.m_x, -vector.m_y, -vector.m_z, -vector.m_w };
+	}
+
+	constexpr Vector4 operator+(Vector4 left, Vector4 const& right) noexcept
+	{
+		return left += right;
+	}
+
+	constexpr Vector4 operator-(Vector4 left, Vector4 const& right) noexcept
+	{
+		return left -= right;
+	}
+
+	constexpr Vector4 operator*(Vector4 left, Vector4 const& right) noexcept
+	{
+		return left *= right;
+	}
+
+	constexpr Vector4 operator/(Vector4 left, Vector4 const& right) noexcept
+	{
+		return left /= right;
+	}
+
+	constexpr Vector4 operator+(Vector4 vector, float const& value) noexcept
+	{
+		return vector += value;
+	}
+
+	constexpr Vector4 operator-(Vector4 vector, float const& value) noexcept
+	{
+		return vector -= value;
+	}
+
+	constexpr Vector4 operator*(Vector4 vector, float const& scalar) noexcept
+	{
+		return vector *= scalar;
+	}
+
+	constexpr Vector4 operator*(float const& scalar, Vector4 vector) noexcept
+	{
+		return vector *= scalar;
+	}
+
+	constexpr Vector4 operator/(Vector4 vector, float const& scalar) noexcept
+	{
+		return vector /= scalar;
+	}
+}
+
+#endif // !__LIBMATH__VECTOR__VECTOR4_INL__
@@ -0,0 +1,165 @@
+#include "Batch.h"
+
+#include <stdexcept>
+
+#include "Arithmetic.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+	void transformPoints(const Matrix4& matrix, const std::span<const Vector3> points, const std::span<Vector3> out)
+	{
+		if (out.size() < points.size())
+			throw std::invalid_argument("Output array is smaller than the points array");
+
+#ifdef LIBMATH_USE_SIMD
+		__m128 columns[4];
+		Simd::loadColumns(matrix.getArray(), columns);
+
+		for (size_t i = 0; i < points.size(); i++)
+		{
+			const Vector3& point = points[i];
+
+			__m128 result = Simd::multiplyAdd(_mm_set1_ps(point.m_x), columns[0], columns[3]);
+			result = Simd::multiplyAdd(_mm_set1_ps(point.m_y), columns[1], result);
+			result = Simd::multiplyAdd(_mm_set1_ps(point.m_z), columns[2], result);
+
+			Simd::store3(&out[i].m_x, result);
+		}
+#else
+		const float* m = matrix.getArray();
+
+		for (size_t i = 0; i < points.size(); i++)
+		{
+			const Vector3 point = points[i];
+
+			out[i] =
+			{
+				m[0] * point.m_x + m[1] * point.m_y + m[2] * point.m_z + m[3],
+				m[4] * point.m_x + m[5] * point.m_y + m[6] * point.m_z + m[7],
+				m[8] * point.m_x + m[9] * point.m_y + m[10] * point.m_z + m[11]
+			};
+		}
+#endif
+	}
+
+	void transformDirections(const Matrix4& matrix, const std::span<const Vector3> directions, const std::span<Vector3> out)
+	{
+		if (out.size() < directions.size())
+			throw std::invalid_argument("Output array is smaller than the directions array");
+
+#ifdef LIBMATH_USE_SIMD
+		__m128 columns[4];
+		Simd::loadColumns(matrix.getArray(), columns);
+
+		for (size_t i = 0; i < directions.size(); i++)
+		{
+			const Vector3& direction = directions[i];
+
+			__m128 result = _mm_mul_ps(_mm_set1_ps(direction.m_x), columns[0]);
+			result = Simd::multiplyAdd(_mm_set1_ps(direction.m_y), columns[1], result);
+			result = Simd::multiplyAdd(_mm_set1_ps(direction.m_z), columns[2], result);
+
+			Simd::store3(&out[i].m_x, result);
+		}
+#else
+		const float* m = matrix.getArray();
+
+		for (size_t i = 0; i < directions.size(); i++)
+		{
+			const Vector3 direction = directions[i];
+
+			out[i] =
+			{
+				m[0] * direction.m_x + m[1] * direction.m_y + m[2] * direction.m_z,
+				m[4] * direction.m_x + m[5] * direction.m_y + m[6] * direction.m_z,
+				m[8] * direction.m_x + m[9] * direction.m_y + m[10] * direction.m_z
+			};
+		}
+#endif
+	}
+
+	void transformAABBs(const Matrix4& matrix, const std::span<const Vector3> centers,
+		const std::span<const Vector3> extents, const std::span<Vector3> outCenters, const std::span<Vector3> outExtents)
+	{
+		if (extents.size() != centers.size())
+			throw std::invalid_argument("Centers and extents arrays have different sizes");
+
+		if (outCenters.size() < centers.size() || outExtents.size() < centers.size())
+			throw std::invalid_argument("Output arrays are smaller than the boxes arrays");
+
+		// The transformed extents are the original ones projected on the absolute value of the
+		// matrix's axes (Arvo, "Transforming Axis-Aligned Bounding Boxes", Graphics Gems, 1990)
+#ifdef LIBMATH_USE_SIMD
+		__m128 columns[4];
+		Simd::loadColumns(matrix.getArray(), columns);
+
+		const __m128 absColumns[3] = { Simd::abs(columns[0]), Simd::abs(columns[1]), Simd::abs(columns[2]) };
+
+		for (size_t i = 0; i < centers.size(); i++)
+		{
+			const Vector3& center = centers[i];
+			const Vector3& extent = extents[i];
+
+			__m128 newCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_x), columns[0], columns[3]);
+			newCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_y), columns[1], newCenter);
+			newCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_z), columns[2], newCenter);
+
+			__m128 newExtent = _mm_mul_ps(_mm_set1_ps(extent.m_x), absColumns[0]);
+			newExtent = Simd::multiplyAdd(_mm_set1_ps(extent.m_y), absColumns[1], newExtent);
+			newExtent = Simd::multiplyAdd(_mm_set1_ps(extent.m_z), absColumns[2], newExtent);
+
+			Simd::store3(&outCenters[i].m_x, newCenter);
+			Simd::store3(&outExtents[i].m_x, newExtent);
+		}
+#else
+		const float* m = matrix.getArray();
+
+		const float absM[9]
+		{
+			abs(m[0]), abs(m[1]), abs(m[2]),
+			abs(m[4]), abs(m[5]), abs(m[6]),
+			abs(m[8]), abs(m[9]), abs(m[10])
+		};
+
+		for (size_t i = 0; i < centers.size(); i++)
+		{
+			const Vector3 center = centers[i];
+			const Vector3 extent = extents[i];
+
+			outCenters[i] =
+			{
+				m[0] * center.m_x + m[1] * center.m_y + m[2] * center.m_z + m[3],
+				m[4] * center.m_x + m[5] * center.m_y + m[6] * center.m_z + m[7],
+				m[8] * center.m_x + m[9] * center.m_y + m[10] * center.m_z + m[11]
+			};
+
+			outExtents[i] =
+			{
+				absM[0] * extent.m_x + absM[1] * extent.m_y + absM[2] * extent.m_z,
+				absM[3] * extent.m_x + absM[4] * extent.m_y + absM[5] * extent.m_z,
+				absM[6] * extent.m_x + absM[7] * extent.m_y + absM[8] * extent.m_z
+			};
+		}
+#endif
+	}
+
+	void concatenate(const std::span<const Matrix4> parents, const std::span<const Matrix4> locals,
+		const std::span<Matrix4> out)
+	{
+		if (locals.size() != parents.size())
+			throw std::invalid_argument("Parents and locals arrays have different sizes");
+
+		if (out.size() < parents.size())
+			throw std::invalid_argument("Output array is smaller than the operands arrays");
+
+		for (size_t i = 0; i < parents.size(); i++)
+		{
+#ifdef LIBMATH_USE_SIMD
+			Simd::multiplyMatrix4(parents[i].getArray(), locals[i].getArray(), out[i].getArray());
+#else
+			out[i] = parents[i] * locals[i];
+#endif
+		}
+	}
+}
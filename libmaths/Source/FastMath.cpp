@@ -0,0 +1,230 @@
+#include "FastMath.h"
+
+#include <stdexcept>
+
+#include "Arithmetic.h"
+
+namespace LibMath::Fast
+{
+#ifdef LIBMATH_USE_SIMD
+	namespace
+	{
+		// Lane-wise versions of the scalar kernels of FastMath.inl - L is Simd::Lanes4 or Simd::Lanes8
+		template <typename L>
+		void sinCosKernel(const typename L::Float radians, typename L::Float& outSin, typename L::Float& outCos)
+		{
+			using namespace Detail;
+			using Float = typename L::Float;
+			using Int = typename L::Int;
+
+			const Float signMask = L::set(-0.f);
+			Float x = L::bitAndNot(signMask, radians);
+
+			const Int octant = L::andInt(L::addInt(L::truncate(L::mul(x, L::set(g_fourOverPi))), L::setInt(1)), L::setInt(~1));
+			const Float y = L::toFloat(octant);
+
+			x = L::multiplyAdd(y, L::set(-g_piOver4Part1), x);
+			x = L::multiplyAdd(y, L::set(-g_piOver4Part2), x);
+			x = L::multiplyAdd(y, L::set(-g_piOver4Part3), x);
+
+			const Float xSquared = L::mul(x, x);
+
+			Float sinX = L::multiplyAdd(L::set(g_sin3), xSquared, L::set(g_sin2));
+			sinX = L::multiplyAdd(sinX, xSquared, L::set(g_sin1));
+			sinX = L::multiplyAdd(L::mul(sinX, xSquared), x, x);
+
+			Float cosX = L::multiplyAdd(L::set(g_cos3), xSquared, L::set(g_cos2));
+			cosX = L::multiplyAdd(cosX, xSquared, L::set(g_cos1));
+			cosX = L::multiplyAdd(L::mul(cosX, xSquared), xSquared, L::multiplyAdd(L::set(-.5f), xSquared, L::set(1.f)));
+
+			// Moves the quadrant bit (4) to the float's sign bit (31)
+			const Float swapMask = L::asFloat(L::equalInt(L::andInt(octant, L::setInt(2)), L::setInt(2)));
+			const Float sinSign = L::bitXor(L::bitAnd(radians, signMask), L::asFloat(L::shiftLeft(L::andInt(octant, L::setInt(4)), 29)));
+			const Float cosSign = L::asFloat(L::shiftLeft(L::andInt(L::addInt(octant, L::setInt(2)), L::setInt(4)), 29));
+
+			outSin = L::bitXor(L::select(sinX, cosX, swapMask), sinSign);
+			outCos = L::bitXor(L::select(cosX, sinX, swapMask), cosSign);
+		}
+
+		template <typename L>
+		typename L::Float rsqrtKernel(const typename L::Float values)
+		{
+			// The hardware estimate has a relative error below 3.7e-4, a second order Householder step brings it to float precision
+			const typename L::Float estimate = L::rsqrtEstimate(values);
+			const typename L::Float error = L::sub(L::set(1.f), L::mul(values, L::mul(estimate, estimate)));
+			const typename L::Float correction = L::mul(error, L::multiplyAdd(error, L::set(.375f), L::set(.5f)));
+
+			return L::multiplyAdd(estimate, correction, estimate);
+		}
+
+		template <typename L>
+		typename L::Float sqrtKernel(const typename L::Float values)
+		{
+			// rsqrt(0) is infinite - mask the non positive lanes out instead of returning NaN
+			const typename L::Float positiveMask = L::greaterThan(values, L::set(0.f));
+			return L::bitAnd(L::mul(values, rsqrtKernel<L>(values)), positiveMask);
+		}
+
+		template <typename L>
+		void sinBatch(const float* radians, float* out, size_t& index, const size_t count)
+		{
+			constexpr size_t laneCount = sizeof(typename L::Float) / sizeof(float);
+
+			for (; index + laneCount <= count; index += laneCount)
+			{
+				typename L::Float sin, cos;
+				sinCosKernel<L>(L::load(radians + index), sin, cos);
+				L::store(out + index, sin);
+			}
+		}
+
+		template <typename L>
+		void cosBatch(const float* radians, float* out, size_t& index, const size_t count)
+		{
+			constexpr size_t laneCount = sizeof(typename L::Float) / sizeof(float);
+
+			for (; index + laneCount <= count; index += laneCount)
+			{
+				typename L::Float sin, cos;
+				sinCosKernel<L>(L::load(radians + index), sin, cos);
+				L::store(out + index, cos);
+			}
+		}
+
+		template <typename L>
+		void sqrtBatch(const float* values, float* out, size_t& index, const size_t count)
+		{
+			constexpr size_t laneCount = sizeof(typename L::Float) / sizeof(float);
+
+			for (; index + laneCount <= count; index += laneCount)
+				L::store(out + index, sqrtKernel<L>(L::load(values + index)));
+		}
+
+		template <typename L>
+		void rsqrtBatch(const float* values, float* out, size_t& index, const size_t count)
+		{
+			constexpr size_t laneCount = sizeof(typename L::Float) / sizeof(float);
+
+			for (; index + laneCount <= count; index += laneCount)
+				L::store(out + index, rsqrtKernel<L>(L::load(values + index)));
+		}
+	}
+
+	void sinCos(const __m128 radians, __m128& outSin, __m128& outCos)
+	{
+		sinCosKernel<Simd::Lanes4>(radians, outSin, outCos);
+	}
+
+	__m128 rsqrt(const __m128 values)
+	{
+		return rsqrtKernel<Simd::Lanes4>(values);
+	}
+
+	__m128 sqrt(const __m128 values)
+	{
+		return sqrtKernel<Simd::Lanes4>(values);
+	}
+
+#ifdef LIBMATH_SIMD_AVX2
+	void sinCos(const __m256 radians, __m256& outSin, __m256& outCos)
+	{
+		sinCosKernel<Simd::Lanes8>(radians, outSin, outCos);
+	}
+
+	__m256 rsqrt(const __m256 values)
+	{
+		return rsqrtKernel<Simd::Lanes8>(values);
+	}
+
+	__m256 sqrt(const __m256 values)
+	{
+		return sqrtKernel<Simd::Lanes8>(values);
+	}
+#endif // LIBMATH_SIMD_AVX2
+#endif // LIBMATH_USE_SIMD
+
+	void sin(const std::span<const float> radians, const std::span<float> out)
+	{
+		if (out.size() < radians.size())
+			throw std::invalid_argument("Output array is smaller than the angles array");
+
+		size_t i = 0;
+
+#ifdef LIBMATH_SIMD_AVX2
+		sinBatch<Simd::Lanes8>(radians.data(), out.data(), i, radians.size());
+#endif
+
+#ifdef LIBMATH_USE_SIMD
+		sinBatch<Simd::Lanes4>(radians.data(), out.data(), i, radians.size());
+#endif
+
+		for (; i < radians.size(); i++)
+			out[i] = Fast::sin(Radian(radians[i]));
+	}
+
+	void cos(const std::span<const float> radians, const std::span<float> out)
+	{
+		if (out.size() < radians.size())
+			throw std::invalid_argument("Output array is smaller than the angles array");
+
+		size_t i = 0;
+
+#ifdef LIBMATH_SIMD_AVX2
+		cosBatch<Simd::Lanes8>(radians.data(), out.data(), i, radians.size());
+#endif
+
+#ifdef LIBMATH_USE_SIMD
+		cosBatch<Simd::Lanes4>(radians.data(), out.data(), i, radians.size());
+#endif
+
+		for (; i < radians.size(); i++)
+			out[i] = Fast::cos(Radian(radians[i]));
+	}
+
+	void sqrt(const std::span<const float> values, const std::span<float> out)
+	{
+		if (out.size() < values.size())
+			throw std::invalid_argument("Output array is smaller than the values array");
+
+		size_t i = 0;
+
+#ifdef LIBMATH_SIMD_AVX2
+		sqrtBatch<Simd::Lanes8>(values.data(), out.data(), i, values.size());
+#endif
+
+#ifdef LIBMATH_USE_SIMD
+		sqrtBatch<Simd::Lanes4>(values.data(), out.data(), i, values.size());
+#endif
+
+		for (; i < values.size(); i++)
+			out[i] = sqrt(values[i]);
+	}
+
+	void rsqrt(const std::span<const float> values, const std::span<float> out)
+	{
+		if (out.size() < values.size())
+			throw std::invalid_argument("Output array is smaller than the values array");
+
+		size_t i = 0;
+
+#ifdef LIBMATH_SIMD_AVX2
+		rsqrtBatch<Simd::Lanes8>(values.data(), out.data(), i, values.size());
+#endif
+
+#ifdef LIBMATH_USE_SIMD
+		rsqrtBatch<Simd::Lanes4>(values.data(), out.data(), i, values.size());
+#endif
+
+		for (; i < values.size(); i++)
+			out[i] = rsqrt(values[i]);
+	}
+
+	static_assert(Fast::sin(Radian(0.f)) == 0.f);
+	static_assert(Fast::cos(Radian(0.f)) == 1.f);
+	static_assert(Fast::sin(Radian(g_pi * .5f)) == 1.f);
+	static_assert(atan(0.f).raw() == 0.f);
+	static_assert(sqrt(0.f) == 0.f);
+	static_assert(isInRange(sqrt(16.f), 3.99999f, 4.00001f));
+	static_assert(isInRange(rsqrt(.25f), 1.99999f, 2.00001f));
+	static_assert(isInRange(atan(1.f, -1.f).raw(), g_pi * .75f - 1e-6f, g_pi * .75f + 1e-6f));
+}
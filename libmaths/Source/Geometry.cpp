@@ -0,0 +1,225 @@
+#include "Geometry.h"
+
+#include <limits>
+#include <stdexcept>
+
+#include "Arithmetic.h"
+#include "Simd.h"
+
+namespace LibMath
+{
+#ifdef LIBMATH_USE_SIMD
+	namespace
+	{
+		/**
+		 * \brief Computes which of the given planes have the grown box entirely on their negative side
+		 * \return A bit mask with a bit set for each plane rejecting the box
+		 */
+		template <typename L>
+		int outsideMask(const float* normalsX, const float* normalsY, const float* normalsZ, const float* distances,
+			const Vector3& center, const Vector3& extents, const float radius)
+		{
+			using Float = typename L::Float;
+
+			const Float signMask = L::set(-0.f);
+			const Float normalX = L::load(normalsX);
+			const Float normalY = L::load(normalsY);
+			const Float normalZ = L::load(normalsZ);
+
+			Float distance = L::multiplyAdd(normalX, L::set(center.m_x), L::load(distances));
+			distance = L::multiplyAdd(normalY, L::set(center.m_y), distance);
+			distance = L::multiplyAdd(normalZ, L::set(center.m_z), distance);
+
+			// Projection of the box's extents on each plane's normal
+			Float projectedRadius = L::multiplyAdd(L::bitAndNot(signMask, normalX), L::set(extents.m_x), L::set(radius));
+			projectedRadius = L::multiplyAdd(L::bitAndNot(signMask, normalY), L::set(extents.m_y), projectedRadius);
+			projectedRadius = L::multiplyAdd(L::bitAndNot(signMask, normalZ), L::set(extents.m_z), projectedRadius);
+
+			return L::moveMask(L::greaterThan(L::set(0.f), L::add(distance, projectedRadius)));
+		}
+	}
+#endif
+
+	AABB AABB::transformed(const Matrix4& matrix) const noexcept
+	{
+		const Vector3 center = this->center();
+		const Vector3 extents = this->extents();
+
+		// Arvo's method: the new extents are the old ones transformed by the absolute value of the matrix
+#ifdef LIBMATH_USE_SIMD
+		__m128 columns[4];
+		Simd::loadColumns(matrix.getArray(), columns);
+
+		__m128 worldCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_x), columns[0], columns[3]);
+		worldCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_y), columns[1], worldCenter);
+		worldCenter = Simd::multiplyAdd(_mm_set1_ps(center.m_z), columns[2], worldCenter);
+
+		__m128 worldExtents = _mm_mul_ps(_mm_set1_ps(extents.m_x), Simd::abs(columns[0]));
+		worldExtents = Simd::multiplyAdd(_mm_set1_ps(extents.m_y), Simd::abs(columns[1]), worldExtents);
+		worldExtents = Simd::multiplyAdd(_mm_set1_ps(extents.m_z), Simd::abs(columns[2]), worldExtents);
+
+		AABB result;
+		Simd::store3(&result.m_min.m_x, _mm_sub_ps(worldCenter, worldExtents));
+		Simd::store3(&result.m_max.m_x, _mm_add_ps(worldCenter, worldExtents));
+
+		return result;
+#else
+		const float* m = matrix.getArray();
+
+		const Vector3 worldCenter
+		{
+			m[0] * center.m_x + m[1] * center.m_y + m[2] * center.m_z + m[3],
+			m[4] * center.m_x + m[5] * center.m_y + m[6] * center.m_z + m[7],
+			m[8] * center.m_x + m[9] * center.m_y + m[10] * center.m_z + m[11]
+		};
+
+		const Vector3 worldExtents
+		{
+			abs(m[0]) * extents.m_x + abs(m[1]) * extents.m_y + abs(m[2]) * extents.m_z,
+			abs(m[4]) * extents.m_x + abs(m[5]) * extents.m_y + abs(m[6]) * extents.m_z,
+			abs(m[8]) * extents.m_x + abs(m[9]) * extents.m_y + abs(m[10]) * extents.m_z
+		};
+
+		return fromCenterExtents(worldCenter, worldExtents);
+#endif
+	}
+
+	Frustum::Frustum() noexcept
+	{
+		updateLanes();
+	}
+
+	Frustum::Frustum(const Matrix4& viewProjection) noexcept
+	{
+		const float* m = viewProjection.getArray();
+
+		// With clip = viewProjection * point, the point is inside if -w <= x, y, z <= w with w = row3.dot(point)
+		const Vector3 row[4] =
+		{
+			{ m[0], m[1], m[2] },
+			{ m[4], m[5], m[6] },
+			{ m[8], m[9], m[10] },
+			{ m[12], m[13], m[14] }
+		};
+
+		const float offset[4] = { m[3], m[7], m[11], m[15] };
+
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			m_planes[i * 2] = Plane(row[3] + row[i], offset[3] + offset[i]).normalized();
+			m_planes[i * 2 + 1] = Plane(row[3] - row[i], offset[3] - offset[i]).normalized();
+		}
+
+		updateLanes();
+	}
+
+	const Plane& Frustum::getPlane(const uint8_t index) const
+	{
+		if (index >= PLANE_COUNT)
+			throw std::out_of_range("Frustum plane index out of range");
+
+		return m_planes[index];
+	}
+
+	bool Frustum::contains(const Vector3& point) const noexcept
+	{
+		return !isOutside(point, Vector3::zero(), 0.f);
+	}
+
+	bool Frustum::intersects(const Sphere& sphere) const noexcept
+	{
+		return !isOutside(sphere.m_center, Vector3::zero(), sphere.m_radius);
+	}
+
+	bool Frustum::intersects(const AABB& box) const noexcept
+	{
+		return !isOutside(box.center(), box.extents(), 0.f);
+	}
+
+	EContainment Frustum::classify(const AABB& box, uint8_t& planeMask, uint8_t& lastPlane) const noexcept
+	{
+		const Vector3 center = box.center();
+		const Vector3 extents = box.extents();
+		const uint8_t firstPlane = lastPlane < PLANE_COUNT ? lastPlane : 0;
+
+		uint8_t straddledPlanes = 0;
+
+		for (uint8_t i = 0; i < PLANE_COUNT; i++)
+		{
+			// Swap the first plane with the one which rejected the box last time
+			const uint8_t planeIndex = i == 0 ? firstPlane : i == firstPlane ? 0 : i;
+			const uint8_t planeBit = static_cast<uint8_t>(1 << planeIndex);
+
+			if ((planeMask & planeBit) == 0)
+				continue;
+
+			const Plane& plane = m_planes[planeIndex];
+			const float distance = plane.signedDistance(center);
+			const float radius = abs(plane.m_normal.m_x) * extents.m_x + abs(plane.m_normal.m_y) * extents.m_y
+				+ abs(plane.m_normal.m_z) * extents.m_z;
+
+			if (distance + radius < 0.f)
+			{
+				lastPlane = planeIndex;
+				return EContainment::OUTSIDE;
+			}
+
+			if (distance - radius < 0.f)
+				straddledPlanes |= planeBit;
+		}
+
+		planeMask = straddledPlanes;
+		return straddledPlanes == 0 ? EContainment::INSIDE : EContainment::INTERSECTS;
+	}
+
+	void Frustum::updateLanes() noexcept
+	{
+		for (uint8_t i = 0; i < LANE_COUNT; i++)
+		{
+			// The padding lanes are planes which are infinitely far behind everything
+			const Plane plane = i < PLANE_COUNT ? m_planes[i] : Plane(Vector3::zero(), std::numeric_limits<float>::max());
+
+			m_normalsX[i] = plane.m_normal.m_x;
+			m_normalsY[i] = plane.m_normal.m_y;
+			m_normalsZ[i] = plane.m_normal.m_z;
+			m_distances[i] = plane.m_distance;
+		}
+	}
+
+	bool Frustum::isOutside(const Vector3& center, const Vector3& extents, const float radius) const noexcept
+	{
+#if defined(LIBMATH_SIMD_AVX2)
+		return outsideMask<Simd::Lanes8>(m_normalsX, m_normalsY, m_normalsZ, m_distances, center, extents, radius) != 0;
+#elif defined(LIBMATH_USE_SIMD)
+		return (outsideMask<Simd::Lanes4>(m_normalsX, m_normalsY, m_normalsZ, m_distances, center, extents, radius)
+			| outsideMask<Simd::Lanes4>(m_normalsX + 4, m_normalsY + 4, m_normalsZ + 4, m_distances + 4, center, extents, radius)) != 0;
+#else
+		bool isOutside = false;
+
+		// No early out - the loop is short enough for the branch to cost more than the remaining planes
+		for (uint8_t i = 0; i < PLANE_COUNT; i++)
+		{
+			const float distance = m_normalsX[i] * center.m_x + m_normalsY[i] * center.m_y + m_normalsZ[i] * center.m_z + m_distances[i];
+			const float projectedRadius = abs(m_normalsX[i]) * extents.m_x + abs(m_normalsY[i]) * extents.m_y
+				+ abs(m_normalsZ[i]) * extents.m_z + radius;
+
+			isOutside |= distance + projectedRadius < 0.f;
+		}
+
+		return isOutside;
+#endif
+	}
+
+	// The geometric tests defined in the .inl files must stay usable in constant expressions
+	static_assert(AABB(Vector3(-1.f), Vector3(1.f)).intersects(AABB(Vector3(1.f), Vector3(2.f))));
+	static_assert(!AABB(Vector3(-1.f), Vector3(1.f)).intersects(AABB(Vector3(1.5f), Vector3(2.f))));
+	static_assert(AABB::empty().merged(AABB(Vector3(-1.f), Vector3(1.f))) == AABB(Vector3(-1.f), Vector3(1.f)));
+	static_assert(AABB(Vector3(-1.f), Vector3(1.f)).distanceSquaredFrom(Vector3(3.f, 0.f, 0.f)) == 4.f);
+	static_assert(Sphere(Vector3(3.f, 0.f, 0.f), 2.f).intersects(AABB(Vector3(-1.f), Vector3(1.f))));
+	static_assert(!Sphere(Vector3(3.f), 2.f).intersects(AABB(Vector3(-1.f), Vector3(1.f))));
+	static_assert(Plane::fromPointNormal(Vector3::up(), Vector3::up()).signedDistance(Vector3(0.f, 3.f, 0.f)) == 2.f);
+	static_assert(OBB(Vector3::zero(), Vector3(1.f), Vector3::right(), Vector3::up(), Vector3::front())
+		.intersects(OBB(Vector3(1.9f, 0.f, 0.f), Vector3(1.f), Vector3::right(), Vector3::up(), Vector3::front())));
+	static_assert(!OBB(Vector3::zero(), Vector3(1.f), Vector3::right(), Vector3::up(), Vector3::front())
+		.intersects(OBB(Vector3(2.1f, 0.f, 0.f), Vector3(1.f), Vector3::right(), Vector3::up(), Vector3::front())));
+}
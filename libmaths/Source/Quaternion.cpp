@@ -0,0 +1,312 @@
+#include "Quaternion.h"
+
+#include <cmath>
+#include <sstream>
+
+#include "Arithmetic.h"
+#include "FastMath.h"
+#include "Trigonometry.h"
+#include "Angle/Radian.h"
+
+namespace LibMath
+{
+	Quaternion::Quaternion() = default;
+
+	Quaternion::Quaternion(const float x, const float y, const float z, const float w)
+		: m_x(x), m_y(y), m_z(z), m_w(w)
+	{
+	}
+
+	Quaternion Quaternion::identity()
+	{
+		return {};
+	}
+
+	Quaternion Quaternion::fromAxisAngle(const Radian& angle, const Vector3& axis)
+	{
+		const Vector3 dir = axis.normalized();
+		const Radian halfAngle = angle * .5f;
+		const float sin = LibMath::sin(halfAngle);
+
+		return { dir.m_x * sin, dir.m_y * sin, dir.m_z * sin, LibMath::cos(halfAngle) };
+	}
+
+	Quaternion Quaternion::fromEuler(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle)
+	{
+		const Radian halfX = xAngle * .5f;
+		const Radian halfY = yAngle * .5f;
+		const Radian halfZ = zAngle * .5f;
+
+		return fromHalfAngles(sin(halfX), cos(halfX), sin(halfY), cos(halfY), sin(halfZ), cos(halfZ));
+	}
+
+	Quaternion Quaternion::fromEulerFast(const Radian& xAngle, const Radian& yAngle, const Radian& zAngle)
+	{
+		float cosX, sinX, cosY, sinY, cosZ, sinZ;
+		Fast::sinCos(xAngle * .5f, sinX, cosX);
+		Fast::sinCos(yAngle * .5f, sinY, cosY);
+		Fast::sinCos(zAngle * .5f, sinZ, cosZ);
+
+		return fromHalfAngles(sinX, cosX, sinY, cosY, sinZ, cosZ);
+	}
+
+	Quaternion Quaternion::fromEuler(const Vector3& angles, const bool isRadian)
+	{
+		if (isRadian)
+			return fromEuler(Radian(angles.m_x), Radian(angles.m_y), Radian(angles.m_z));
+
+		return fromEuler(Degree(angles.m_x), Degree(angles.m_y), Degree(angles.m_z));
+	}
+
+	Quaternion Quaternion::nlerp(const Quaternion& from, const Quaternion& to, const float t)
+	{
+		// q and -q represent the same rotation - flip the target to interpolate along the shortest arc
+		const float sign = from.dot(to) < 0.f ? -1.f : 1.f;
+
+		Quaternion result
+		{
+			from.m_x + (to.m_x * sign - from.m_x) * t,
+			from.m_y + (to.m_y * sign - from.m_y) * t,
+			from.m_z + (to.m_z * sign - from.m_z) * t,
+			from.m_w + (to.m_w * sign - from.m_w) * t
+		};
+
+		result.normalize();
+		return result;
+	}
+
+	Quaternion Quaternion::slerp(const Quaternion& from, const Quaternion& to, const float t)
+	{
+		float cosTheta = from.dot(to);
+		float sign = 1.f;
+
+		if (cosTheta < 0.f)
+		{
+			cosTheta = -cosTheta;
+			sign = -1.f;
+		}
+
+		// Nearly parallel rotations make sin(theta) tend towards 0 - fall back to nlerp
+		if (cosTheta > .9995f)
+			return nlerp(from, to, t);
+
+		const Radian theta = acos(cosTheta);
+		const float invSinTheta = 1.f / sin(theta);
+
+		const float fromWeight = sin(theta * (1.f - t)) * invSinTheta;
+		const float toWeight = sin(theta * t) * invSinTheta * sign;
+
+		return
+		{
+			from.m_x * fromWeight + to.m_x * toWeight,
+			from.m_y * fromWeight + to.m_y * toWeight,
+			from.m_z * fromWeight + to.m_z * toWeight,
+			from.m_w * fromWeight + to.m_w * toWeight
+		};
+	}
+
+	Quaternion& Quaternion::operator*=(Quaternion const& other)
+	{
+		return (*this = *this * other);
+	}
+
+	Quaternion Quaternion::operator*(Quaternion const& other) const
+	{
+		return
+		{
+			m_w * other.m_x + m_x * other.m_w + m_y * other.m_z - m_z * other.m_y,
+			m_w * other.m_y - m_x * other.m_z + m_y * other.m_w + m_z * other.m_x,
+			m_w * other.m_z + m_x * other.m_y - m_y * other.m_x + m_z * other.m_w,
+			m_w * other.m_w - m_x * other.m_x - m_y * other.m_y - m_z * other.m_z
+		};
+	}
+
+	Vector3 Quaternion::operator*(Vector3 const& vector) const
+	{
+		return rotate(vector);
+	}
+
+	bool Quaternion::operator==(Quaternion const& other) const
+	{
+		return floatEquals(m_x, other.m_x)
+			&& floatEquals(m_y, other.m_y)
+			&& floatEquals(m_z, other.m_z)
+			&& floatEquals(m_w, other.m_w);
+	}
+
+	bool Quaternion::operator!=(Quaternion const& other) const
+	{
+		return !(*this == other);
+	}
+
+	float Quaternion::dot(Quaternion const& other) const
+	{
+		return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z + m_w * other.m_w;
+	}
+
+	float Quaternion::magnitude() const
+	{
+		return sqrtf(magnitudeSquared());
+	}
+
+	float Quaternion::magnitudeSquared() const
+	{
+		return dot(*this);
+	}
+
+	void Quaternion::normalize()
+	{
+		const float invLength = 1.f / magnitude();
+
+		m_x *= invLength;
+		m_y *= invLength;
+		m_z *= invLength;
+		m_w *= invLength;
+	}
+
+	Quaternion Quaternion::normalized() const
+	{
+		Quaternion quat = *this;
+		quat.normalize();
+		return quat;
+	}
+
+	void Quaternion::normalizeFast()
+	{
+		const float invLength = Fast::rsqrt(magnitudeSquared());
+
+		m_x *= invLength;
+		m_y *= invLength;
+		m_z *= invLength;
+		m_w *= invLength;
+	}
+
+	Quaternion Quaternion::normalizedFast() const
+	{
+		Quaternion quat = *this;
+		quat.normalizeFast();
+		return quat;
+	}
+
+	Quaternion Quaternion::conjugate() const
+	{
+		return { -m_x, -m_y, -m_z, m_w };
+	}
+
+	Quaternion Quaternion::inverse() const
+	{
+		const float invLengthSquared = 1.f / magnitudeSquared();
+
+		return
+		{
+			-m_x * invLengthSquared,
+			-m_y * invLengthSquared,
+			-m_z * invLengthSquared,
+			m_w * invLengthSquared
+		};
+	}
+
+	Vector3 Quaternion::rotate(Vector3 const& vector) const
+	{
+		// v' = v + w * t + u x t with u the vector part and t = 2 * (u x v)
+		const Vector3 axis(m_x, m_y, m_z);
+		const Vector3 t = axis.cross(vector) * 2.f;
+
+		return vector + t * m_w + axis.cross(t);
+	}
+
+	Vector3 Quaternion::toEuler(const bool isRadian) const
+	{
+		const float m00 = 1.f - 2.f * (m_y * m_y + m_z * m_z);
+		const float m02 = 2.f * (m_x * m_z + m_w * m_y);
+		const float m10 = 2.f * (m_x * m_y + m_w * m_z);
+		const float m11 = 1.f - 2.f * (m_x * m_x + m_z * m_z);
+		const float m12 = 2.f * (m_y * m_z - m_w * m_x);
+		const float m20 = 2.f * (m_x * m_z - m_w * m_y);
+		const float m22 = 1.f - 2.f * (m_x * m_x + m_y * m_y);
+
+		// atan2 stays accurate close to +/- 90 degrees where asin(-m12) would lose most of its precision
+		const float cosPitch = sqrtf(m10 * m10 + m11 * m11);
+
+		Vector3 angles;
+		angles.m_x = atan(-m12, cosPitch).raw();
+
+		if (cosPitch > 1e-4f)
+		{
+			angles.m_y = atan(m02, m22).raw();
+			angles.m_z = atan(m10, m11).raw();
+		}
+		else
+		{
+			// Gimbal lock - yaw and roll rotate around the same axis so the roll is folded into the yaw
+			angles.m_y = atan(-m20, m00).raw();
+			angles.m_z = 0.f;
+		}
+
+		if (!isRadian)
+			angles *= 180.f / g_pi;
+
+		return angles;
+	}
+
+	Matrix4x4 Quaternion::toMatrix() const
+	{
+		// Every product is computed once and the rows are written contiguously
+		const float xx = m_x * m_x;
+		const float yy = m_y * m_y;
+		const float zz = m_z * m_z;
+		const float xy = m_x * m_y;
+		const float xz = m_x * m_z;
+		const float yz = m_y * m_z;
+		const float wx = m_w * m_x;
+		const float wy = m_w * m_y;
+		const float wz = m_w * m_z;
+
+		Matrix4x4 mat;
+		float* values = mat.getArray();
+
+		values[0] = 1.f - 2.f * (yy + zz);
+		values[1] = 2.f * (xy - wz);
+		values[2] = 2.f * (xz + wy);
+		values[3] = 0.f;
+
+		values[4] = 2.f * (xy + wz);
+		values[5] = 1.f - 2.f * (xx + zz);
+		values[6] = 2.f * (yz - wx);
+		values[7] = 0.f;
+
+		values[8] = 2.f * (xz - wy);
+		values[9] = 2.f * (yz + wx);
+		values[10] = 1.f - 2.f * (xx + yy);
+		values[11] = 0.f;
+
+		values[12] = 0.f;
+		values[13] = 0.f;
+		values[14] = 0.f;
+		values[15] = 1.f;
+
+		return mat;
+	}
+
+	std::string Quaternion::string() const
+	{
+		std::ostringstream oss;
+
+		oss << "{" << m_x << "," << m_y << "," << m_z << "," << m_w << "}";
+
+		return oss.str();
+	}
+
+	Quaternion Quaternion::fromHalfAngles(const float sinX, const float cosX, const float sinY, const float cosY,
+		const float sinZ, const float cosZ)
+	{
+		// Expanded form of fromAxisAngle(yAngle, up) * fromAxisAngle(xAngle, right) * fromAxisAngle(zAngle, front)
+		return
+		{
+			cosY * sinX * cosZ + sinY * cosX * sinZ,
+			sinY * cosX * cosZ - cosY * sinX * sinZ,
+			cosY * cosX * sinZ - sinY * sinX * cosZ,
+			cosY * cosX * cosZ + sinY * sinX * sinZ
+		};
+	}
+}
@@ -1,17 +1,33 @@
 #include "Transform.h"
 
-#include "Vector/Vector4.h"
-
 namespace LibMath
 {
+#ifdef LIBMATH_TRANSFORM_STATS
+	// Every writer bumps the same cache line, so the counters are kept out of the release builds' hot paths
+	std::atomic<uint64_t> Transform::s_changeCount = 0;
+	std::atomic<uint64_t> Transform::s_rebuildCount = 0;
+#endif
+
+	uint64_t Transform::MatrixStats::getAvoidedCount() const
+	{
+		return m_changeCount > m_rebuildCount ? m_changeCount - m_rebuildCount : 0;
+	}
+
 	Transform::Transform()
-		: m_position(Vector3::zero()), m_rotation(Vector3::zero()),
+		: m_position(Vector3::zero()), m_rotation(Quaternion::identity()),
 		m_scale(Vector3::one())
 	{
 		Transform::onChange();
 	}
 
 	Transform::Transform(const Vector3& position, const Vector3& rotation,
+		const Vector3& scale)
+		: m_position(position), m_rotation(Quaternion::fromEuler(rotation, false)), m_scale(scale)
+	{
+		Transform::onChange();
+	}
+
+	Transform::Transform(const Vector3& position, const Quaternion& rotation,
 		const Vector3& scale)
 		: m_position(position), m_rotation(rotation), m_scale(scale)
 	{
@@ -20,16 +36,14 @@ namespace LibMath
 
 	Transform::Transform(const Transform& other)
 		: m_position(other.m_position), m_rotation(other.m_rotation),
-		m_scale(other.m_scale)
+		m_scale(other.m_scale), m_matrix(other.m_matrix), m_isDirty(other.m_isDirty)
 	{
-		Transform::onChange();
 	}
 
 	Transform::Transform(Transform&& other) noexcept
 		: m_position(other.m_position), m_rotation(other.m_rotation),
-		m_scale(other.m_scale)
+		m_scale(other.m_scale), m_matrix(other.m_matrix), m_isDirty(other.m_isDirty)
 	{
-		Transform::onChange();
 	}
 
 	Transform& Transform::operator=(const Transform& other)
@@ -68,13 +82,10 @@ namespace LibMath
 
 	Transform& Transform::operator*=(const Transform& other)
 	{
-		const Matrix4 newMat = getMatrix() * other.getMatrix();
-
-		m_position = Vector3(newMat(0, 3), newMat(1, 3), newMat(2, 3));
-		m_rotation += other.getRotation();
-		m_rotation.m_x *= -1.f;
-		m_rotation.m_z *= -1.f;
-		m_scale *= other.getScale();
+		m_position += m_rotation.rotate(m_scale * other.m_position);
+		// Only renormalizes a product of unit quaternions, so the fast tier's 2 ulp are enough
+		m_rotation = (m_rotation * other.m_rotation).normalizedFast();
+		m_scale *= other.m_scale;
 
 		onChange();
 
@@ -88,12 +99,12 @@ namespace LibMath
 
 	Vector3 Transform::right() const
 	{
-		return (m_matrix * Vector4::right()).xyz().normalized();
+		return m_rotation.rotate(Vector3::right());
 	}
 
 	Vector3 Transform::up() const
 	{
-		return (m_matrix * Vector4::up()).xyz().normalized();
+		return m_rotation.rotate(Vector3::up());
 	}
 
 	Vector3 Transform::back() const
@@ -117,6 +128,11 @@ namespace LibMath
 	}
 
 	Vector3 Transform::getRotation() const
+	{
+		return m_rotation.toEuler(false);
+	}
+
+	Quaternion Transform::getOrientation() const
 	{
 		return m_rotation;
 	}
@@ -128,9 +144,28 @@ namespace LibMath
 
 	Matrix4x4 Transform::getMatrix() const
 	{
+		if (m_isDirty)
+			updateMatrix();
+
 		return m_matrix;
 	}
 
+	Transform& Transform::setTRS(const Vector3& position, const Quaternion& rotation, const Vector3& scale)
+	{
+		m_position = position;
+		m_rotation = rotation;
+		m_scale = scale;
+
+		onChange();
+
+		return *this;
+	}
+
+	Transform& Transform::setTRS(const Vector3& position, const Vector3& rotation, const Vector3& scale)
+	{
+		return setTRS(position, Quaternion::fromEuler(rotation, false), scale);
+	}
+
 	Transform& Transform::setPosition(const Vector3& position)
 	{
 		m_position = position;
@@ -142,7 +177,16 @@ namespace LibMath
 
 	Transform& Transform::setRotation(const Vector3& rotation)
 	{
-		m_rotation = rotation;
+		m_rotation = Quaternion::fromEuler(rotation, false);
+
+		onChange();
+
+		return *this;
+	}
+
+	Transform& Transform::setOrientation(const Quaternion& orientation)
+	{
+		m_rotation = orientation;
 
 		onChange();
 
@@ -169,7 +213,12 @@ namespace LibMath
 
 	Transform& Transform::rotate(const Vector3& rotation)
 	{
-		m_rotation += rotation;
+		return setRotation(getRotation() + rotation);
+	}
+
+	Transform& Transform::rotate(const Quaternion& rotation)
+	{
+		m_rotation = (m_rotation * rotation).normalizedFast();
 
 		onChange();
 
@@ -185,10 +234,52 @@ namespace LibMath
 		return *this;
 	}
 
+	Transform::MatrixStats Transform::getMatrixStats()
+	{
+#ifdef LIBMATH_TRANSFORM_STATS
+		return { s_changeCount.load(std::memory_order_relaxed), s_rebuildCount.load(std::memory_order_relaxed) };
+#else
+		return { 0, 0 };
+#endif
+	}
+
+	void Transform::resetMatrixStats()
+	{
+#ifdef LIBMATH_TRANSFORM_STATS
+		s_changeCount.store(0, std::memory_order_relaxed);
+		s_rebuildCount.store(0, std::memory_order_relaxed);
+#endif
+	}
+
 	void Transform::onChange()
 	{
-		m_matrix = Matrix4::translation(m_position)
-			* Matrix4::rotation(m_rotation, false)
-			* Matrix4::scaling(m_scale);
+		m_isDirty = true;
+
+#ifdef LIBMATH_TRANSFORM_STATS
+		s_changeCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+	}
+
+	void Transform::updateMatrix() const
+	{
+		// Equivalent to translation * rotation * scaling without the two matrix products
+		m_matrix = m_rotation.toMatrix();
+
+		for (Matrix4::length_t row = 0; row < 3; row++)
+		{
+			m_matrix(row, 0) *= m_scale.m_x;
+			m_matrix(row, 1) *= m_scale.m_y;
+			m_matrix(row, 2) *= m_scale.m_z;
+		}
+
+		m_matrix(0, 3) = m_position.m_x;
+		m_matrix(1, 3) = m_position.m_y;
+		m_matrix(2, 3) = m_position.m_z;
+
+		m_isDirty = false;
+
+#ifdef LIBMATH_TRANSFORM_STATS
+		s_rebuildCount.fetch_add(1, std::memory_order_relaxed);
+#endif
 	}
 }
@@ -6,17 +6,17 @@ namespace LibMath
 {
 	float sin(const Radian& angle)
 	{
-		return sinf(angle.radian());
+		return sinf(angle.raw());
 	}
 
 	float cos(const Radian& angle)
 	{
-		return cosf(angle.radian());
+		return cosf(angle.raw());
 	}
 
 	float tan(const Radian& angle)
 	{
-		return tanf(angle.radian());
+		return tanf(angle.raw());
 	}
 
 	Radian asin(const float val)
@@ -0,0 +1,159 @@
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "Test.h"
+
+#include "FastMath.h"
+#include "Trigonometry.h"
+
+using namespace LibMath;
+
+namespace
+{
+	constexpr size_t g_sampleCount = 1 << 20;
+
+	enum class EErrorKind
+	{
+		ULP,
+		ABSOLUTE
+	};
+
+	/**
+	 * \brief Computes the distance between an approximation and the exact value, in units in the last place of the exact value
+	 */
+	double ulpError(const float approximation, const double exact)
+	{
+		const float rounded = std::abs(static_cast<float>(exact));
+		const float ulp = rounded == 0.f ? std::numeric_limits<float>::denorm_min()
+			: std::nextafter(rounded, std::numeric_limits<float>::infinity()) - rounded;
+
+		return std::abs(static_cast<double>(approximation) - exact) / static_cast<double>(ulp);
+	}
+
+	/**
+	 * \brief Evaluates an approximation over the given inputs and checks its max error against the documented bound
+	 * \return True if the max error is within the bound. False otherwise
+	 */
+	template <typename Approximation, typename Exact>
+	bool checkError(const char* name, const std::vector<float>& inputs, const EErrorKind kind, const double bound,
+		Approximation approximation, Exact exact)
+	{
+		double maxError = 0.;
+		float worstInput = 0.f;
+
+		for (size_t i = 0; i < inputs.size(); i++)
+		{
+			const double reference = exact(static_cast<double>(inputs[i]));
+			const float value = approximation(i);
+
+			const double error = kind == EErrorKind::ULP ? ulpError(value, reference)
+				: std::abs(static_cast<double>(value) - reference);
+
+			if (error > maxError)
+			{
+				maxError = error;
+				worstInput = inputs[i];
+			}
+		}
+
+		const bool isValid = maxError <= bound;
+
+		printf("%-24s %12.3g %12.3g %-4s %14.7g  %s\n", name, maxError, bound, kind == EErrorKind::ULP ? "ulp" : "abs",
+			static_cast<double>(worstInput), isValid ? "ok" : "FAILED");
+
+		return isValid;
+	}
+
+	std::vector<float> linearSamples(const float min, const float max)
+	{
+		std::vector<float> samples(g_sampleCount);
+
+		for (size_t i = 0; i < g_sampleCount; i++)
+			samples[i] = min + (max - min) * static_cast<float>(i) / static_cast<float>(g_sampleCount - 1);
+
+		return samples;
+	}
+
+	std::vector<float> logarithmicSamples(const float minExponent, const float maxExponent)
+	{
+		std::vector<float> samples(g_sampleCount);
+
+		for (size_t i = 0; i < g_sampleCount; i++)
+			samples[i] = std::exp2(minExponent + (maxExponent - minExponent) * static_cast<float>(i) / static_cast<float>(g_sampleCount - 1));
+
+		return samples;
+	}
+
+	bool checkErrorBounds()
+	{
+		const std::vector<float> angles = linearSamples(-2.f * g_pi, 2.f * g_pi);
+		const std::vector<float> largeAngles = linearSamples(-8192.f, 8192.f);
+		const std::vector<float> positives = logarithmicSamples(-100.f, 100.f);
+
+		std::vector<float> tangents = logarithmicSamples(-20.f, 20.f);
+
+		for (size_t i = 0; i < tangents.size(); i += 2)
+			tangents[i] = -tangents[i];
+
+		std::vector<float> batched(g_sampleCount);
+		bool isValid = true;
+
+		const auto exactSin = [](const double x) { return std::sin(x); };
+		const auto exactCos = [](const double x) { return std::cos(x); };
+		const auto exactSqrt = [](const double x) { return std::sqrt(x); };
+		const auto exactRsqrt = [](const double x) { return 1. / std::sqrt(x); };
+
+		printf("%-24s %12s %12s %-4s %14s\n", "kernel", "max error", "bound", "", "worst input");
+
+		isValid &= checkError("Fast::sin", angles, EErrorKind::ULP, 2.,
+			[&](const size_t i) { return Fast::sin(Radian(angles[i])); }, exactSin);
+
+		isValid &= checkError("Fast::sin (large)", largeAngles, EErrorKind::ABSOLUTE, 1e-7,
+			[&](const size_t i) { return Fast::sin(Radian(largeAngles[i])); }, exactSin);
+
+		isValid &= checkError("Fast::cos", angles, EErrorKind::ULP, 2.,
+			[&](const size_t i) { return Fast::cos(Radian(angles[i])); }, exactCos);
+
+		isValid &= checkError("Fast::cos (large)", largeAngles, EErrorKind::ABSOLUTE, 1e-7,
+			[&](const size_t i) { return Fast::cos(Radian(largeAngles[i])); }, exactCos);
+
+		isValid &= checkError("Fast::atan", tangents, EErrorKind::ULP, 4.,
+			[&](const size_t i) { return Fast::atan(tangents[i]).raw(); }, [](const double x) { return std::atan(x); });
+
+		// atan(y, x) is sampled along the unit circle
+		isValid &= checkError("Fast::atan2", angles, EErrorKind::ULP, 4.,
+			[&](const size_t i) { return Fast::atan(std::sin(angles[i]), std::cos(angles[i])).raw(); },
+			[](const double x) { return std::atan2(static_cast<double>(std::sin(static_cast<float>(x))), static_cast<double>(std::cos(static_cast<float>(x)))); });
+
+		isValid &= checkError("Fast::rsqrt", positives, EErrorKind::ULP, 2.,
+			[&](const size_t i) { return Fast::rsqrt(positives[i]); }, exactRsqrt);
+
+		isValid &= checkError("Fast::sqrt", positives, EErrorKind::ULP, .5,
+			[&](const size_t i) { return Fast::sqrt(positives[i]); }, exactSqrt);
+
+		Fast::sin(angles, batched);
+		isValid &= checkError("Fast::sin (batched)", angles, EErrorKind::ULP, 2.,
+			[&](const size_t i) { return batched[i]; }, exactSin);
+
+		Fast::cos(largeAngles, batched);
+		isValid &= checkError("Fast::cos (batched)", largeAngles, EErrorKind::ABSOLUTE, 1e-7,
+			[&](const size_t i) { return batched[i]; }, exactCos);
+
+		Fast::rsqrt(positives, batched);
+		isValid &= checkError("Fast::rsqrt (batched)", positives, EErrorKind::ULP, 2.,
+			[&](const size_t i) { return batched[i]; }, exactRsqrt);
+
+		Fast::sqrt(positives, batched);
+		isValid &= checkError("Fast::sqrt (batched)", positives, EErrorKind::ULP, 3.,
+			[&](const size_t i) { return batched[i]; }, exactSqrt);
+
+		return isValid;
+	}
+}
+
+bool checkFastMathErrorBounds()
+{
+	return checkErrorBounds();
+}
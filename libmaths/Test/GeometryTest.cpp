@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Test.h"
+
+#include "Angle.h"
+#include "Geometry.h"
+#include "Matrix.h"
+
+using namespace LibMath;
+
+namespace
+{
+	constexpr unsigned	g_seed = 42;
+	constexpr size_t	g_sampleCount = 1 << 16;
+
+	// Relative distance to a decision's boundary under which float rounding may flip it
+	constexpr double	g_boundaryMargin = 1e-4;
+
+	/**
+	 * \brief Generates the given number of vectors whose components are uniformly distributed random values
+	 * \param count The number of vectors to generate
+	 * \param min The lowest component value which can be generated
+	 * \param max The highest component value which can be generated
+	 * \return The generated vectors
+	 */
+	std::vector<Vector3> randomVectors(const size_t count, const float min, const float max)
+	{
+		std::mt19937 generator(g_seed);
+		std::uniform_real_distribution<float> distribution(min, max);
+
+		std::vector<Vector3> vectors(count);
+
+		for (Vector3& vector : vectors)
+		{
+			vector.m_x = distribution(generator);
+			vector.m_y = distribution(generator);
+			vector.m_z = distribution(generator);
+		}
+
+		return vectors;
+	}
+
+	/**
+	 * \brief Generates boxes whose bounds are integers, so their contacts are exact and often touching or zero sized
+	 * \param count The number of boxes to generate
+	 * \return The generated boxes
+	 */
+	std::vector<AABB> gridBoxes(const size_t count)
+	{
+		std::mt19937 generator(g_seed);
+		std::uniform_int_distribution<int> position(-6, 6);
+		std::uniform_int_distribution<int> size(0, 3);
+
+		std::vector<AABB> boxes(count);
+
+		for (AABB& box : boxes)
+		{
+			const Vector3 min(static_cast<float>(position(generator)), static_cast<float>(position(generator)),
+				static_cast<float>(position(generator)));
+
+			box = { min, min + Vector3(static_cast<float>(size(generator)), static_cast<float>(size(generator)),
+				static_cast<float>(size(generator))) };
+		}
+
+		return boxes;
+	}
+
+	std::vector<AABB> randomBoxes(const size_t count)
+	{
+		const std::vector<Vector3> centers = randomVectors(count, -20.f, 20.f);
+		std::vector<Vector3> extents = randomVectors(count, 0.f, 4.f);
+
+		// Flat and point boxes, as for the bounds of planes and particles
+		for (size_t i = 0; i < count; i += 8)
+		{
+			extents[i].m_y = 0.f;
+			extents[i + 1] = Vector3::zero();
+		}
+
+		std::vector<AABB> boxes(count);
+
+		for (size_t i = 0; i < count; i++)
+			boxes[i] = AABB::fromCenterExtents(centers[i], extents[i]);
+
+		return boxes;
+	}
+
+	/**
+	 * \brief Prints the number of samples a kernel got wrong
+	 * \return True if the kernel got every sample right. False otherwise
+	 */
+	bool report(const char* name, const size_t failures, const size_t samples)
+	{
+		const bool isValid = failures == 0;
+		printf("%-32s %10zu %10zu  %s\n", name, failures, samples, isValid ? "ok" : "FAILED");
+
+		return isValid;
+	}
+
+	bool intervalsOverlap(const float min, const float max, const float otherMin, const float otherMax)
+	{
+		return min <= otherMax && otherMin <= max;
+	}
+
+	// Touching boxes, spheres and frustum planes are intersecting. The grid boxes make the expected results exact
+	bool checkTouchingContacts()
+	{
+		const std::vector<AABB> boxes = gridBoxes(512);
+		const AABB frustumBox(Vector3(-4.f), Vector3(4.f));
+		const Frustum frustum(Matrix4::orthographicProjection(-4.f, 4.f, -4.f, 4.f, -4.f, 4.f));
+
+		size_t boxFailures = 0;
+		size_t sphereFailures = 0;
+		size_t obbFailures = 0;
+		size_t frustumFailures = 0;
+		size_t samples = 0;
+
+		for (size_t i = 0; i < boxes.size(); i++)
+		{
+			const AABB& box = boxes[i];
+			const OBB obb(box.center(), box.extents(), Vector3::right(), Vector3::up(), Vector3::front());
+
+			// The spheres' squared radius and distances are integers
+			const Sphere sphere(box.m_min, static_cast<float>(i % 4));
+
+			for (size_t j = 0; j < boxes.size(); j++)
+			{
+				const AABB& other = boxes[j];
+				const Sphere otherSphere(other.m_min, static_cast<float>(j % 3));
+
+				const bool isOverlapping = intervalsOverlap(box.m_min.m_x, box.m_max.m_x, other.m_min.m_x, other.m_max.m_x)
+					&& intervalsOverlap(box.m_min.m_y, box.m_max.m_y, other.m_min.m_y, other.m_max.m_y)
+					&& intervalsOverlap(box.m_min.m_z, box.m_max.m_z, other.m_min.m_z, other.m_max.m_z);
+
+				const float totalRadius = sphere.m_radius + otherSphere.m_radius;
+				const bool areSpheresOverlapping = sphere.m_center.distanceSquaredFrom(otherSphere.m_center) <= totalRadius * totalRadius;
+
+				boxFailures += box.intersects(other) != isOverlapping;
+				sphereFailures += sphere.intersects(otherSphere) != areSpheresOverlapping;
+				sphereFailures += otherSphere.intersects(box) != (box.distanceSquaredFrom(otherSphere.m_center) <= otherSphere.m_radius * otherSphere.m_radius);
+
+				// The separating axis test is only exact up to its epsilon, which the grid's unit gaps are far above
+				obbFailures += obb.intersects(OBB(other.center(), other.extents(), Vector3::right(), Vector3::up(), Vector3::front())) != isOverlapping;
+				samples++;
+			}
+
+			uint8_t planeMask = Frustum::ALL_PLANES;
+			uint8_t lastPlane = 0;
+
+			const bool isVisible = box.intersects(frustumBox);
+			frustumFailures += frustum.intersects(box) != isVisible;
+			frustumFailures += (frustum.classify(box, planeMask, lastPlane) != EContainment::OUTSIDE) != isVisible;
+			frustumFailures += frustum.contains(box.m_max) != frustumBox.contains(box.m_max);
+
+			// The sphere test is plane by plane, so it accepts the spheres near the corners which are only inside every plane
+			frustumFailures += frustum.intersects(sphere) != frustumBox.expanded(Vector3(sphere.m_radius)).contains(sphere.m_center);
+		}
+
+		bool isValid = report("AABB::intersects (touching)", boxFailures, samples);
+		isValid &= report("Sphere::intersects (touching)", sphereFailures, samples * 2);
+		isValid &= report("OBB::intersects (touching)", obbFailures, samples);
+		isValid &= report("Frustum (touching)", frustumFailures, boxes.size() * 4);
+
+		return isValid;
+	}
+
+	// Axis aligned rays have infinite inverse directions, and NaN slab distances when they lie in a face's plane
+	bool checkParallelRays()
+	{
+		const std::vector<AABB> boxes = gridBoxes(256);
+		const std::vector<AABB> origins = gridBoxes(257);
+
+		size_t failures = 0;
+		size_t samples = 0;
+
+		for (size_t i = 0; i < boxes.size(); i++)
+		{
+			const AABB& box = boxes[i];
+			const Vector3& origin = origins[i + 1].m_min;
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				for (const float sign : { -1.f, 1.f })
+				{
+					Vector3 direction;
+					direction[axis] = sign;
+
+					const float boxMin[3] = { box.m_min.m_x, box.m_min.m_y, box.m_min.m_z };
+					const float boxMax[3] = { box.m_max.m_x, box.m_max.m_y, box.m_max.m_z };
+					const float start[3] = { origin.m_x, origin.m_y, origin.m_z };
+
+					// The ray stays in the box's slabs on the other axes, faces included, and the box isn't behind it
+					bool isHit = true;
+
+					for (int other = 0; other < 3; other++)
+					{
+						if (other != axis)
+							isHit &= boxMin[other] <= start[other] && start[other] <= boxMax[other];
+					}
+
+					const float entry = sign > 0.f ? boxMin[axis] - start[axis] : start[axis] - boxMax[axis];
+					const float exit = sign > 0.f ? boxMax[axis] - start[axis] : start[axis] - boxMin[axis];
+					isHit &= exit >= 0.f;
+
+					float distanceIn, distanceOut;
+					const bool hasHit = box.raycast(origin, Vector3::one() / direction, distanceIn, distanceOut);
+
+					failures += hasHit != isHit;
+
+					if (hasHit && isHit)
+						failures += distanceIn != entry || distanceOut != exit;
+
+					samples++;
+				}
+			}
+		}
+
+		return report("AABB::raycast (parallel)", failures, samples);
+	}
+
+	// The kernels which have a SIMD path are compared with double precision references, so the SIMD and
+	// scalar builds are held to the same results. The few samples too close to a boundary to call are skipped
+	bool checkAgainstReferences()
+	{
+		const std::vector<AABB> boxes = randomBoxes(g_sampleCount);
+		// Every input draws from the same seed, so the rays' ends are interleaved to keep them apart from the boxes
+		const std::vector<Vector3> points = randomVectors(g_sampleCount * 3, -30.f, 30.f);
+
+		const Matrix4 matrix = Matrix4::translation(1.f, 2.f, 3.f)
+			* Matrix4::rotation(Degree(30.f), Degree(45.f), Degree(60.f))
+			* Matrix4::scaling(2.f, 3.f, 4.f);
+
+		const Frustum frustum(Matrix4::perspectiveProjection(Degree(60.f), 16.f / 9.f, .1f, 30.f)
+			* Matrix4::lookAt(Vector3(0.f, 5.f, 25.f), Vector3::zero(), Vector3::up()));
+
+		size_t raycastFailures = 0;
+		size_t raycastSamples = 0;
+		size_t transformFailures = 0;
+		size_t frustumFailures = 0;
+		size_t frustumSamples = 0;
+
+		for (size_t i = 0; i < g_sampleCount; i++)
+		{
+			const AABB& box = boxes[i];
+			const Vector3& origin = points[i * 3 + 1];
+			const Vector3 direction = points[i * 3 + 2] - origin;
+
+			double referenceIn = -INFINITY;
+			double referenceOut = INFINITY;
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				const double toMin = (static_cast<double>(box.m_min[axis]) - origin[axis]) / direction[axis];
+				const double toMax = (static_cast<double>(box.m_max[axis]) - origin[axis]) / direction[axis];
+
+				referenceIn = std::max(referenceIn, std::min(toMin, toMax));
+				referenceOut = std::min(referenceOut, std::max(toMin, toMax));
+			}
+
+			float distanceIn, distanceOut;
+			const bool hasHit = box.raycast(origin, Vector3::one() / direction, distanceIn, distanceOut);
+			const double margin = std::min(referenceOut - referenceIn, referenceOut);
+
+			if (std::abs(margin) > g_boundaryMargin * std::max(1., std::abs(referenceOut)))
+			{
+				raycastFailures += hasHit != (margin > 0.);
+
+				if (hasHit)
+				{
+					raycastFailures += std::abs(distanceIn - referenceIn) > g_boundaryMargin * std::max(1., std::abs(referenceIn))
+						|| std::abs(distanceOut - referenceOut) > g_boundaryMargin * std::max(1., std::abs(referenceOut));
+				}
+
+				raycastSamples++;
+			}
+
+			// Arvo's method in SIMD against the always scalar oriented box bounds
+			const AABB transformed = box.transformed(matrix);
+			const AABB reference = OBB::fromTransformedAABB(box, matrix).bounds();
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				const float tolerance = 1e-5f * std::max(1.f, std::abs(reference.m_max[axis]) + std::abs(reference.m_min[axis]));
+
+				transformFailures += std::abs(transformed.m_min[axis] - reference.m_min[axis]) > tolerance
+					|| std::abs(transformed.m_max[axis] - reference.m_max[axis]) > tolerance;
+			}
+
+			// The plane lanes in SIMD against the always scalar plane by plane classification
+			double frustumMargin = INFINITY;
+
+			for (uint8_t plane = 0; plane < Frustum::PLANE_COUNT; plane++)
+			{
+				const Plane& frustumPlane = frustum.getPlane(plane);
+				double distance = frustumPlane.m_distance;
+				double radius = 0.;
+
+				for (int axis = 0; axis < 3; axis++)
+				{
+					distance += static_cast<double>(frustumPlane.m_normal[axis]) * box.center()[axis];
+					radius += std::abs(static_cast<double>(frustumPlane.m_normal[axis])) * box.extents()[axis];
+				}
+
+				frustumMargin = std::min(frustumMargin, distance + radius);
+			}
+
+			if (std::abs(frustumMargin) > g_boundaryMargin)
+			{
+				uint8_t planeMask = Frustum::ALL_PLANES;
+				uint8_t lastPlane = 0;
+
+				const bool isVisible = frustumMargin >= 0.;
+				frustumFailures += frustum.intersects(box) != isVisible;
+				frustumFailures += (frustum.classify(box, planeMask, lastPlane) != EContainment::OUTSIDE) != isVisible;
+				frustumSamples++;
+			}
+		}
+
+		bool isValid = report("AABB::raycast (random)", raycastFailures, raycastSamples);
+		isValid &= report("AABB::transformed", transformFailures, g_sampleCount * 3);
+		isValid &= report("Frustum::intersects (random)", frustumFailures, frustumSamples * 2);
+
+		return isValid;
+	}
+}
+
+bool checkGeometryKernels()
+{
+	printf("%-32s %10s %10s\n", "kernel", "failures", "samples");
+
+	bool isValid = checkTouchingContacts();
+	isValid &= checkParallelRays();
+	isValid &= checkAgainstReferences();
+
+	return isValid;
+}
@@ -0,0 +1,14 @@
+#include <cstdio>
+
+#include "Test.h"
+
+// Accuracy checks which must hold in every build - the timings are left to libmaths_bench
+int main()
+{
+	bool isValid = checkFastMathErrorBounds();
+	printf("\n");
+
+	isValid &= checkGeometryKernels();
+
+	return isValid ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+#ifndef __LIBMATH__TEST__TEST_H__
+#define __LIBMATH__TEST__TEST_H__
+
+/**
+ * \brief Checks the fast math kernels against their documented error bounds
+ * \return True if every kernel is within its documented error bound. False otherwise
+ */
+bool checkFastMathErrorBounds();
+
+/**
+ * \brief Checks the geometry kernels on touching, parallel and zero sized inputs, and against double precision references
+ * \return True if every kernel got every sample right. False otherwise
+ */
+bool checkGeometryKernels();
+
+#endif // !__LIBMATH__TEST__TEST_H__